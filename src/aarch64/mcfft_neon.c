@@ -24,6 +24,10 @@
 
 #include "mcfft_neon.h"
 #include "generic/mcfft_generic.h"
+#include <stdio.h>
+#if defined(__APPLE__)
+#include <sys/sysctl.h>
+#endif
 #define MC_FFT_DIRECTION fft
 #define MC_INVERSE_FFT (0)
 #include "mcfft_rad4_template_neon.c"
@@ -39,6 +43,234 @@ void mc_shuffle_mono_neon(float * restrict re, float * restrict im, float * rest
     mc_shuffle_mono_g(re, im, buffer, digitRev, length);
 }
 
+void mc_transpose_tile_neon(float * restrict out, const float * restrict in, uint32_t inStride, uint32_t outStride, uint32_t rows) {
+    /** 4x4 blocks are transposed in registers */
+    for (uint32_t r = 0; r < rows; r += 4u) {
+        for (uint32_t c = 0; c < 8u; c += 4u) {
+            const float *src = &in[r*inStride + c];
+            float32x4x2_t t0 = vtrnq_f32(vld1q_f32(src), vld1q_f32(&src[inStride]));
+            float32x4x2_t t1 = vtrnq_f32(vld1q_f32(&src[2u*inStride]), vld1q_f32(&src[3u*inStride]));
+            vst1q_f32(&out[c*outStride + r], vcombine_f32(vget_low_f32(t0.val[0]), vget_low_f32(t1.val[0])));
+            vst1q_f32(&out[(c + 1u)*outStride + r], vcombine_f32(vget_low_f32(t0.val[1]), vget_low_f32(t1.val[1])));
+            vst1q_f32(&out[(c + 2u)*outStride + r], vcombine_f32(vget_high_f32(t0.val[0]), vget_high_f32(t1.val[0])));
+            vst1q_f32(&out[(c + 3u)*outStride + r], vcombine_f32(vget_high_f32(t0.val[1]), vget_high_f32(t1.val[1])));
+        }
+    }
+}
+
+void mc_fft_columns_neon(float * restrict re, float * restrict im, const float * restrict twiddle, 
+                         const uint16_t * restrict bitRev, uint32_t stride, uint32_t pow2, uint32_t columns) {
+    /** DIF over rows, 4 columns per vector (see mc_fft_columns_g()) */
+    const uint32_t length = 1u<<pow2;
+    const uint32_t vColumns = columns & ~3u;
+    const float *twIm = &twiddle[length];
+    uint32_t quarter = length>>2u;
+    for (uint32_t twStep = 1u; quarter > 0; quarter >>= 2u, twStep <<= 2u) {
+        for (uint32_t start = 0; start < length; start += 4u*quarter) {
+            for (uint32_t j = 0; j < quarter; ++j) {
+                const float w1Re = twiddle[j*twStep], w1Im = twIm[j*twStep];
+                const float w2Re = twiddle[2u*j*twStep], w2Im = twIm[2u*j*twStep];
+                const float w3Re = twiddle[3u*j*twStep], w3Im = twIm[3u*j*twStep];
+                float *aRe = &re[(start + j)*stride];
+                float *aIm = &im[(start + j)*stride];
+                float *bRe = &re[(start + j + quarter)*stride];
+                float *bIm = &im[(start + j + quarter)*stride];
+                float *cRe = &re[(start + j + 2u*quarter)*stride];
+                float *cIm = &im[(start + j + 2u*quarter)*stride];
+                float *dRe = &re[(start + j + 3u*quarter)*stride];
+                float *dIm = &im[(start + j + 3u*quarter)*stride];
+                for (uint32_t c = 0; c < vColumns; c += 4u) {
+                    const float32x4_t aRe_v = vld1q_f32(&aRe[c]);
+                    const float32x4_t aIm_v = vld1q_f32(&aIm[c]);
+                    const float32x4_t bRe_v = vld1q_f32(&bRe[c]);
+                    const float32x4_t bIm_v = vld1q_f32(&bIm[c]);
+                    const float32x4_t cRe_v = vld1q_f32(&cRe[c]);
+                    const float32x4_t cIm_v = vld1q_f32(&cIm[c]);
+                    const float32x4_t dRe_v = vld1q_f32(&dRe[c]);
+                    const float32x4_t dIm_v = vld1q_f32(&dIm[c]);
+                    const float32x4_t s0Re_v = vaddq_f32(aRe_v, cRe_v);
+                    const float32x4_t s0Im_v = vaddq_f32(aIm_v, cIm_v);
+                    const float32x4_t d0Re_v = vsubq_f32(aRe_v, cRe_v);
+                    const float32x4_t d0Im_v = vsubq_f32(aIm_v, cIm_v);
+                    const float32x4_t s1Re_v = vaddq_f32(bRe_v, dRe_v);
+                    const float32x4_t s1Im_v = vaddq_f32(bIm_v, dIm_v);
+                    const float32x4_t d1Re_v = vsubq_f32(bRe_v, dRe_v);
+                    const float32x4_t d1Im_v = vsubq_f32(bIm_v, dIm_v);
+                    const float32x4_t y2Re_v = vsubq_f32(s0Re_v, s1Re_v);
+                    const float32x4_t y2Im_v = vsubq_f32(s0Im_v, s1Im_v);
+                    const float32x4_t y1Re_v = vaddq_f32(d0Re_v, d1Im_v);
+                    const float32x4_t y1Im_v = vsubq_f32(d0Im_v, d1Re_v);
+                    const float32x4_t y3Re_v = vsubq_f32(d0Re_v, d1Im_v);
+                    const float32x4_t y3Im_v = vaddq_f32(d0Im_v, d1Re_v);
+                    vst1q_f32(&aRe[c], vaddq_f32(s0Re_v, s1Re_v));
+                    vst1q_f32(&aIm[c], vaddq_f32(s0Im_v, s1Im_v));
+                    vst1q_f32(&bRe[c], vmlsq_n_f32(vmulq_n_f32(y2Re_v, w2Re), y2Im_v, w2Im));
+                    vst1q_f32(&bIm[c], vmlaq_n_f32(vmulq_n_f32(y2Re_v, w2Im), y2Im_v, w2Re));
+                    vst1q_f32(&cRe[c], vmlsq_n_f32(vmulq_n_f32(y1Re_v, w1Re), y1Im_v, w1Im));
+                    vst1q_f32(&cIm[c], vmlaq_n_f32(vmulq_n_f32(y1Re_v, w1Im), y1Im_v, w1Re));
+                    vst1q_f32(&dRe[c], vmlsq_n_f32(vmulq_n_f32(y3Re_v, w3Re), y3Im_v, w3Im));
+                    vst1q_f32(&dIm[c], vmlaq_n_f32(vmulq_n_f32(y3Re_v, w3Im), y3Im_v, w3Re));
+                }
+            }
+        }
+    }
+    if (pow2 & 1u) {
+        for (uint32_t start = 0; start < length; start += 2u) {
+            float *aRe = &re[start*stride];
+            float *aIm = &im[start*stride];
+            float *bRe = &re[(start + 1u)*stride];
+            float *bIm = &im[(start + 1u)*stride];
+            for (uint32_t c = 0; c < vColumns; c += 4u) {
+                const float32x4_t aRe_v = vld1q_f32(&aRe[c]);
+                const float32x4_t aIm_v = vld1q_f32(&aIm[c]);
+                const float32x4_t bRe_v = vld1q_f32(&bRe[c]);
+                const float32x4_t bIm_v = vld1q_f32(&bIm[c]);
+                vst1q_f32(&aRe[c], vaddq_f32(aRe_v, bRe_v));
+                vst1q_f32(&aIm[c], vaddq_f32(aIm_v, bIm_v));
+                vst1q_f32(&bRe[c], vsubq_f32(aRe_v, bRe_v));
+                vst1q_f32(&bIm[c], vsubq_f32(aIm_v, bIm_v));
+            }
+        }
+    }
+    for (uint32_t i = 0; i < length; ++i) {
+        const uint32_t j = bitRev[i];
+        if (i < j) {
+            for (uint32_t c = 0; c < vColumns; c += 4u) {
+                const float32x4_t re_v = vld1q_f32(&re[i*stride + c]);
+                const float32x4_t im_v = vld1q_f32(&im[i*stride + c]);
+                vst1q_f32(&re[i*stride + c], vld1q_f32(&re[j*stride + c]));
+                vst1q_f32(&im[i*stride + c], vld1q_f32(&im[j*stride + c]));
+                vst1q_f32(&re[j*stride + c], re_v);
+                vst1q_f32(&im[j*stride + c], im_v);
+            }
+        }
+    }
+    if (vColumns < columns) {
+        mc_fft_columns_g(&re[vColumns], &im[vColumns], twiddle, bitRev, stride, pow2, columns - vColumns);
+    }
+}
+
+void mc_gather_signed_neon(float * restrict out, const float * restrict in, const uint16_t * restrict index, uint32_t length) {
+    const uint32x4_t sign_mask_v = vdupq_n_u32(MC_GATHER_NEGATE);
+    const uint32_t mask = MC_GATHER_NEGATE - 1u;
+    for (uint32_t i = 0; i < length; i += 4u) {
+        /** NOTE: no gather in NEON */
+        float32x4_t value_v = {in[index[i] & mask], in[index[i+1u] & mask], in[index[i+2u] & mask], in[index[i+3u] & mask]};
+        /** MSB of 16-bit index -> sign bit of float */
+        uint32x4_t sign_v = vshlq_n_u32(vandq_u32(vmovl_u16(vld1_u16(&index[i])), sign_mask_v), 16);
+        vst1q_f32(&out[i], vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(value_v), sign_v)));
+    }
+}
+
+static inline float32x4_t st_reverse_neon(float32x4_t v) {
+    float32x4_t r = vrev64q_f32(v);
+    return vextq_f32(r, r, 2);
+}
+
+void mc_mdct_fold_neon(float * restrict re, float * restrict im, const float * restrict in, const float * restrict coeff, 
+                       const uint32_t * restrict offset, uint32_t length) {
+    const float *rotRe = &coeff[4u*length];
+    const float *rotIm = &coeff[5u*length];
+    for (uint32_t m = 0; m < length; m += 4u) {
+        /** Forward stream: even lanes of vld2, reversed stream: odd lanes of vld2 from p-7 */
+        float32x4_t tRe_v = vmulq_f32(vld1q_f32(&coeff[m]), vld2q_f32(&in[offset[0] + 2u*m]).val[0]);
+        float32x4_t tIm_v = vmulq_f32(vld1q_f32(&coeff[2u*length + m]), vld2q_f32(&in[offset[2] + 2u*m]).val[0]);
+        tRe_v = vmlaq_f32(tRe_v, vld1q_f32(&coeff[length + m]), st_reverse_neon(vld2q_f32(&in[offset[1] - 2u*m - 7u]).val[1]));
+        tIm_v = vmlaq_f32(tIm_v, vld1q_f32(&coeff[3u*length + m]), st_reverse_neon(vld2q_f32(&in[offset[3] - 2u*m - 7u]).val[1]));
+        float32x4_t rotRe_v = vld1q_f32(&rotRe[m]);
+        float32x4_t rotIm_v = vld1q_f32(&rotIm[m]);
+        vst1q_f32(&re[m], vmlsq_f32(vmulq_f32(tRe_v, rotRe_v), tIm_v, rotIm_v));
+        vst1q_f32(&im[m], vmlaq_f32(vmulq_f32(tRe_v, rotIm_v), tIm_v, rotRe_v));
+    }
+}
+
+void mc_mdct_unfold_neon(float * restrict out, const float * restrict re, const float * restrict im, 
+                         const float * restrict rotation, uint32_t length) {
+    const float *rotIm = &rotation[length];
+    for (uint32_t k = 0; k < length; k += 4u) {
+        const uint32_t j = length - 4u - k;
+        float32x4x2_t y_v;
+        y_v.val[0] = vmlsq_f32(vmulq_f32(vld1q_f32(&re[k]), vld1q_f32(&rotation[k])), vld1q_f32(&im[k]), vld1q_f32(&rotIm[k]));
+        y_v.val[1] = vmlaq_f32(vmulq_f32(vld1q_f32(&re[j]), vld1q_f32(&rotIm[j])), vld1q_f32(&im[j]), vld1q_f32(&rotation[j]));
+        y_v.val[1] = st_reverse_neon(vnegq_f32(y_v.val[1]));
+        vst2q_f32(&out[2u*k], y_v);
+    }
+}
+
+void mc_mdct_overlap_neon(float * restrict out, float * restrict overlap, const float * restrict in, 
+                          const float * restrict window, uint32_t length) {
+    for (uint32_t i = 0; i < length; i += 4u) {
+        vst1q_f32(&out[i], vmlaq_f32(vld1q_f32(&overlap[i]), vld1q_f32(&window[i]), vld1q_f32(&in[i])));
+        vst1q_f32(&overlap[i], vmulq_f32(vld1q_f32(&window[length + i]), vld1q_f32(&in[length + i])));
+    }
+}
+
+void mc_polyphase_mac_neon(float * restrict outRe, float * restrict outIm, const float * restrict re, const float * restrict im, 
+                           const float * restrict coeff, uint32_t stride, uint32_t length, uint32_t taps) {
+    for (uint32_t k = 0; k < length; k += 4u) {
+        float32x4_t accRe_v = vdupq_n_f32(0);
+        float32x4_t accIm_v = vdupq_n_f32(0);
+        for (uint32_t p = 0; p < taps; ++p) {
+            float32x4_t coeff_v = vld1q_f32(&coeff[p*stride + k]);
+            accRe_v = vmlaq_f32(accRe_v, coeff_v, vld1q_f32(&re[p*stride + k]));
+            accIm_v = vmlaq_f32(accIm_v, coeff_v, vld1q_f32(&im[p*stride + k]));
+        }
+        vst1q_f32(&outRe[k], accRe_v);
+        vst1q_f32(&outIm[k], accIm_v);
+    }
+}
+
+void mc_goertzel_neon(float * restrict outRe, float * restrict outIm, const float * restrict in, 
+                      const float * restrict coeff, uint32_t length, uint32_t bins) {
+    /** Recursion is latency bound: 4 independent vectors (16 bins) per pass over input */
+    const float *sinW = &coeff[bins];
+    uint32_t b = 0;
+    for (; (b + 16u) <= bins; b += 16u) {
+        float32x4_t c0_v = vld1q_f32(&coeff[b]);
+        float32x4_t c1_v = vld1q_f32(&coeff[b + 4u]);
+        float32x4_t c2_v = vld1q_f32(&coeff[b + 8u]);
+        float32x4_t c3_v = vld1q_f32(&coeff[b + 12u]);
+        float32x4_t k0_v = vaddq_f32(c0_v, c0_v), k1_v = vaddq_f32(c1_v, c1_v);
+        float32x4_t k2_v = vaddq_f32(c2_v, c2_v), k3_v = vaddq_f32(c3_v, c3_v);
+        float32x4_t a0_v = vdupq_n_f32(0), a1_v = a0_v, a2_v = a0_v, a3_v = a0_v;
+        float32x4_t p0_v = a0_v, p1_v = a0_v, p2_v = a0_v, p3_v = a0_v;
+        for (uint32_t n = 0; n < length; ++n) {
+            float32x4_t x_v = vdupq_n_f32(in[n]);
+            float32x4_t t0_v = vmlaq_f32(vsubq_f32(x_v, p0_v), k0_v, a0_v);
+            float32x4_t t1_v = vmlaq_f32(vsubq_f32(x_v, p1_v), k1_v, a1_v);
+            float32x4_t t2_v = vmlaq_f32(vsubq_f32(x_v, p2_v), k2_v, a2_v);
+            float32x4_t t3_v = vmlaq_f32(vsubq_f32(x_v, p3_v), k3_v, a3_v);
+            p0_v = a0_v, p1_v = a1_v, p2_v = a2_v, p3_v = a3_v;
+            a0_v = t0_v, a1_v = t1_v, a2_v = t2_v, a3_v = t3_v;
+        }
+        vst1q_f32(&outRe[b], vsubq_f32(vmulq_f32(c0_v, a0_v), p0_v));
+        vst1q_f32(&outRe[b + 4u], vsubq_f32(vmulq_f32(c1_v, a1_v), p1_v));
+        vst1q_f32(&outRe[b + 8u], vsubq_f32(vmulq_f32(c2_v, a2_v), p2_v));
+        vst1q_f32(&outRe[b + 12u], vsubq_f32(vmulq_f32(c3_v, a3_v), p3_v));
+        vst1q_f32(&outIm[b], vmulq_f32(vld1q_f32(&sinW[b]), a0_v));
+        vst1q_f32(&outIm[b + 4u], vmulq_f32(vld1q_f32(&sinW[b + 4u]), a1_v));
+        vst1q_f32(&outIm[b + 8u], vmulq_f32(vld1q_f32(&sinW[b + 8u]), a2_v));
+        vst1q_f32(&outIm[b + 12u], vmulq_f32(vld1q_f32(&sinW[b + 12u]), a3_v));
+    }
+    for (; b < bins; b += 4u) {
+        float32x4_t c_v = vld1q_f32(&coeff[b]);
+        float32x4_t k_v = vaddq_f32(c_v, c_v);
+        float32x4_t a_v = vdupq_n_f32(0), p_v = a_v;
+        for (uint32_t n = 0; n < length; ++n) {
+            float32x4_t t_v = vmlaq_f32(vsubq_f32(vdupq_n_f32(in[n]), p_v), k_v, a_v);
+            p_v = a_v;
+            a_v = t_v;
+        }
+        vst1q_f32(&outRe[b], vsubq_f32(vmulq_f32(c_v, a_v), p_v));
+        vst1q_f32(&outIm[b], vmulq_f32(vld1q_f32(&sinW[b]), a_v));
+    }
+}
+
+void mc_shuffle_window_neon(float * restrict out, const float * restrict ring, const float * restrict window, 
+                            const uint16_t * restrict digitRev, uint32_t offset, uint32_t ringMask, uint32_t length) {
+    mc_shuffle_window_g(out, ring, window, digitRev, offset, ringMask, length);
+}
+
 static void st_rad2_mono_depth1_neon(float *re, float *im, uint32_t fftLength) {
     for (uint32_t stepIdx = 0; stepIdx < fftLength; stepIdx += 8u) {
         float32x4x2_t re_v = vld2q_f32(re);
@@ -74,6 +306,31 @@ void mc_fft_dif_mono_core_neon(float * restrict re, float * restrict im, const f
     }
 }
 
+void mc_fft_dif_mono_range_neon(float * restrict re, float * restrict im, const float * restrict twiddle, uint32_t pow2,
+                                 uint32_t firstStep, uint32_t lastStep) {
+    const uint32_t fftLength = 1u<<(pow2);
+    uint32_t step = fftLength;
+    /** Stages with step > firstStep are skipped along with their twiddle factors */
+    while ((step > firstStep) && (step > 16u)) {
+        twiddle += MC_TWIDDLE_STAGE_SIZE(step);
+        step >>= 2u;
+    }
+    while ((step > 16u) && (step > lastStep)) {
+        st_fft_dif_rad4_mono_loop_neon(re, im, twiddle, fftLength, step);
+        twiddle += MC_TWIDDLE_STAGE_SIZE(step);
+        step >>= 2u;
+    }
+    if (0 == lastStep) {
+        if (pow2 % 2u) {
+            st_fft_dif_rad4_mono_depth2_odd_neon(re, im, twiddle, fftLength);
+            st_rad2_mono_depth1_neon(re, im, fftLength);
+        } else {
+            st_fft_dif_rad4_mono_depth2_neon(re, im, twiddle, fftLength);
+            st_fft_rad4_mono_depth1_neon(re, im, fftLength);
+        }
+    }
+}
+
 void mc_ifft_dif_mono_core_neon(float * restrict re, float * restrict im, const float * restrict twiddle, uint32_t pow2) {
     const uint32_t fftLength = 1u<<(pow2);
     uint32_t step = fftLength;
@@ -141,4 +398,116 @@ void mc_ifft_dit_mono_core_neon(float * restrict re, float * restrict im, const
     } while (step != fftLength);
 }
 
+void mc_fft_dif_multi_core_neon(float **re, float **im, uint32_t channels, const float * restrict twiddle, uint32_t pow2) {
+    const uint32_t fftLength = 1u<<(pow2);
+    uint32_t step = fftLength;
+    do {
+        for (uint32_t ch = 0; ch < channels; ++ch) {
+            st_fft_dif_rad4_mono_loop_neon(re[ch], im[ch], twiddle, fftLength, step);
+        }
+        twiddle += MC_TWIDDLE_STAGE_SIZE(step);
+        step >>= 2u;
+    } while (step > 16u);
+    for (uint32_t ch = 0; ch < channels; ++ch) {
+        if (pow2 % 2u) {
+            st_fft_dif_rad4_mono_depth2_odd_neon(re[ch], im[ch], twiddle, fftLength);
+            st_rad2_mono_depth1_neon(re[ch], im[ch], fftLength);
+        } else {
+            st_fft_dif_rad4_mono_depth2_neon(re[ch], im[ch], twiddle, fftLength);
+            st_fft_rad4_mono_depth1_neon(re[ch], im[ch], fftLength);
+        }
+    }
+}
+
+void mc_ifft_dif_multi_core_neon(float **re, float **im, uint32_t channels, const float * restrict twiddle, uint32_t pow2) {
+    const uint32_t fftLength = 1u<<(pow2);
+    uint32_t step = fftLength;
+    do {
+        for (uint32_t ch = 0; ch < channels; ++ch) {
+            st_ifft_dif_rad4_mono_loop_neon(re[ch], im[ch], twiddle, fftLength, step);
+        }
+        twiddle += MC_TWIDDLE_STAGE_SIZE(step);
+        step >>= 2u;
+    } while (step > 16u);
+    for (uint32_t ch = 0; ch < channels; ++ch) {
+        if (pow2 % 2u) {
+            st_ifft_dif_rad4_mono_depth2_odd_neon(re[ch], im[ch], twiddle, fftLength);
+            st_rad2_mono_depth1_neon(re[ch], im[ch], fftLength);
+        } else {
+            st_ifft_dif_rad4_mono_depth2_neon(re[ch], im[ch], twiddle, fftLength);
+            st_ifft_rad4_mono_depth1_neon(re[ch], im[ch], fftLength);
+        }
+    }
+}
+
+void mc_fft_dit_multi_core_neon(float **re, float **im, uint32_t channels, const float * restrict twiddle, uint32_t pow2) {
+    const uint32_t fftLength = 1u<<(pow2);
+    uint32_t step = (pow2 % 2u) ? 8u : 16u;
+    /* Shift pointer of twiddle factor to the end, more twiddle factors first for better memory alignement */
+    twiddle += MC_TWIDDLE_LENGTH(pow2);
+    twiddle -= MC_TWIDDLE_STAGE_SIZE(step);
+    /** The first stages are short and have a few twiddle factors: channel by channel */
+    for (uint32_t ch = 0; ch < channels; ++ch) {
+        if (pow2 % 2u) {
+            st_rad2_mono_depth1_neon(re[ch], im[ch], fftLength);
+            st_fft_dit_rad4_mono_depth2_odd_neon(re[ch], im[ch], twiddle, fftLength);
+        } else {
+            st_fft_rad4_mono_depth1_neon(re[ch], im[ch], fftLength);
+            st_fft_dit_rad4_mono_depth2_neon(re[ch], im[ch], twiddle, fftLength);
+        }
+    }
+    do {
+        step <<= 2u;
+        twiddle -= MC_TWIDDLE_STAGE_SIZE(step);
+        for (uint32_t ch = 0; ch < channels; ++ch) {
+            st_fft_dit_rad4_mono_loop_neon(re[ch], im[ch], twiddle, fftLength, step);
+        }
+    } while (step != fftLength);
+}
+
+void mc_ifft_dit_multi_core_neon(float **re, float **im, uint32_t channels, const float * restrict twiddle, uint32_t pow2) {
+    const uint32_t fftLength = 1u<<(pow2);
+    uint32_t step = (pow2 % 2u) ? 8u : 16u;
+    /* Shift pointer of twiddle factor to the end, more twiddle factors first for better memory alignement */
+    twiddle += MC_TWIDDLE_LENGTH(pow2);
+    twiddle -= MC_TWIDDLE_STAGE_SIZE(step);
+    /** The first stages are short and have a few twiddle factors: channel by channel */
+    for (uint32_t ch = 0; ch < channels; ++ch) {
+        if (pow2 % 2u) {
+            st_rad2_mono_depth1_neon(re[ch], im[ch], fftLength);
+            st_ifft_dit_rad4_mono_depth2_odd_neon(re[ch], im[ch], twiddle, fftLength);
+        } else {
+            st_ifft_rad4_mono_depth1_neon(re[ch], im[ch], fftLength);
+            st_ifft_dit_rad4_mono_depth2_neon(re[ch], im[ch], twiddle, fftLength);
+        }
+    }
+    do {
+        step <<= 2u;
+        twiddle -= MC_TWIDDLE_STAGE_SIZE(step);
+        for (uint32_t ch = 0; ch < channels; ++ch) {
+            st_ifft_dit_rad4_mono_loop_neon(re[ch], im[ch], twiddle, fftLength, step);
+        }
+    } while (step != fftLength);
+}
 
+void mc_get_cpu_id_neon(char *out, uint32_t length) {
+    char model[64] = "aarch64";
+    MC_NULLPTR_ASSERT(out);
+#if defined(__APPLE__)
+    size_t modelSize = sizeof(model);
+    if (0 != sysctlbyname("machdep.cpu.brand_string", model, &modelSize, NULL, 0)) {
+        snprintf(model, sizeof(model), "aarch64");
+    }
+#elif defined(__linux__) && !defined(MC_EXCLUDE_FILE_IO)
+    /** Main ID register (implementer, part number, revision) exported by kernel */
+    FILE *midr = fopen("/sys/devices/system/cpu/cpu0/regs/identification/midr_el1", "r");
+    if (NULL != midr) {
+        if (NULL == fgets(model, sizeof(model), midr)) {
+            snprintf(model, sizeof(model), "aarch64");
+        }
+        model[strcspn(model, "\n")] = '\0';
+        fclose(midr);
+    }
+#endif
+    snprintf(out, length, "neon:%s", model);
+}
@@ -229,10 +229,18 @@ static void MC_FUNC_TEMPLATE(MC_FFT_DIRECTION, dit_rad4_mono_loop, neon)(float *
         for (uint32_t i = 0; i < qStep; i += 8u) {
             float32x4_t twdB_vRe = vld1q_f32(twd);
             float32x4_t twdB_vIm = vld1q_f32(twd+8u);
+#if MC_COMPACT_TWIDDLE
+            /* 2*angle & 3*angle are derived from angle */
+            float32x4_t twdC_vRe = vmlsq_f32(vmulq_f32(twdB_vRe, twdB_vRe), twdB_vIm, twdB_vIm);
+            float32x4_t twdC_vIm = vmulq_f32(vaddq_f32(twdB_vRe, twdB_vRe), twdB_vIm);
+            float32x4_t twdD_vRe = vmlsq_f32(vmulq_f32(twdC_vRe, twdB_vRe), twdC_vIm, twdB_vIm);
+            float32x4_t twdD_vIm = vmlaq_f32(vmulq_f32(twdC_vRe, twdB_vIm), twdC_vIm, twdB_vRe);
+#else
             float32x4_t twdC_vRe = vld1q_f32(twd+16u);
             float32x4_t twdC_vIm = vld1q_f32(twd+24u);
             float32x4_t twdD_vRe = vld1q_f32(twd+32u);
             float32x4_t twdD_vIm = vld1q_f32(twd+40u);
+#endif
 
             float32x4_t re_v0 = vld1q_f32(aRe);
             float32x4_t re_v1 = vld1q_f32(bRe);
@@ -304,10 +312,17 @@ static void MC_FUNC_TEMPLATE(MC_FFT_DIRECTION, dit_rad4_mono_loop, neon)(float *
 
             twdB_vRe = vld1q_f32(twd);
             twdB_vIm = vld1q_f32(twd+8u);
+#if MC_COMPACT_TWIDDLE
+            twdC_vRe = vmlsq_f32(vmulq_f32(twdB_vRe, twdB_vRe), twdB_vIm, twdB_vIm);
+            twdC_vIm = vmulq_f32(vaddq_f32(twdB_vRe, twdB_vRe), twdB_vIm);
+            twdD_vRe = vmlsq_f32(vmulq_f32(twdC_vRe, twdB_vRe), twdC_vIm, twdB_vIm);
+            twdD_vIm = vmlaq_f32(vmulq_f32(twdC_vRe, twdB_vIm), twdC_vIm, twdB_vRe);
+#else
             twdC_vRe = vld1q_f32(twd+16u);
             twdC_vIm = vld1q_f32(twd+24u);
             twdD_vRe = vld1q_f32(twd+32u);
             twdD_vIm = vld1q_f32(twd+40u);
+#endif
 
             re_v0 = vld1q_f32(aRe);
             re_v1 = vld1q_f32(bRe);
@@ -375,7 +390,7 @@ static void MC_FUNC_TEMPLATE(MC_FFT_DIRECTION, dit_rad4_mono_loop, neon)(float *
             bIm += 4u;
             cIm += 4u;
             dIm += 4u;
-            twd += 44u;
+            twd += (MC_TWIDDLE_BLOCK_SIZE-4u);
         }
         aRe += 3u*qStep;
         aIm += 3u*qStep;
@@ -564,10 +579,18 @@ static void MC_FUNC_TEMPLATE(MC_FFT_DIRECTION, dif_rad4_mono_loop, neon)(float *
         for (uint32_t i = 0; i < qStep; i += 8u) {
             float32x4_t twdB_vRe = vld1q_f32(twd);
             float32x4_t twdB_vIm = vld1q_f32(twd+8u);
+#if MC_COMPACT_TWIDDLE
+            /* 2*angle & 3*angle are derived from angle */
+            float32x4_t twdC_vRe = vmlsq_f32(vmulq_f32(twdB_vRe, twdB_vRe), twdB_vIm, twdB_vIm);
+            float32x4_t twdC_vIm = vmulq_f32(vaddq_f32(twdB_vRe, twdB_vRe), twdB_vIm);
+            float32x4_t twdD_vRe = vmlsq_f32(vmulq_f32(twdC_vRe, twdB_vRe), twdC_vIm, twdB_vIm);
+            float32x4_t twdD_vIm = vmlaq_f32(vmulq_f32(twdC_vRe, twdB_vIm), twdC_vIm, twdB_vRe);
+#else
             float32x4_t twdC_vRe = vld1q_f32(twd+16u);
             float32x4_t twdC_vIm = vld1q_f32(twd+24u);
             float32x4_t twdD_vRe = vld1q_f32(twd+32u);
             float32x4_t twdD_vIm = vld1q_f32(twd+40u);
+#endif
 
             float32x4_t re_v0 = vld1q_f32(aRe);
             float32x4_t re_v1 = vld1q_f32(bRe);
@@ -638,10 +661,17 @@ static void MC_FUNC_TEMPLATE(MC_FFT_DIRECTION, dif_rad4_mono_loop, neon)(float *
 
             twdB_vRe = vld1q_f32(twd);
             twdB_vIm = vld1q_f32(twd+8u);
+#if MC_COMPACT_TWIDDLE
+            twdC_vRe = vmlsq_f32(vmulq_f32(twdB_vRe, twdB_vRe), twdB_vIm, twdB_vIm);
+            twdC_vIm = vmulq_f32(vaddq_f32(twdB_vRe, twdB_vRe), twdB_vIm);
+            twdD_vRe = vmlsq_f32(vmulq_f32(twdC_vRe, twdB_vRe), twdC_vIm, twdB_vIm);
+            twdD_vIm = vmlaq_f32(vmulq_f32(twdC_vRe, twdB_vIm), twdC_vIm, twdB_vRe);
+#else
             twdC_vRe = vld1q_f32(twd+16u);
             twdC_vIm = vld1q_f32(twd+24u);
             twdD_vRe = vld1q_f32(twd+32u);
             twdD_vIm = vld1q_f32(twd+40u);
+#endif
 
             re_v0 = vld1q_f32(aRe);
             re_v1 = vld1q_f32(bRe);
@@ -708,7 +738,7 @@ static void MC_FUNC_TEMPLATE(MC_FFT_DIRECTION, dif_rad4_mono_loop, neon)(float *
             bIm += 4u;
             cIm += 4u;
             dIm += 4u;
-            twd += 44u;
+            twd += (MC_TWIDDLE_BLOCK_SIZE-4u);
         }
         aRe += 3u*qStep;
         aIm += 3u*qStep;
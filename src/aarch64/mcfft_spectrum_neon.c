@@ -0,0 +1,274 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <arm_neon.h>
+#include "mcfft_neon.h"
+#include "generic/mcfft_generic.h"
+#include <float.h>
+
+void mc_spectrum_mul_neon(float * restrict re, float * restrict im, 
+                          const float * restrict hRe, const float * restrict hIm, uint32_t length) {
+    for (uint32_t i = 0; i < length; i += 4u) {
+        float32x4_t re_v = vld1q_f32(&re[i]);
+        float32x4_t im_v = vld1q_f32(&im[i]);
+        float32x4_t hRe_v = vld1q_f32(&hRe[i]);
+        float32x4_t hIm_v = vld1q_f32(&hIm[i]);
+        float32x4_t accRe_v = vmlsq_f32(vmulq_f32(re_v, hRe_v), im_v, hIm_v);
+        float32x4_t accIm_v = vmlaq_f32(vmulq_f32(re_v, hIm_v), im_v, hRe_v);
+        vst1q_f32(&re[i], accRe_v);
+        vst1q_f32(&im[i], accIm_v);
+    }
+}
+
+void mc_spectrum_mac_neon(float * restrict accRe, float * restrict accIm, const float * restrict re, const float * restrict im, 
+                          const float * restrict hRe, const float * restrict hIm, uint32_t length) {
+    for (uint32_t i = 0; i < length; i += 4u) {
+        float32x4_t re_v = vld1q_f32(&re[i]);
+        float32x4_t im_v = vld1q_f32(&im[i]);
+        float32x4_t hRe_v = vld1q_f32(&hRe[i]);
+        float32x4_t hIm_v = vld1q_f32(&hIm[i]);
+        float32x4_t accRe_v = vmlaq_f32(vld1q_f32(&accRe[i]), re_v, hRe_v);
+        float32x4_t accIm_v = vmlaq_f32(vld1q_f32(&accIm[i]), re_v, hIm_v);
+        accRe_v = vmlsq_f32(accRe_v, im_v, hIm_v);
+        accIm_v = vmlaq_f32(accIm_v, im_v, hRe_v);
+        vst1q_f32(&accRe[i], accRe_v);
+        vst1q_f32(&accIm[i], accIm_v);
+    }
+}
+
+void mc_spectrum_xcorr_neon(float * restrict cRe, float * restrict cIm, const float * restrict zRe, const float * restrict zIm,
+                            const uint16_t * restrict mirror, uint32_t length, uint32_t isPhat, float scale) {
+    const float32x4_t eps_v = vdupq_n_f32(MC_SPECTRUM_PHAT_EPSILON);
+    for (uint32_t i = 0; i < length; i += 4u) {
+        /** NOTE: no gather in NEON */
+        float32x4_t mRe_v = {zRe[mirror[i]], zRe[mirror[i+1u]], zRe[mirror[i+2u]], zRe[mirror[i+3u]]};
+        float32x4_t mIm_v = {zIm[mirror[i]], zIm[mirror[i+1u]], zIm[mirror[i+2u]], zIm[mirror[i+3u]]};
+        float32x4_t re_v = vld1q_f32(&zRe[i]);
+        float32x4_t im_v = vld1q_f32(&zIm[i]);
+        float32x4_t accRe_v = vmulq_n_f32(vmlaq_f32(vmulq_f32(re_v, mIm_v), im_v, mRe_v), 0.5f);
+        float32x4_t pow_v = vmlaq_f32(vmulq_f32(re_v, re_v), im_v, im_v);
+        float32x4_t mPow_v = vmlaq_f32(vmulq_f32(mRe_v, mRe_v), mIm_v, mIm_v);
+        float32x4_t accIm_v = vmulq_n_f32(vsubq_f32(pow_v, mPow_v), 0.25f);
+        float32x4_t gain_v = vdupq_n_f32(scale);
+        if (isPhat) {
+            /** rsqrt estimate + one Newton-Raphson step */
+            float32x4_t mag2_v = vmlaq_f32(vmlaq_f32(eps_v, accRe_v, accRe_v), accIm_v, accIm_v);
+            float32x4_t y_v = vrsqrteq_f32(mag2_v);
+            y_v = vmulq_f32(y_v, vrsqrtsq_f32(vmulq_f32(mag2_v, y_v), y_v));
+            gain_v = vmulq_f32(gain_v, y_v);
+        }
+        vst1q_f32(&cRe[i], vmulq_f32(accRe_v, gain_v));
+        vst1q_f32(&cIm[i], vmulq_f32(accIm_v, gain_v));
+    }
+}
+
+uint32_t mc_max_index_neon(const float * restrict values, uint32_t length, float *maxValue) {
+    uint32_t i = 0;
+    float maxScalar = values[0];
+    if (length >= 4u) {
+        float32x4_t max_v = vld1q_f32(values);
+        for (i = 4u; (i + 4u) <= length; i += 4u) {
+            max_v = vmaxq_f32(max_v, vld1q_f32(&values[i]));
+        }
+        maxScalar = vmaxvq_f32(max_v);
+    }
+    for (; i < length; ++i) {
+        maxScalar = (values[i] > maxScalar) ? values[i] : maxScalar;
+    }
+    /** The first index of max value (NOTE: NaNs are not supported) */
+    for (i = 0; (i < length) && (values[i] != maxScalar); ++i) {}
+    *maxValue = maxScalar;
+    return i;
+}
+
+static inline float32x4_t st_spectrum_log_power_neon(float32x4_t power_v) {
+    /** x = 2^e * m, m in [sqrt(0.5), sqrt(2)): ln(m) = 2*atanh(t), t = (m-1)/(m+1) (see mcfft_spectrum_generic.c) */
+    const float32x4_t one_v = vdupq_n_f32(1.f);
+    int32x4_t bits_v = vreinterpretq_s32_f32(vmaxq_f32(power_v, vdupq_n_f32(MC_SPECTRUM_POWER_FLOOR)));
+    int32x4_t e_v = vsubq_s32(bits_v, vdupq_n_s32((int32_t)MC_SPECTRUM_SQRT_HALF_BITS));
+    uint32x4_t eBits_v = vandq_u32(vreinterpretq_u32_s32(e_v), vdupq_n_u32(0xFF800000u));
+    float32x4_t m_v = vreinterpretq_f32_s32(vsubq_s32(bits_v, vreinterpretq_s32_u32(eBits_v)));
+    float32x4_t t_v = vdivq_f32(vsubq_f32(m_v, one_v), vaddq_f32(m_v, one_v));
+    float32x4_t t2_v = vmulq_f32(t_v, t_v);
+    float32x4_t poly_v = vfmaq_f32(vdupq_n_f32(1.f/5.f), t2_v, vdupq_n_f32(1.f/7.f));
+    poly_v = vfmaq_f32(vdupq_n_f32(1.f/3.f), t2_v, poly_v);
+    poly_v = vfmaq_f32(one_v, t2_v, poly_v);
+    float32x4_t lnm_v = vmulq_f32(vaddq_f32(t_v, t_v), poly_v);
+    float32x4_t ln_v = vfmaq_f32(lnm_v, vcvtq_f32_s32(vshrq_n_s32(e_v, 23)), vdupq_n_f32(MC_SPECTRUM_LN2));
+    return vmulq_n_f32(ln_v, MC_SPECTRUM_DB_PER_LN);
+}
+
+static inline float32x4_t st_spectrum_phase_neon(float32x4_t re_v, float32x4_t im_v) {
+    float32x4_t absRe_v = vabsq_f32(re_v);
+    float32x4_t absIm_v = vabsq_f32(im_v);
+    float32x4_t a_v = vdivq_f32(vminq_f32(absRe_v, absIm_v), vaddq_f32(vmaxq_f32(absRe_v, absIm_v), vdupq_n_f32(FLT_MIN)));
+    float32x4_t s_v = vmulq_f32(a_v, a_v);
+    float32x4_t phase_v = vfmaq_f32(vdupq_n_f32(MC_SPECTRUM_ATAN_C9), s_v, vdupq_n_f32(MC_SPECTRUM_ATAN_C11));
+    phase_v = vfmaq_f32(vdupq_n_f32(MC_SPECTRUM_ATAN_C7), s_v, phase_v);
+    phase_v = vfmaq_f32(vdupq_n_f32(MC_SPECTRUM_ATAN_C5), s_v, phase_v);
+    phase_v = vfmaq_f32(vdupq_n_f32(MC_SPECTRUM_ATAN_C3), s_v, phase_v);
+    phase_v = vfmaq_f32(vdupq_n_f32(MC_SPECTRUM_ATAN_C1), s_v, phase_v);
+    phase_v = vmulq_f32(a_v, phase_v);
+    phase_v = vbslq_f32(vcgtq_f32(absIm_v, absRe_v), vsubq_f32(vdupq_n_f32(MC_SPECTRUM_HALF_PI), phase_v), phase_v);
+    /** Sign bits (including -0) are used as in atan2() */
+    uint32x4_t reNeg_v = vreinterpretq_u32_s32(vshrq_n_s32(vreinterpretq_s32_f32(re_v), 31));
+    phase_v = vbslq_f32(reNeg_v, vsubq_f32(vdupq_n_f32(MC_SPECTRUM_PI), phase_v), phase_v);
+    uint32x4_t sign_v = vandq_u32(vreinterpretq_u32_f32(im_v), vdupq_n_u32(0x80000000u));
+    return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(phase_v), sign_v));
+}
+
+void mc_spectrum_power_neon(float * restrict out, const float * restrict re, const float * restrict im, uint32_t length) {
+    uint32_t i = 0;
+    for (; (i + 4u) <= length; i += 4u) {
+        float32x4_t re_v = vld1q_f32(&re[i]);
+        float32x4_t im_v = vld1q_f32(&im[i]);
+        vst1q_f32(&out[i], vmlaq_f32(vmulq_f32(re_v, re_v), im_v, im_v));
+    }
+    mc_spectrum_power_g(&out[i], &re[i], &im[i], length - i);
+}
+
+void mc_spectrum_dot_neon(float *outRe, float *outIm, const float * restrict re, const float * restrict im, 
+                          const float * restrict hRe, const float * restrict hIm, uint32_t length) {
+    float32x4_t accRe_v = vdupq_n_f32(0.f);
+    float32x4_t accIm_v = vdupq_n_f32(0.f);
+    uint32_t i = 0;
+    for (; (i + 4u) <= length; i += 4u) {
+        float32x4_t re_v = vld1q_f32(&re[i]);
+        float32x4_t im_v = vld1q_f32(&im[i]);
+        float32x4_t hRe_v = vld1q_f32(&hRe[i]);
+        float32x4_t hIm_v = vld1q_f32(&hIm[i]);
+        accRe_v = vmlaq_f32(accRe_v, re_v, hRe_v);
+        accRe_v = vmlsq_f32(accRe_v, im_v, hIm_v);
+        accIm_v = vmlaq_f32(accIm_v, re_v, hIm_v);
+        accIm_v = vmlaq_f32(accIm_v, im_v, hRe_v);
+    }
+    float tailRe, tailIm;
+    mc_spectrum_dot_g(&tailRe, &tailIm, &re[i], &im[i], &hRe[i], &hIm[i], length - i);
+    *outRe = vaddvq_f32(accRe_v) + tailRe;
+    *outIm = vaddvq_f32(accIm_v) + tailIm;
+}
+
+void mc_spectrum_power_acc_neon(float * restrict acc, const float * restrict re, const float * restrict im, uint32_t length) {
+    uint32_t i = 0;
+    for (; (i + 4u) <= length; i += 4u) {
+        float32x4_t re_v = vld1q_f32(&re[i]);
+        float32x4_t im_v = vld1q_f32(&im[i]);
+        float32x4_t acc_v = vmlaq_f32(vld1q_f32(&acc[i]), re_v, re_v);
+        vst1q_f32(&acc[i], vmlaq_f32(acc_v, im_v, im_v));
+    }
+    mc_spectrum_power_acc_g(&acc[i], &re[i], &im[i], length - i);
+}
+
+void mc_spectrum_magnitude_neon(float * restrict out, const float * restrict re, const float * restrict im, uint32_t length) {
+    uint32_t i = 0;
+    for (; (i + 4u) <= length; i += 4u) {
+        float32x4_t re_v = vld1q_f32(&re[i]);
+        float32x4_t im_v = vld1q_f32(&im[i]);
+        vst1q_f32(&out[i], vsqrtq_f32(vmlaq_f32(vmulq_f32(re_v, re_v), im_v, im_v)));
+    }
+    mc_spectrum_magnitude_g(&out[i], &re[i], &im[i], length - i);
+}
+
+void mc_spectrum_log_power_neon(float * restrict out, const float * restrict re, const float * restrict im, uint32_t length) {
+    uint32_t i = 0;
+    for (; (i + 4u) <= length; i += 4u) {
+        float32x4_t re_v = vld1q_f32(&re[i]);
+        float32x4_t im_v = vld1q_f32(&im[i]);
+        vst1q_f32(&out[i], st_spectrum_log_power_neon(vmlaq_f32(vmulq_f32(re_v, re_v), im_v, im_v)));
+    }
+    mc_spectrum_log_power_g(&out[i], &re[i], &im[i], length - i);
+}
+
+void mc_spectrum_phase_neon(float * restrict out, const float * restrict re, const float * restrict im, uint32_t length) {
+    uint32_t i = 0;
+    for (; (i + 4u) <= length; i += 4u) {
+        vst1q_f32(&out[i], st_spectrum_phase_neon(vld1q_f32(&re[i]), vld1q_f32(&im[i])));
+    }
+    mc_spectrum_phase_g(&out[i], &re[i], &im[i], length - i);
+}
+
+void mc_shuffle_power_neon(float * restrict out, const float * restrict re, const float * restrict im, 
+                           const uint16_t * restrict digitRev, uint32_t length) {
+    for (uint32_t i = 0; i < length; i += 4u) {
+        /** NOTE: no gather in NEON */
+        float32x4_t re_v = {re[digitRev[i]], re[digitRev[i+1u]], re[digitRev[i+2u]], re[digitRev[i+3u]]};
+        float32x4_t im_v = {im[digitRev[i]], im[digitRev[i+1u]], im[digitRev[i+2u]], im[digitRev[i+3u]]};
+        vst1q_f32(&out[i], vmlaq_f32(vmulq_f32(re_v, re_v), im_v, im_v));
+    }
+}
+
+void mc_spectrum_sdft_rotate_neon(float * restrict re, float * restrict im, const float * restrict wRe, const float * restrict wIm, 
+                                  float delta, uint32_t length) {
+    const float32x4_t delta_v = vdupq_n_f32(delta);
+    uint32_t i = 0;
+    for (; (i + 4u) <= length; i += 4u) {
+        float32x4_t re_v = vaddq_f32(vld1q_f32(&re[i]), delta_v);
+        float32x4_t im_v = vld1q_f32(&im[i]);
+        float32x4_t wRe_v = vld1q_f32(&wRe[i]);
+        float32x4_t wIm_v = vld1q_f32(&wIm[i]);
+        vst1q_f32(&re[i], vmlaq_f32(vmulq_f32(re_v, wRe_v), im_v, wIm_v));
+        vst1q_f32(&im[i], vmlsq_f32(vmulq_f32(im_v, wRe_v), re_v, wIm_v));
+    }
+    mc_spectrum_sdft_rotate_g(&re[i], &im[i], &wRe[i], &wIm[i], delta, length - i);
+}
+
+void mc_spectrum_sdft_modulate_neon(float * restrict re, float * restrict im, const float * restrict wRe, const float * restrict wIm, 
+                                    float delta, uint32_t first, uint32_t step, uint32_t mask, uint32_t length) {
+    const float32x4_t delta_v = vdupq_n_f32(delta);
+    uint32_t idx = first;
+    uint32_t i = 0;
+    for (; (i + 4u) <= length; i += 4u) {
+        /** NOTE: no gather in NEON */
+        const uint32_t idx1 = (idx + step) & mask;
+        const uint32_t idx2 = (idx1 + step) & mask;
+        const uint32_t idx3 = (idx2 + step) & mask;
+        float32x4_t wRe_v = {wRe[idx], wRe[idx1], wRe[idx2], wRe[idx3]};
+        float32x4_t wIm_v = {wIm[idx], wIm[idx1], wIm[idx2], wIm[idx3]};
+        vst1q_f32(&re[i], vmlaq_f32(vld1q_f32(&re[i]), delta_v, wRe_v));
+        vst1q_f32(&im[i], vmlaq_f32(vld1q_f32(&im[i]), delta_v, wIm_v));
+        idx = (idx3 + step) & mask;
+    }
+    mc_spectrum_sdft_modulate_g(&re[i], &im[i], wRe, wIm, delta, idx, step, mask, length - i);
+}
+
+void mc_spectrum_sdft_demodulate_neon(float * restrict outRe, float * restrict outIm, const float * restrict re, const float * restrict im, 
+                                      const float * restrict wRe, const float * restrict wIm, 
+                                      uint32_t first, uint32_t step, uint32_t mask, uint32_t length) {
+    uint32_t idx = first;
+    uint32_t i = 0;
+    for (; (i + 4u) <= length; i += 4u) {
+        /** NOTE: no gather in NEON */
+        const uint32_t idx1 = (idx + step) & mask;
+        const uint32_t idx2 = (idx1 + step) & mask;
+        const uint32_t idx3 = (idx2 + step) & mask;
+        float32x4_t wRe_v = {wRe[idx], wRe[idx1], wRe[idx2], wRe[idx3]};
+        float32x4_t wIm_v = {wIm[idx], wIm[idx1], wIm[idx2], wIm[idx3]};
+        float32x4_t re_v = vld1q_f32(&re[i]);
+        float32x4_t im_v = vld1q_f32(&im[i]);
+        vst1q_f32(&outRe[i], vmlaq_f32(vmulq_f32(re_v, wRe_v), im_v, wIm_v));
+        vst1q_f32(&outIm[i], vmlsq_f32(vmulq_f32(im_v, wRe_v), re_v, wIm_v));
+        idx = (idx3 + step) & mask;
+    }
+    mc_spectrum_sdft_demodulate_g(&outRe[i], &outIm[i], &re[i], &im[i], wRe, wIm, idx, step, mask, length - i);
+}
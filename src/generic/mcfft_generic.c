@@ -23,6 +23,7 @@
  */
 
 #include "mcfft_generic.h"
+#include <stdio.h>
 #define MC_FFT_DIRECTION fft
 #define MC_INVERSE_FFT (0)
 #include "mcfft_rad4_template.c"
@@ -45,6 +46,186 @@ void mc_shuffle_mono_g(float * restrict re, float * restrict im, float * restric
     memcpy(im, im_tmp, length*sizeof(float));
 }
 
+void mc_shuffle_scatter_mono_g(float * restrict re, float * restrict im, float * restrict buffer, 
+                               const uint16_t * restrict digitRev,  uint32_t length) {
+    float * restrict re_tmp = buffer;
+    float * restrict im_tmp = &buffer[length];
+    /** NOTE: digitRev must be inverse map of the one used by gather version (mc_shuffle_mono_g) */
+    for (uint32_t i = 0; i < length; ++i) {
+        re_tmp[digitRev[i]] = re[i];
+        im_tmp[digitRev[i]] = im[i];
+    }
+    memcpy(re, re_tmp, length*sizeof(float));
+    memcpy(im, im_tmp, length*sizeof(float));
+}
+
+void mc_transpose_tile_g(float * restrict out, const float * restrict in, uint32_t inStride, uint32_t outStride, uint32_t rows) {
+    /** out[c*outStride + r] = in[r*inStride + c], 8 columns */
+    for (uint32_t r = 0; r < rows; ++r) {
+        for (uint32_t c = 0; c < 8u; ++c) {
+            out[c*outStride + r] = in[r*inStride + c];
+        }
+    }
+}
+
+void mc_fft_columns_g(float * restrict re, float * restrict im, const float * restrict twiddle, 
+                      const uint16_t * restrict bitRev, uint32_t stride, uint32_t pow2, uint32_t columns) {
+    /** DIF over rows: row of tile is vector, twiddle W_H^k (k < H, Re then Im) is shared by row
+     *  Radix-4 stages (two radix-2 stages per pass), radix-2 stage without twiddle if pow2 is odd */
+    const uint32_t length = 1u<<pow2;
+    const float *twIm = &twiddle[length];
+    uint32_t quarter = length>>2u;
+    for (uint32_t twStep = 1u; quarter > 0; quarter >>= 2u, twStep <<= 2u) {
+        for (uint32_t start = 0; start < length; start += 4u*quarter) {
+            for (uint32_t j = 0; j < quarter; ++j) {
+                const float w1Re = twiddle[j*twStep], w1Im = twIm[j*twStep];
+                const float w2Re = twiddle[2u*j*twStep], w2Im = twIm[2u*j*twStep];
+                const float w3Re = twiddle[3u*j*twStep], w3Im = twIm[3u*j*twStep];
+                float * restrict aRe = &re[(start + j)*stride];
+                float * restrict aIm = &im[(start + j)*stride];
+                float * restrict bRe = &re[(start + j + quarter)*stride];
+                float * restrict bIm = &im[(start + j + quarter)*stride];
+                float * restrict cRe = &re[(start + j + 2u*quarter)*stride];
+                float * restrict cIm = &im[(start + j + 2u*quarter)*stride];
+                float * restrict dRe = &re[(start + j + 3u*quarter)*stride];
+                float * restrict dIm = &im[(start + j + 3u*quarter)*stride];
+                for (uint32_t c = 0; c < columns; ++c) {
+                    const float s0Re = aRe[c] + cRe[c], s0Im = aIm[c] + cIm[c];
+                    const float d0Re = aRe[c] - cRe[c], d0Im = aIm[c] - cIm[c];
+                    const float s1Re = bRe[c] + dRe[c], s1Im = bIm[c] + dIm[c];
+                    const float d1Re = bRe[c] - dRe[c], d1Im = bIm[c] - dIm[c];
+                    /** y1 = d0 - j*d1, y3 = d0 + j*d1 */
+                    const float y2Re = s0Re - s1Re, y2Im = s0Im - s1Im;
+                    const float y1Re = d0Re + d1Im, y1Im = d0Im - d1Re;
+                    const float y3Re = d0Re - d1Im, y3Im = d0Im + d1Re;
+                    aRe[c] = s0Re + s1Re;
+                    aIm[c] = s0Im + s1Im;
+                    bRe[c] = y2Re*w2Re - y2Im*w2Im;
+                    bIm[c] = y2Re*w2Im + y2Im*w2Re;
+                    cRe[c] = y1Re*w1Re - y1Im*w1Im;
+                    cIm[c] = y1Re*w1Im + y1Im*w1Re;
+                    dRe[c] = y3Re*w3Re - y3Im*w3Im;
+                    dIm[c] = y3Re*w3Im + y3Im*w3Re;
+                }
+            }
+        }
+    }
+    if (pow2 & 1u) {
+        for (uint32_t start = 0; start < length; start += 2u) {
+            float * restrict aRe = &re[start*stride];
+            float * restrict aIm = &im[start*stride];
+            float * restrict bRe = &re[(start + 1u)*stride];
+            float * restrict bIm = &im[(start + 1u)*stride];
+            for (uint32_t c = 0; c < columns; ++c) {
+                const float dRe = aRe[c] - bRe[c];
+                const float dIm = aIm[c] - bIm[c];
+                aRe[c] += bRe[c];
+                aIm[c] += bIm[c];
+                bRe[c] = dRe;
+                bIm[c] = dIm;
+            }
+        }
+    }
+    /** Bit reverse of rows */
+    for (uint32_t i = 0; i < length; ++i) {
+        const uint32_t j = bitRev[i];
+        if (i < j) {
+            for (uint32_t c = 0; c < columns; ++c) {
+                float tmp = re[i*stride + c];
+                re[i*stride + c] = re[j*stride + c];
+                re[j*stride + c] = tmp;
+                tmp = im[i*stride + c];
+                im[i*stride + c] = im[j*stride + c];
+                im[j*stride + c] = tmp;
+            }
+        }
+    }
+}
+
+void mc_gather_signed_g(float * restrict out, const float * restrict in, const uint16_t * restrict index, uint32_t length) {
+    /** out[i] = +/-in[index[i]], MSB of index negates value */
+    for (uint32_t i = 0; i < length; ++i) {
+        const float value = in[index[i] & (MC_GATHER_NEGATE - 1u)];
+        out[i] = (index[i] & MC_GATHER_NEGATE) ? -value : value;
+    }
+}
+
+void mc_mdct_fold_g(float * restrict re, float * restrict im, const float * restrict in, const float * restrict coeff, 
+                    const uint32_t * restrict offset, uint32_t length) {
+    /** Windowed fold of 4 strided streams (forward/reversed, step 2) and pre-rotation:
+     *  coeff = {c0, c1, c2, c3, rotRe, rotIm} (length values each), offset = {f0, r1, f2, r3} */
+    const float *c = coeff;
+    const float *rotRe = &coeff[4u*length];
+    const float *rotIm = &coeff[5u*length];
+    for (uint32_t m = 0; m < length; ++m) {
+        const float tRe = c[m]*in[offset[0] + 2u*m] + c[length + m]*in[offset[1] - 2u*m];
+        const float tIm = c[2u*length + m]*in[offset[2] + 2u*m] + c[3u*length + m]*in[offset[3] - 2u*m];
+        re[m] = tRe*rotRe[m] - tIm*rotIm[m];
+        im[m] = tRe*rotIm[m] + tIm*rotRe[m];
+    }
+}
+
+void mc_mdct_unfold_g(float * restrict out, const float * restrict re, const float * restrict im, 
+                      const float * restrict rotation, uint32_t length) {
+    /** Y = Z*rotation: out[2k] = Re(Y[k]), out[2k+1] = -Im(Y[length-1-k]) */
+    const float *rotIm = &rotation[length];
+    for (uint32_t k = 0; k < length; ++k) {
+        const uint32_t j = length - 1u - k;
+        out[2u*k] = re[k]*rotation[k] - im[k]*rotIm[k];
+        out[2u*k + 1u] = -(re[j]*rotIm[j] + im[j]*rotation[j]);
+    }
+}
+
+void mc_mdct_overlap_g(float * restrict out, float * restrict overlap, const float * restrict in, 
+                       const float * restrict window, uint32_t length) {
+    /** TDAC: out = overlap + window*(the first half), overlap = window*(the second half) */
+    for (uint32_t i = 0; i < length; ++i) {
+        out[i] = overlap[i] + window[i]*in[i];
+        overlap[i] = window[length + i]*in[length + i];
+    }
+}
+
+void mc_polyphase_mac_g(float * restrict outRe, float * restrict outIm, const float * restrict re, const float * restrict im, 
+                        const float * restrict coeff, uint32_t stride, uint32_t length, uint32_t taps) {
+    /** out[k] = sum(coeff[p*stride + k]*in[p*stride + k], p = 0..taps-1) */
+    for (uint32_t k = 0; k < length; ++k) {
+        float accRe = 0;
+        float accIm = 0;
+        for (uint32_t p = 0; p < taps; ++p) {
+            accRe += coeff[p*stride + k]*re[p*stride + k];
+            accIm += coeff[p*stride + k]*im[p*stride + k];
+        }
+        outRe[k] = accRe;
+        outIm[k] = accIm;
+    }
+}
+
+void mc_goertzel_g(float * restrict outRe, float * restrict outIm, const float * restrict in, 
+                   const float * restrict coeff, uint32_t length, uint32_t bins) {
+    /** s[n] = x[n] + 2cos(w)*s[n-1] - s[n-2], X = exp(jw)*s[N-1] - s[N-2] (w = 2*pi*k/N), coeff = {cos(w), sin(w)} */
+    const float *sinW = &coeff[bins];
+    for (uint32_t b = 0; b < bins; ++b) {
+        const float c2 = 2.f*coeff[b];
+        float s1 = 0;
+        float s2 = 0;
+        for (uint32_t n = 0; n < length; ++n) {
+            const float s0 = in[n] + c2*s1 - s2;
+            s2 = s1;
+            s1 = s0;
+        }
+        outRe[b] = coeff[b]*s1 - s2;
+        outIm[b] = sinW[b]*s1;
+    }
+}
+
+void mc_shuffle_window_g(float * restrict out, const float * restrict ring, const float * restrict window, 
+                         const uint16_t * restrict digitRev, uint32_t offset, uint32_t ringMask, uint32_t length) {
+    /** Frame starts at ring[offset] and wraps around ring (length of ring is ringMask+1) */
+    for (uint32_t i = 0; i < length; ++i) {
+        out[i] = ring[(offset + digitRev[i]) & ringMask] * window[digitRev[i]];
+    }
+}
+
 void st_rad2_mono_depth1_g(float * restrict re, float * restrict im, uint32_t fftLength) {
     for (uint32_t stepIdx = 0; stepIdx < fftLength; stepIdx += 2u) {
         float accRe = re[stepIdx+1u];
@@ -73,6 +254,31 @@ void mc_fft_dif_mono_core_g(float * restrict re, float * restrict im, const floa
     }
 }
 
+void mc_fft_dif_mono_range_g(float * restrict re, float * restrict im, const float * restrict twiddle, uint32_t pow2,
+                              uint32_t firstStep, uint32_t lastStep) {
+    const uint32_t fftLength = 1u<<(pow2);
+    uint32_t step = fftLength;
+    /** Stages with step > firstStep are skipped along with their twiddle factors */
+    while ((step > firstStep) && (step > 16u)) {
+        twiddle += MC_TWIDDLE_STAGE_SIZE(step);
+        step >>= 2u;
+    }
+    while ((step > 16u) && (step > lastStep)) {
+        st_fft_dif_rad4_mono_loop_g(re, im, twiddle, fftLength, step);
+        twiddle += MC_TWIDDLE_STAGE_SIZE(step);
+        step >>= 2u;
+    }
+    if (0 == lastStep) {
+        if (pow2 % 2u) {
+            st_fft_dif_rad4_mono_depth2_odd_g(re, im, twiddle, fftLength);
+            st_rad2_mono_depth1_g(re, im, fftLength);
+        } else {
+            st_fft_dif_rad4_mono_depth2_g(re, im, twiddle, fftLength);
+            st_fft_rad4_mono_depth1_g(re, im, fftLength);
+        }
+    }
+}
+
 void mc_ifft_dif_mono_core_g(float * restrict re, float * restrict im, const float * restrict twiddle, uint32_t pow2) {
     const uint32_t fftLength = 1u<<(pow2);
     uint32_t step = fftLength;
@@ -140,6 +346,98 @@ void mc_ifft_dit_mono_core_g(float * restrict re, float * restrict im, const flo
     } while (step != fftLength);
 }
 
+void mc_fft_dif_multi_core_g(float **re, float **im, uint32_t channels, const float * restrict twiddle, uint32_t pow2) {
+    const uint32_t fftLength = 1u<<(pow2);
+    uint32_t step = fftLength;
+    do {
+        for (uint32_t ch = 0; ch < channels; ++ch) {
+            st_fft_dif_rad4_mono_loop_g(re[ch], im[ch], twiddle, fftLength, step);
+        }
+        twiddle += MC_TWIDDLE_STAGE_SIZE(step);
+        step >>= 2u;
+    } while (step > 16u);
+    for (uint32_t ch = 0; ch < channels; ++ch) {
+        if (pow2 % 2u) {
+            st_fft_dif_rad4_mono_depth2_odd_g(re[ch], im[ch], twiddle, fftLength);
+            st_rad2_mono_depth1_g(re[ch], im[ch], fftLength);
+        } else {
+            st_fft_dif_rad4_mono_depth2_g(re[ch], im[ch], twiddle, fftLength);
+            st_fft_rad4_mono_depth1_g(re[ch], im[ch], fftLength);
+        }
+    }
+}
+
+void mc_ifft_dif_multi_core_g(float **re, float **im, uint32_t channels, const float * restrict twiddle, uint32_t pow2) {
+    const uint32_t fftLength = 1u<<(pow2);
+    uint32_t step = fftLength;
+    do {
+        for (uint32_t ch = 0; ch < channels; ++ch) {
+            st_ifft_dif_rad4_mono_loop_g(re[ch], im[ch], twiddle, fftLength, step);
+        }
+        twiddle += MC_TWIDDLE_STAGE_SIZE(step);
+        step >>= 2u;
+    } while (step > 16u);
+    for (uint32_t ch = 0; ch < channels; ++ch) {
+        if (pow2 % 2u) {
+            st_ifft_dif_rad4_mono_depth2_odd_g(re[ch], im[ch], twiddle, fftLength);
+            st_rad2_mono_depth1_g(re[ch], im[ch], fftLength);
+        } else {
+            st_ifft_dif_rad4_mono_depth2_g(re[ch], im[ch], twiddle, fftLength);
+            st_ifft_rad4_mono_depth1_g(re[ch], im[ch], fftLength);
+        }
+    }
+}
+
+void mc_fft_dit_multi_core_g(float **re, float **im, uint32_t channels, const float * restrict twiddle, uint32_t pow2) {
+    const uint32_t fftLength = 1u<<(pow2);
+    uint32_t step = (pow2 % 2u) ? 8u : 16u;
+    /* Shift pointer of twiddle factor to the end, more twiddle factors first for better memory alignement */
+    twiddle += MC_TWIDDLE_LENGTH(pow2);
+    twiddle -= MC_TWIDDLE_STAGE_SIZE(step);
+    /** The first stages are short and have a few twiddle factors: channel by channel */
+    for (uint32_t ch = 0; ch < channels; ++ch) {
+        if (pow2 % 2u) {
+            st_rad2_mono_depth1_g(re[ch], im[ch], fftLength);
+            st_fft_dit_rad4_mono_depth2_odd_g(re[ch], im[ch], twiddle, fftLength);
+        } else {
+            st_fft_rad4_mono_depth1_g(re[ch], im[ch], fftLength);
+            st_fft_dit_rad4_mono_depth2_g(re[ch], im[ch], twiddle, fftLength);
+        }
+    }
+    do {
+        step <<= 2u;
+        twiddle -= MC_TWIDDLE_STAGE_SIZE(step);
+        for (uint32_t ch = 0; ch < channels; ++ch) {
+            st_fft_dit_rad4_mono_loop_g(re[ch], im[ch], twiddle, fftLength, step);
+        }
+    } while (step != fftLength);
+}
+
+void mc_ifft_dit_multi_core_g(float **re, float **im, uint32_t channels, const float * restrict twiddle, uint32_t pow2) {
+    const uint32_t fftLength = 1u<<(pow2);
+    uint32_t step = (pow2 % 2u) ? 8u : 16u;
+    /* Shift pointer of twiddle factor to the end, more twiddle factors first for better memory alignement */
+    twiddle += MC_TWIDDLE_LENGTH(pow2);
+    twiddle -= MC_TWIDDLE_STAGE_SIZE(step);
+    /** The first stages are short and have a few twiddle factors: channel by channel */
+    for (uint32_t ch = 0; ch < channels; ++ch) {
+        if (pow2 % 2u) {
+            st_rad2_mono_depth1_g(re[ch], im[ch], fftLength);
+            st_ifft_dit_rad4_mono_depth2_odd_g(re[ch], im[ch], twiddle, fftLength);
+        } else {
+            st_ifft_rad4_mono_depth1_g(re[ch], im[ch], fftLength);
+            st_ifft_dit_rad4_mono_depth2_g(re[ch], im[ch], twiddle, fftLength);
+        }
+    }
+    do {
+        step <<= 2u;
+        twiddle -= MC_TWIDDLE_STAGE_SIZE(step);
+        for (uint32_t ch = 0; ch < channels; ++ch) {
+            st_ifft_dit_rad4_mono_loop_g(re[ch], im[ch], twiddle, fftLength, step);
+        }
+    } while (step != fftLength);
+}
+
 #include <math.h>
 
 uint32_t mc_fft_rad4_get_twiddle_stage_g(float * restrict out, uint32_t step) {
@@ -183,6 +481,7 @@ uint32_t mc_fft_rad4_get_twiddle_stage_g(float * restrict out, uint32_t step) {
             for (uint32_t k = 0; k < 8u; ++k) {
                 *out++ = (float)sin(phi*(double)(i+k));
             }
+#if !MC_COMPACT_TWIDDLE
             for (uint32_t k = 0; k < 8u; ++k) {
                 *out++ = (float)cos(2.0*phi*(double)(i+k));
             }
@@ -195,10 +494,22 @@ uint32_t mc_fft_rad4_get_twiddle_stage_g(float * restrict out, uint32_t step) {
             for (uint32_t k = 0; k < 8u; ++k) {
                 *out++ = (float)sin(3.0*phi*(double)(i+k));
             }
+#endif
         }
-        res = 6u*(step>>2u);
+        res = MC_TWIDDLE_BLOCK_SIZE*(step>>5u);
     }
 
     return res;
 }
 
+void mc_get_cpu_id_g(char *out, uint32_t length) {
+    MC_NULLPTR_ASSERT(out);
+    /** NOTE: no portable way to get CPU model, generic build is identified by architecture only */
+#if defined(__x86_64__) || defined(_M_X64)
+    snprintf(out, length, "g:x86_64");
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    snprintf(out, length, "g:aarch64");
+#else
+    snprintf(out, length, "g:unknown");
+#endif
+}
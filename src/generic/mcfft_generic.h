@@ -32,13 +32,81 @@ extern "C" {
 
 #include "mcfft.h"
 
+/** Constants of fast log/atan approximations shared by all spectrum kernels (see mcfft_spectrum_*.c) */
+#define MC_SPECTRUM_SQRT_HALF_BITS (0x3F3504F3u)
+#define MC_SPECTRUM_LN2 (0.693147180559945f)
+#define MC_SPECTRUM_DB_PER_LN (4.342944819032518f)
+#define MC_SPECTRUM_PI (3.141592653589793f)
+#define MC_SPECTRUM_HALF_PI (1.570796326794897f)
+/** Minimax polynomial of atan(a), a in [0, 1]: max abs error 1.7E-6 rad */
+#define MC_SPECTRUM_ATAN_C1 (0.99997726f)
+#define MC_SPECTRUM_ATAN_C3 (-0.33262347f)
+#define MC_SPECTRUM_ATAN_C5 (0.19354346f)
+#define MC_SPECTRUM_ATAN_C7 (-0.11643287f)
+#define MC_SPECTRUM_ATAN_C9 (0.05265332f)
+#define MC_SPECTRUM_ATAN_C11 (-0.01172120f)
+
+/** Gather map (see mc_gather_signed_*()): MSB of index negates value */
+#define MC_GATHER_NEGATE (0x8000u)
+
 void mc_shuffle_mono_g(float * restrict re, float * restrict im, float * restrict buffer, 
                        const uint16_t * restrict digitRev,  uint32_t length);
+void mc_shuffle_scatter_mono_g(float * restrict re, float * restrict im, float * restrict buffer, 
+                               const uint16_t * restrict digitRev,  uint32_t length);
+void mc_transpose_tile_g(float * restrict out, const float * restrict in, uint32_t inStride, uint32_t outStride, uint32_t rows);
+void mc_fft_columns_g(float * restrict re, float * restrict im, const float * restrict twiddle, 
+                      const uint16_t * restrict bitRev, uint32_t stride, uint32_t pow2, uint32_t columns);
+void mc_gather_signed_g(float * restrict out, const float * restrict in, const uint16_t * restrict index, uint32_t length);
+void mc_mdct_fold_g(float * restrict re, float * restrict im, const float * restrict in, const float * restrict coeff, 
+                    const uint32_t * restrict offset, uint32_t length);
+void mc_mdct_unfold_g(float * restrict out, const float * restrict re, const float * restrict im, 
+                      const float * restrict rotation, uint32_t length);
+void mc_mdct_overlap_g(float * restrict out, float * restrict overlap, const float * restrict in, 
+                       const float * restrict window, uint32_t length);
+void mc_polyphase_mac_g(float * restrict outRe, float * restrict outIm, const float * restrict re, const float * restrict im, 
+                        const float * restrict coeff, uint32_t stride, uint32_t length, uint32_t taps);
+void mc_goertzel_g(float * restrict outRe, float * restrict outIm, const float * restrict in, 
+                   const float * restrict coeff, uint32_t length, uint32_t bins);
+void mc_shuffle_window_g(float * restrict out, const float * restrict ring, const float * restrict window, 
+                         const uint16_t * restrict digitRev, uint32_t offset, uint32_t ringMask, uint32_t length);
 void mc_fft_dif_mono_core_g(float * restrict re, float * restrict im, const float * restrict twiddle, uint32_t pow2);
+void mc_fft_dif_mono_range_g(float * restrict re, float * restrict im, const float * restrict twiddle, uint32_t pow2,
+                              uint32_t firstStep, uint32_t lastStep);
 void mc_ifft_dif_mono_core_g(float * restrict re, float * restrict im, const float * restrict twiddle, uint32_t pow2);
 void mc_fft_dit_mono_core_g(float * restrict re, float * restrict im, const float * restrict twiddle, uint32_t pow2);
 void mc_ifft_dit_mono_core_g(float * restrict re, float * restrict im, const float * restrict twiddle, uint32_t pow2);
+void mc_fft_dif_multi_core_g(float **re, float **im, uint32_t channels, const float * restrict twiddle, uint32_t pow2);
+void mc_ifft_dif_multi_core_g(float **re, float **im, uint32_t channels, const float * restrict twiddle, uint32_t pow2);
+void mc_fft_dit_multi_core_g(float **re, float **im, uint32_t channels, const float * restrict twiddle, uint32_t pow2);
+void mc_ifft_dit_multi_core_g(float **re, float **im, uint32_t channels, const float * restrict twiddle, uint32_t pow2);
 uint32_t mc_fft_rad4_get_twiddle_stage_g(float * restrict out, uint32_t step);
+void mc_get_cpu_id_g(char *out, uint32_t length);
+void mc_spectrum_mul_g(float * restrict re, float * restrict im, 
+                       const float * restrict hRe, const float * restrict hIm, uint32_t length);
+void mc_spectrum_mac_g(float * restrict accRe, float * restrict accIm, const float * restrict re, const float * restrict im, 
+                       const float * restrict hRe, const float * restrict hIm, uint32_t length);
+void mc_spectrum_split_dual_g(float * restrict aRe, float * restrict aIm, float * restrict bRe, float * restrict bIm,
+                              const float * restrict zRe, const float * restrict zIm, 
+                              const uint16_t * restrict mirror, uint32_t length);
+void mc_spectrum_xcorr_g(float * restrict cRe, float * restrict cIm, const float * restrict zRe, const float * restrict zIm,
+                         const uint16_t * restrict mirror, uint32_t length, uint32_t isPhat, float scale);
+uint32_t mc_max_index_g(const float * restrict values, uint32_t length, float *maxValue);
+void mc_spectrum_power_g(float * restrict out, const float * restrict re, const float * restrict im, uint32_t length);
+void mc_spectrum_dot_g(float *outRe, float *outIm, const float * restrict re, const float * restrict im, 
+                      const float * restrict hRe, const float * restrict hIm, uint32_t length);
+void mc_spectrum_power_acc_g(float * restrict acc, const float * restrict re, const float * restrict im, uint32_t length);
+void mc_spectrum_magnitude_g(float * restrict out, const float * restrict re, const float * restrict im, uint32_t length);
+void mc_spectrum_log_power_g(float * restrict out, const float * restrict re, const float * restrict im, uint32_t length);
+void mc_spectrum_phase_g(float * restrict out, const float * restrict re, const float * restrict im, uint32_t length);
+void mc_shuffle_power_g(float * restrict out, const float * restrict re, const float * restrict im, 
+                        const uint16_t * restrict digitRev, uint32_t length);
+void mc_spectrum_sdft_rotate_g(float * restrict re, float * restrict im, const float * restrict wRe, const float * restrict wIm, 
+                               float delta, uint32_t length);
+void mc_spectrum_sdft_modulate_g(float * restrict re, float * restrict im, const float * restrict wRe, const float * restrict wIm, 
+                                 float delta, uint32_t first, uint32_t step, uint32_t mask, uint32_t length);
+void mc_spectrum_sdft_demodulate_g(float * restrict outRe, float * restrict outIm, const float * restrict re, const float * restrict im, 
+                                   const float * restrict wRe, const float * restrict wIm, 
+                                   uint32_t first, uint32_t step, uint32_t mask, uint32_t length);
 
 #ifdef __cplusplus
 }
@@ -218,14 +218,23 @@ static void MC_FUNC_TEMPLATE(MC_FFT_DIRECTION, dif_rad4_mono_loop, g) (float * r
     float * restrict dRe = &re[3u*qStep];
     float * restrict dIm = &im[3u*qStep];
     for (uint32_t stepIdx = 0; stepIdx < fftLength; stepIdx += step) {
-        const float *twdB_re = twiddle;
-        const float *twdB_im = &twiddle[8u];
-        const float *twdC_re = &twiddle[16u];
-        const float *twdC_im = &twiddle[24u];
-        const float *twdD_re = &twiddle[32u];
-        const float *twdD_im = &twiddle[40u];
+        const float *twd = twiddle;
         for (uint32_t i = 0; i < qStep; i += 8u) {
             for (uint32_t j = 0; j < 8u; ++j) {
+                const float twdB_re = twd[j];
+                const float twdB_im = twd[8u+j];
+#if MC_COMPACT_TWIDDLE
+                /* 2*angle & 3*angle are derived from angle */
+                const float twdC_re = twdB_re*twdB_re - twdB_im*twdB_im;
+                const float twdC_im = 2.f*twdB_re*twdB_im;
+                const float twdD_re = twdC_re*twdB_re - twdC_im*twdB_im;
+                const float twdD_im = twdC_re*twdB_im + twdC_im*twdB_re;
+#else
+                const float twdC_re = twd[16u+j];
+                const float twdC_im = twd[24u+j];
+                const float twdD_re = twd[32u+j];
+                const float twdD_im = twd[40u+j];
+#endif
                 float t0_re = *aRe + *cRe;
                 float t0_im = *aIm + *cIm;
                 float t1_re = *aRe - *cRe;
@@ -245,32 +254,27 @@ static void MC_FUNC_TEMPLATE(MC_FFT_DIRECTION, dif_rad4_mono_loop, g) (float * r
                 float sumD_re = t1_re + t3_re;
                 float sumD_im = t1_im + t3_im;
 
-                *bRe++ = sumB_re * twdB_re[j] + sumB_im * twdB_im[j];
-                *bIm++ = sumB_im * twdB_re[j] - sumB_re * twdB_im[j];
-                *cRe++ = sumC_re * twdC_re[j] + sumC_im * twdC_im[j];
-                *cIm++ = sumC_im * twdC_re[j] - sumC_re * twdC_im[j];
-                *dRe++ = sumD_re * twdD_re[j] + sumD_im * twdD_im[j];
-                *dIm++ = sumD_im * twdD_re[j] - sumD_re * twdD_im[j];
+                *bRe++ = sumB_re * twdB_re + sumB_im * twdB_im;
+                *bIm++ = sumB_im * twdB_re - sumB_re * twdB_im;
+                *cRe++ = sumC_re * twdC_re + sumC_im * twdC_im;
+                *cIm++ = sumC_im * twdC_re - sumC_re * twdC_im;
+                *dRe++ = sumD_re * twdD_re + sumD_im * twdD_im;
+                *dIm++ = sumD_im * twdD_re - sumD_re * twdD_im;
 #else
                 float sumB_re = t1_re + t3_re;
                 float sumB_im = t1_im + t3_im;
                 float sumD_re = t1_re - t3_re;
                 float sumD_im = t1_im - t3_im;
 
-                *bRe++ = sumB_re * twdB_re[j] - sumB_im * twdB_im[j];
-                *bIm++ = sumB_im * twdB_re[j] + sumB_re * twdB_im[j];
-                *cRe++ = sumC_re * twdC_re[j] - sumC_im * twdC_im[j];
-                *cIm++ = sumC_im * twdC_re[j] + sumC_re * twdC_im[j];
-                *dRe++ = sumD_re * twdD_re[j] - sumD_im * twdD_im[j];
-                *dIm++ = sumD_im * twdD_re[j] + sumD_re * twdD_im[j];
+                *bRe++ = sumB_re * twdB_re - sumB_im * twdB_im;
+                *bIm++ = sumB_im * twdB_re + sumB_re * twdB_im;
+                *cRe++ = sumC_re * twdC_re - sumC_im * twdC_im;
+                *cIm++ = sumC_im * twdC_re + sumC_re * twdC_im;
+                *dRe++ = sumD_re * twdD_re - sumD_im * twdD_im;
+                *dIm++ = sumD_im * twdD_re + sumD_re * twdD_im;
 #endif
             }
-            twdB_re += 48u;
-            twdB_im += 48u;
-            twdC_re += 48u;
-            twdC_im += 48u;
-            twdD_re += 48u;
-            twdD_im += 48u;
+            twd += MC_TWIDDLE_BLOCK_SIZE;
         }
         aRe += 3u*qStep;
         aIm += 3u*qStep;
@@ -457,28 +461,37 @@ static void MC_FUNC_TEMPLATE(MC_FFT_DIRECTION, dit_rad4_mono_loop, g) (float * r
     float * restrict dRe = &re[3u*qStep];
     float * restrict dIm = &im[3u*qStep];
     for (uint32_t stepIdx = 0; stepIdx < fftLength; stepIdx += step) {
-        const float *twdB_re = twiddle;
-        const float *twdB_im = &twiddle[8u];
-        const float *twdC_re = &twiddle[16u];
-        const float *twdC_im = &twiddle[24u];
-        const float *twdD_re = &twiddle[32u];
-        const float *twdD_im = &twiddle[40u];
+        const float *twd = twiddle;
         for (uint32_t i = 0; i < qStep; i += 8u) {
             for (uint32_t j = 0; j < 8u; ++j) {
+                const float twdB_re = twd[j];
+                const float twdB_im = twd[8u+j];
+#if MC_COMPACT_TWIDDLE
+                /* 2*angle & 3*angle are derived from angle */
+                const float twdC_re = twdB_re*twdB_re - twdB_im*twdB_im;
+                const float twdC_im = 2.f*twdB_re*twdB_im;
+                const float twdD_re = twdC_re*twdB_re - twdC_im*twdB_im;
+                const float twdD_im = twdC_re*twdB_im + twdC_im*twdB_re;
+#else
+                const float twdC_re = twd[16u+j];
+                const float twdC_im = twd[24u+j];
+                const float twdD_re = twd[32u+j];
+                const float twdD_im = twd[40u+j];
+#endif
 #if MC_INVERSE_FFT
-                float acc0_re = *bRe * twdB_re[j] + *bIm * twdB_im[j];
-                float acc0_im = *bIm * twdB_re[j] - *bRe * twdB_im[j];
-                float acc1_re = *cRe * twdC_re[j] + *cIm * twdC_im[j];
-                float acc1_im = *cIm * twdC_re[j] - *cRe * twdC_im[j];
-                float acc2_re = *dRe * twdD_re[j] + *dIm * twdD_im[j];
-                float acc2_im = *dIm * twdD_re[j] - *dRe * twdD_im[j];
+                float acc0_re = *bRe * twdB_re + *bIm * twdB_im;
+                float acc0_im = *bIm * twdB_re - *bRe * twdB_im;
+                float acc1_re = *cRe * twdC_re + *cIm * twdC_im;
+                float acc1_im = *cIm * twdC_re - *cRe * twdC_im;
+                float acc2_re = *dRe * twdD_re + *dIm * twdD_im;
+                float acc2_im = *dIm * twdD_re - *dRe * twdD_im;
 #else
-                float acc0_re = *bRe * twdB_re[j] - *bIm * twdB_im[j];
-                float acc0_im = *bIm * twdB_re[j] + *bRe * twdB_im[j];
-                float acc1_re = *cRe * twdC_re[j] - *cIm * twdC_im[j];
-                float acc1_im = *cIm * twdC_re[j] + *cRe * twdC_im[j];
-                float acc2_re = *dRe * twdD_re[j] - *dIm * twdD_im[j];
-                float acc2_im = *dIm * twdD_re[j] + *dRe * twdD_im[j];
+                float acc0_re = *bRe * twdB_re - *bIm * twdB_im;
+                float acc0_im = *bIm * twdB_re + *bRe * twdB_im;
+                float acc1_re = *cRe * twdC_re - *cIm * twdC_im;
+                float acc1_im = *cIm * twdC_re + *cRe * twdC_im;
+                float acc2_re = *dRe * twdD_re - *dIm * twdD_im;
+                float acc2_im = *dIm * twdD_re + *dRe * twdD_im;
 #endif
                 float t0_re = *aRe + acc1_re;
                 float t0_im = *aIm + acc1_im;
@@ -508,12 +521,7 @@ static void MC_FUNC_TEMPLATE(MC_FFT_DIRECTION, dit_rad4_mono_loop, g) (float * r
                 *dIm++ = t1_im - t3_im;
 #endif
             }
-            twdB_re += 48u;
-            twdB_im += 48u;
-            twdC_re += 48u;
-            twdC_im += 48u;
-            twdD_re += 48u;
-            twdD_im += 48u;
+            twd += MC_TWIDDLE_BLOCK_SIZE;
         }
         aRe += 3u*qStep;
         aIm += 3u*qStep;
@@ -0,0 +1,200 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "mcfft_generic.h"
+#include <math.h>
+#include <float.h>
+
+void mc_spectrum_mul_g(float * restrict re, float * restrict im, 
+                       const float * restrict hRe, const float * restrict hIm, uint32_t length) {
+    for (uint32_t i = 0; i < length; ++i) {
+        float accRe = re[i]*hRe[i] - im[i]*hIm[i];
+        float accIm = re[i]*hIm[i] + im[i]*hRe[i];
+        re[i] = accRe;
+        im[i] = accIm;
+    }
+}
+
+void mc_spectrum_mac_g(float * restrict accRe, float * restrict accIm, const float * restrict re, const float * restrict im, 
+                       const float * restrict hRe, const float * restrict hIm, uint32_t length) {
+    for (uint32_t i = 0; i < length; ++i) {
+        accRe[i] += re[i]*hRe[i] - im[i]*hIm[i];
+        accIm[i] += re[i]*hIm[i] + im[i]*hRe[i];
+    }
+}
+
+void mc_spectrum_split_dual_g(float * restrict aRe, float * restrict aIm, float * restrict bRe, float * restrict bIm,
+                              const float * restrict zRe, const float * restrict zIm, 
+                              const uint16_t * restrict mirror, uint32_t length) {
+    /** Z = A + jB for real signals a/b: A[k] = (Z[k] + conj(Z[N-k]))/2, B[k] = (Z[k] - conj(Z[N-k]))/2j */
+    for (uint32_t i = 0; i < length; ++i) {
+        const float mRe = zRe[mirror[i]];
+        const float mIm = zIm[mirror[i]];
+        aRe[i] = 0.5f*(zRe[i] + mRe);
+        aIm[i] = 0.5f*(zIm[i] - mIm);
+        bRe[i] = 0.5f*(zIm[i] + mIm);
+        bIm[i] = 0.5f*(mRe - zRe[i]);
+    }
+}
+
+void mc_spectrum_xcorr_g(float * restrict cRe, float * restrict cIm, const float * restrict zRe, const float * restrict zIm,
+                         const uint16_t * restrict mirror, uint32_t length, uint32_t isPhat, float scale) {
+    /** Z = X + jY: X*conj(Y) = Im(Z[k]*Z[N-k])/2 + j(|Z[k]|^2 - |Z[N-k]|^2)/4 */
+    for (uint32_t i = 0; i < length; ++i) {
+        const float mRe = zRe[mirror[i]];
+        const float mIm = zIm[mirror[i]];
+        float accRe = 0.5f*(zRe[i]*mIm + zIm[i]*mRe);
+        float accIm = 0.25f*((zRe[i]*zRe[i] + zIm[i]*zIm[i]) - (mRe*mRe + mIm*mIm));
+        float gain = scale;
+        if (isPhat) {
+            gain *= 1.f / sqrtf(accRe*accRe + accIm*accIm + MC_SPECTRUM_PHAT_EPSILON);
+        }
+        cRe[i] = accRe*gain;
+        cIm[i] = accIm*gain;
+    }
+}
+
+uint32_t mc_max_index_g(const float * restrict values, uint32_t length, float *maxValue) {
+    uint32_t maxIndex = 0;
+    for (uint32_t i = 1u; i < length; ++i) {
+        maxIndex = (values[i] > values[maxIndex]) ? i : maxIndex;
+    }
+    *maxValue = values[maxIndex];
+    return maxIndex;
+}
+
+static inline float st_spectrum_log_power_g(float power) {
+    /** x = 2^e * m, m in [sqrt(0.5), sqrt(2)): ln(m) = 2*atanh(t), t = (m-1)/(m+1), |t| <= 0.1716 */
+    uint32_t bits, mBits;
+    float m;
+    power = (power > MC_SPECTRUM_POWER_FLOOR) ? power : MC_SPECTRUM_POWER_FLOOR;
+    memcpy(&bits, &power, sizeof(bits));
+    int32_t e = (int32_t)(bits - MC_SPECTRUM_SQRT_HALF_BITS);
+    mBits = bits - ((uint32_t)e & 0xFF800000u);
+    memcpy(&m, &mBits, sizeof(m));
+    const float t = (m - 1.f)/(m + 1.f);
+    const float t2 = t*t;
+    const float lnm = 2.f*t*(1.f + t2*(1.f/3.f + t2*(1.f/5.f + t2*(1.f/7.f))));
+    return MC_SPECTRUM_DB_PER_LN*((float)(e >> 23)*MC_SPECTRUM_LN2 + lnm);
+}
+
+static inline float st_spectrum_phase_g(float re, float im) {
+    const float absRe = fabsf(re);
+    const float absIm = fabsf(im);
+    const float maxAbs = (absRe > absIm) ? absRe : absIm;
+    const float minAbs = (absRe > absIm) ? absIm : absRe;
+    /** FLT_MIN keeps atan2(0, 0) == 0 */
+    const float a = minAbs / (maxAbs + FLT_MIN);
+    const float s = a*a;
+    float phase = a*(MC_SPECTRUM_ATAN_C1 + s*(MC_SPECTRUM_ATAN_C3 + s*(MC_SPECTRUM_ATAN_C5 + s*(MC_SPECTRUM_ATAN_C7 
+                     + s*(MC_SPECTRUM_ATAN_C9 + s*MC_SPECTRUM_ATAN_C11)))));
+    phase = (absIm > absRe) ? (MC_SPECTRUM_HALF_PI - phase) : phase;
+    /** Sign bits (including -0) are used as in atan2() */
+    phase = signbit(re) ? (MC_SPECTRUM_PI - phase) : phase;
+    return copysignf(phase, im);
+}
+
+void mc_spectrum_power_g(float * restrict out, const float * restrict re, const float * restrict im, uint32_t length) {
+    for (uint32_t i = 0; i < length; ++i) {
+        out[i] = re[i]*re[i] + im[i]*im[i];
+    }
+}
+
+void mc_spectrum_dot_g(float *outRe, float *outIm, const float * restrict re, const float * restrict im, 
+                       const float * restrict hRe, const float * restrict hIm, uint32_t length) {
+    float accRe = 0.f, accIm = 0.f;
+    for (uint32_t i = 0; i < length; ++i) {
+        accRe += re[i]*hRe[i] - im[i]*hIm[i];
+        accIm += re[i]*hIm[i] + im[i]*hRe[i];
+    }
+    *outRe = accRe;
+    *outIm = accIm;
+}
+
+void mc_spectrum_power_acc_g(float * restrict acc, const float * restrict re, const float * restrict im, uint32_t length) {
+    for (uint32_t i = 0; i < length; ++i) {
+        acc[i] += re[i]*re[i] + im[i]*im[i];
+    }
+}
+
+void mc_spectrum_magnitude_g(float * restrict out, const float * restrict re, const float * restrict im, uint32_t length) {
+    for (uint32_t i = 0; i < length; ++i) {
+        out[i] = sqrtf(re[i]*re[i] + im[i]*im[i]);
+    }
+}
+
+void mc_spectrum_log_power_g(float * restrict out, const float * restrict re, const float * restrict im, uint32_t length) {
+    for (uint32_t i = 0; i < length; ++i) {
+        out[i] = st_spectrum_log_power_g(re[i]*re[i] + im[i]*im[i]);
+    }
+}
+
+void mc_spectrum_phase_g(float * restrict out, const float * restrict re, const float * restrict im, uint32_t length) {
+    for (uint32_t i = 0; i < length; ++i) {
+        out[i] = st_spectrum_phase_g(re[i], im[i]);
+    }
+}
+
+void mc_shuffle_power_g(float * restrict out, const float * restrict re, const float * restrict im, 
+                        const uint16_t * restrict digitRev, uint32_t length) {
+    for (uint32_t i = 0; i < length; ++i) {
+        const float valRe = re[digitRev[i]];
+        const float valIm = im[digitRev[i]];
+        out[i] = valRe*valRe + valIm*valIm;
+    }
+}
+
+void mc_spectrum_sdft_rotate_g(float * restrict re, float * restrict im, const float * restrict wRe, const float * restrict wIm, 
+                               float delta, uint32_t length) {
+    /** (X + delta) * conj(W) */
+    for (uint32_t i = 0; i < length; ++i) {
+        const float valRe = re[i] + delta;
+        const float valIm = im[i];
+        re[i] = valRe*wRe[i] + valIm*wIm[i];
+        im[i] = valIm*wRe[i] - valRe*wIm[i];
+    }
+}
+
+void mc_spectrum_sdft_modulate_g(float * restrict re, float * restrict im, const float * restrict wRe, const float * restrict wIm, 
+                                 float delta, uint32_t first, uint32_t step, uint32_t mask, uint32_t length) {
+    /** S += delta * W[(first + i*step) & mask] */
+    uint32_t idx = first;
+    for (uint32_t i = 0; i < length; ++i) {
+        re[i] += delta*wRe[idx];
+        im[i] += delta*wIm[idx];
+        idx = (idx + step) & mask;
+    }
+}
+
+void mc_spectrum_sdft_demodulate_g(float * restrict outRe, float * restrict outIm, const float * restrict re, const float * restrict im, 
+                                   const float * restrict wRe, const float * restrict wIm, 
+                                   uint32_t first, uint32_t step, uint32_t mask, uint32_t length) {
+    /** X = S * conj(W[(first + i*step) & mask]) */
+    uint32_t idx = first;
+    for (uint32_t i = 0; i < length; ++i) {
+        outRe[i] = re[i]*wRe[idx] + im[i]*wIm[idx];
+        outIm[i] = im[i]*wRe[idx] - re[i]*wIm[idx];
+        idx = (idx + step) & mask;
+    }
+}
@@ -23,6 +23,7 @@
  */
 
 #include "mcfft.h"
+#include "mcfft_wisdom.h"
 #include "generic/mcfft_generic.h"
 #include "x86/mcfft_avx.h"
 #include "aarch64/mcfft_neon.h"
@@ -32,10 +33,28 @@
 #define MC_SELECTOR g
 #endif
 
+/** Default pipeline for MC_FFT_PLAN_ESTIMATE (DIT or DIF) */
 #ifndef MC_IS_DIF_FFT
 #define MC_IS_DIF_FFT (0)
 #endif
 
+/** Number of FFT runs per pipeline for MC_FFT_PLAN_MEASURE (best run is taken) */
+#ifndef MC_FFT_PLAN_MEASURE_RUNS
+#define MC_FFT_PLAN_MEASURE_RUNS (8u)
+#endif
+
+static void st_fft_shuffle(const mc_fft_t *context, float * restrict re, float * restrict im, uint32_t length) {
+    const uint16_t *dit_map = (const uint16_t*)&context->digitRev[0];
+    const uint16_t *dif_map = (const uint16_t*)&context->digitRev[length>>1u];
+    uint32_t isDif = (context->pipeline & MC_FFT_PIPELINE_DIF);
+    /** NOTE: DIT & DIF maps are inverse to each other => scatter uses opposite map */
+    if (context->pipeline & MC_FFT_PIPELINE_SCATTER) {
+        mc_shuffle_scatter_mono_g(re, im, context->buffer, isDif ? dit_map : dif_map, length);
+    } else {
+        MC_FUNC_CALL(shuffle_mono, MC_SELECTOR)(re, im, context->buffer, isDif ? dif_map : dit_map, length);
+    }
+}
+
 void mc_fft_mono(const mc_fft_t *context, float * restrict re, float * restrict im, uint32_t length)
 {
     MC_NULLPTR_ASSERT(context);
@@ -48,13 +67,13 @@ void mc_fft_mono(const mc_fft_t *context, float * restrict re, float * restrict
     MC_ASSERT(context->bufLength >= (2u*length));
     MC_ASSERT(MC_MAX_FFT_LENGTH >= length);
     MC_ASSERT(length >= MC_MIN_FFT_LENGTH);
-#if MC_IS_DIF_FFT
-    MC_FUNC_CALL(fft_dif_mono_core, MC_SELECTOR)(re, im, context->twiddle, context->pow2);
-    MC_FUNC_CALL(shuffle_mono, MC_SELECTOR)(re, im, context->buffer, (const uint16_t*)&context->digitRev[length>>1u], length);
-#else
-    MC_FUNC_CALL(shuffle_mono, MC_SELECTOR)(re, im, context->buffer, (const uint16_t*)&context->digitRev[0], length);
-    MC_FUNC_CALL(fft_dit_mono_core, MC_SELECTOR)(re, im, context->twiddle, context->pow2);
-#endif
+    if (context->pipeline & MC_FFT_PIPELINE_DIF) {
+        MC_FUNC_CALL(fft_dif_mono_core, MC_SELECTOR)(re, im, context->twiddle, context->pow2);
+        st_fft_shuffle(context, re, im, length);
+    } else {
+        st_fft_shuffle(context, re, im, length);
+        MC_FUNC_CALL(fft_dit_mono_core, MC_SELECTOR)(re, im, context->twiddle, context->pow2);
+    }
 }
 
 void mc_ifft_mono(const mc_fft_t *context, float * restrict re, float * restrict im, uint32_t length) {
@@ -68,13 +87,149 @@ void mc_ifft_mono(const mc_fft_t *context, float * restrict re, float * restrict
     MC_ASSERT(context->bufLength >= (2u*length));
     MC_ASSERT(MC_MAX_FFT_LENGTH >= length);
     MC_ASSERT(length >= MC_MIN_FFT_LENGTH);
-#if MC_IS_DIF_FFT
-    MC_FUNC_CALL(ifft_dif_mono_core, MC_SELECTOR)(re, im, context->twiddle, context->pow2);
-    MC_FUNC_CALL(shuffle_mono, MC_SELECTOR)(re, im, context->buffer, (const uint16_t*)&context->digitRev[length>>1u], length);
-#else
-    MC_FUNC_CALL(shuffle_mono, MC_SELECTOR)(re, im, context->buffer, (const uint16_t*)&context->digitRev[0], length);
+    if (context->pipeline & MC_FFT_PIPELINE_DIF) {
+        MC_FUNC_CALL(ifft_dif_mono_core, MC_SELECTOR)(re, im, context->twiddle, context->pow2);
+        st_fft_shuffle(context, re, im, length);
+    } else {
+        st_fft_shuffle(context, re, im, length);
+        MC_FUNC_CALL(ifft_dit_mono_core, MC_SELECTOR)(re, im, context->twiddle, context->pow2);
+    }
+}
+
+void mc_fft_mono_scrambled(const mc_fft_t *context, float * restrict re, float * restrict im, uint32_t length) {
+    MC_NULLPTR_ASSERT(context);
+    MC_NULLPTR_ASSERT(context->twiddle);
+    MC_NULLPTR_ASSERT(re);
+    MC_NULLPTR_ASSERT(im);
+    MC_ASSERT((1U<<context->pow2) == length);
+    MC_ASSERT(MC_MAX_FFT_LENGTH >= length);
+    MC_ASSERT(length >= MC_MIN_FFT_LENGTH);
+    (void)length;
+    MC_FUNC_CALL(fft_dif_mono_core, MC_SELECTOR)(re, im, context->twiddle, context->pow2);
+}
+
+void mc_ifft_mono_scrambled(const mc_fft_t *context, float * restrict re, float * restrict im, uint32_t length) {
+    MC_NULLPTR_ASSERT(context);
+    MC_NULLPTR_ASSERT(context->twiddle);
+    MC_NULLPTR_ASSERT(re);
+    MC_NULLPTR_ASSERT(im);
+    MC_ASSERT((1U<<context->pow2) == length);
+    MC_ASSERT(MC_MAX_FFT_LENGTH >= length);
+    MC_ASSERT(length >= MC_MIN_FFT_LENGTH);
+    (void)length;
     MC_FUNC_CALL(ifft_dit_mono_core, MC_SELECTOR)(re, im, context->twiddle, context->pow2);
-#endif
+}
+
+static void st_fft_permute(const mc_fft_t *context, float * restrict re, float * restrict im, 
+                           const uint16_t *map, uint32_t length) {
+    MC_NULLPTR_ASSERT(context->buffer);
+    MC_NULLPTR_ASSERT(re);
+    MC_ASSERT((1U<<context->pow2) == length);
+    MC_ASSERT(context->bufLength >= (2u*length));
+    if (NULL != im) {
+        MC_FUNC_CALL(shuffle_mono, MC_SELECTOR)(re, im, context->buffer, map, length);
+    } else {
+        for (uint32_t i = 0; i < length; ++i) {
+            context->buffer[i] = re[map[i]];
+        }
+        memcpy(re, context->buffer, sizeof(float)*length);
+    }
+}
+
+void mc_fft_scramble(const mc_fft_t *context, float * restrict re, float * restrict im, uint32_t length) {
+    MC_NULLPTR_ASSERT(context);
+    MC_NULLPTR_ASSERT(context->digitRev);
+    /** Scrambled position i keeps natural bin dit_map[i] (DIF map is inverse of DIT map) */
+    st_fft_permute(context, re, im, (const uint16_t*)&context->digitRev[0], length);
+}
+
+void mc_fft_unscramble(const mc_fft_t *context, float * restrict re, float * restrict im, uint32_t length) {
+    MC_NULLPTR_ASSERT(context);
+    MC_NULLPTR_ASSERT(context->digitRev);
+    st_fft_permute(context, re, im, (const uint16_t*)&context->digitRev[length>>1u], length);
+}
+
+void mc_fft_mono_power(const mc_fft_t *context, float * restrict re, float * restrict im, float * restrict power, uint32_t length) {
+    MC_NULLPTR_ASSERT(context);
+    MC_NULLPTR_ASSERT(context->digitRev);
+    MC_NULLPTR_ASSERT(context->twiddle);
+    MC_NULLPTR_ASSERT(re);
+    MC_NULLPTR_ASSERT(im);
+    MC_NULLPTR_ASSERT(power);
+    MC_ASSERT((1U<<context->pow2) == length);
+    MC_ASSERT(MC_MAX_FFT_LENGTH >= length);
+    MC_ASSERT(length >= MC_MIN_FFT_LENGTH);
+    MC_FUNC_CALL(fft_dif_mono_core, MC_SELECTOR)(re, im, context->twiddle, context->pow2);
+    /** Bin k of DIF output is placed to dif_map[k] */
+    MC_FUNC_CALL(shuffle_power, MC_SELECTOR)(power, re, im, (const uint16_t*)&context->digitRev[length>>1u], length);
+}
+
+void mc_fft_power(float * restrict out, const float * restrict re, const float * restrict im, uint32_t length) {
+    MC_NULLPTR_ASSERT(out);
+    MC_NULLPTR_ASSERT(re);
+    MC_NULLPTR_ASSERT(im);
+    MC_FUNC_CALL(spectrum_power, MC_SELECTOR)(out, re, im, length);
+}
+
+void mc_fft_magnitude(float * restrict out, const float * restrict re, const float * restrict im, uint32_t length) {
+    MC_NULLPTR_ASSERT(out);
+    MC_NULLPTR_ASSERT(re);
+    MC_NULLPTR_ASSERT(im);
+    MC_FUNC_CALL(spectrum_magnitude, MC_SELECTOR)(out, re, im, length);
+}
+
+void mc_fft_log_power(float * restrict out, const float * restrict re, const float * restrict im, uint32_t length) {
+    MC_NULLPTR_ASSERT(out);
+    MC_NULLPTR_ASSERT(re);
+    MC_NULLPTR_ASSERT(im);
+    MC_FUNC_CALL(spectrum_log_power, MC_SELECTOR)(out, re, im, length);
+}
+
+void mc_fft_phase(float * restrict out, const float * restrict re, const float * restrict im, uint32_t length) {
+    MC_NULLPTR_ASSERT(out);
+    MC_NULLPTR_ASSERT(re);
+    MC_NULLPTR_ASSERT(im);
+    MC_FUNC_CALL(spectrum_phase, MC_SELECTOR)(out, re, im, length);
+}
+
+void mc_fft_plan(mc_fft_t *context, uint32_t mode, float * restrict re, float * restrict im, uint32_t length) {
+    MC_NULLPTR_ASSERT(context);
+    MC_ASSERT((1U<<context->pow2) == length);
+    MC_ASSERT((MC_FFT_PLAN_ESTIMATE == mode) || (MC_FFT_PLAN_MEASURE == mode));
+    /** Heuristic: gather shuffle (scatter is slower when signal doesn't fit L1), DIT/DIF is compile-time default */
+    context->pipeline = MC_IS_DIF_FFT ? MC_FFT_PIPELINE_DIF : MC_FFT_PIPELINE_DIT;
+    if (MC_FFT_PLAN_ESTIMATE == mode) {
+        (void)mc_fft_get_wisdom(context->pow2, &context->pipeline);
+    } else {
+        uint64_t bestTime = UINT64_MAX;
+        uint32_t bestPipeline = context->pipeline;
+        MC_NULLPTR_ASSERT(re);
+        MC_NULLPTR_ASSERT(im);
+        for (uint32_t pipeline = 0; pipeline < MC_FFT_PIPELINE_COUNT; ++pipeline) {
+            uint64_t pipelineTime = UINT64_MAX;
+            context->pipeline = pipeline;
+            for (uint32_t i = 0; i < length; ++i) {
+                re[i] = (float)(i & 7u) - 3.5f;
+                im[i] = 0.f;
+            }
+            /** Warm-up (caches, tables) */
+            mc_fft_mono(context, re, im, length);
+            for (uint32_t run = 0; run < MC_FFT_PLAN_MEASURE_RUNS; ++run) {
+                uint64_t t0 = mc_get_time_ns();
+                mc_fft_mono(context, re, im, length);
+                mc_ifft_mono(context, re, im, length);
+                uint64_t t1 = mc_get_time_ns() - t0;
+                pipelineTime = (t1 < pipelineTime) ? t1 : pipelineTime;
+                mc_fft_norm(re, im, length);
+            }
+            if (pipelineTime < bestTime) {
+                bestTime = pipelineTime;
+                bestPipeline = pipeline;
+            }
+        }
+        context->pipeline = bestPipeline;
+        mc_fft_set_wisdom(context->pow2, bestPipeline);
+    }
 }
 
 void mc_fft_get_digitRev(uint32_t *out, uint32_t length, uint32_t power2) {
@@ -105,6 +260,18 @@ void mc_fft_get_digitRev(uint32_t *out, uint32_t length, uint32_t power2) {
     }
 }
 
+void mc_fft_get_mirror(uint16_t *out, const uint32_t *digitRev, uint32_t power2) {
+    MC_NULLPTR_ASSERT(out);
+    MC_NULLPTR_ASSERT(digitRev);
+    MC_ASSERT(MC_MAX_FFT_LENGTH >= (1u<<power2));
+    const uint32_t fftLength = 1u<<power2;
+    /** DIF core places bin k to dif_map[k] */
+    const uint16_t *dif_map = (const uint16_t*)&digitRev[fftLength>>1u];
+    for (uint32_t k = 0; k < fftLength; ++k) {
+        out[dif_map[k]] = dif_map[(fftLength - k) & (fftLength - 1u)];
+    }
+}
+
 void mc_fft_get_twiddle(float * restrict out, uint32_t length, uint32_t power2) {
     uint32_t step = (1u<<power2);
     uint32_t totalElements = 0;
@@ -122,6 +289,31 @@ void mc_fft_get_twiddle(float * restrict out, uint32_t length, uint32_t power2)
     } while (step >= 8u);
 }
 
+uintptr_t mc_fft_create_tables(mc_fft_t *context, uint32_t power2, uintptr_t memory_addr) {
+    MC_NULLPTR_ASSERT(context);
+    MC_ASSERT(MC_MAX_FFT_LENGTH >= (1u<<power2));
+    MC_ASSERT(memory_addr == MC_GET_ALIGNED_PTR(memory_addr));
+    context->pow2 = power2;
+    context->twiddle = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(context->twiddle[0])*MC_TWIDDLE_LENGTH(power2));
+    context->digitRev = (uint32_t*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(context->digitRev[0])*MC_DIGIT_LENGTH(power2));
+    mc_fft_get_twiddle(context->twiddle, MC_TWIDDLE_LENGTH(power2), power2);
+    mc_fft_get_digitRev(context->digitRev, MC_DIGIT_LENGTH(power2), power2);
+    mc_fft_plan(context, MC_FFT_PLAN_ESTIMATE, NULL, NULL, (1u<<power2));
+    return memory_addr;
+}
+
+mc_fft_t mc_fft_with_buffer(const mc_fft_t *plan, float *buffer, uint32_t bufLength) {
+    MC_NULLPTR_ASSERT(plan);
+    MC_NULLPTR_ASSERT(buffer);
+    MC_ASSERT(bufLength >= MC_BUFFER_LENGTH(plan->pow2));
+    mc_fft_t fft = *plan;
+    fft.buffer = buffer;
+    fft.bufLength = bufLength;
+    return fft;
+}
+
 void mc_fft_create_object(mc_fft_object_t *obj, uint32_t power2, void *memory, size_t memSize) {
     MC_NULLPTR_ASSERT(obj);
     MC_NULLPTR_ASSERT(memory);
@@ -143,6 +335,7 @@ void mc_fft_create_object(mc_fft_object_t *obj, uint32_t power2, void *memory, s
     MC_ASSERT(memory_addr <= (uintptr_t)obj->memory+memSize);
     mc_fft_get_digitRev(obj->context.digitRev, (1u<<power2), power2);
     mc_fft_get_twiddle(obj->context.twiddle, MC_TWIDDLE_LENGTH(power2), power2);
+    mc_fft_plan(&obj->context, MC_FFT_PLAN_ESTIMATE, NULL, NULL, (1u<<power2));
 }
 
 #ifndef MC_EXCLUDE_MALLOC
@@ -32,17 +32,63 @@ extern "C" {
 
 #include "utils.h"
 
+/** Library version (see wisdom/plan image compatibility checks) */
+#define MC_FFT_VERSION_MAJOR (1u)
+#define MC_FFT_VERSION_MINOR (1u)
+#define MC_FFT_VERSION_PATCH (0u)
+#define MC_FFT_VERSION ((MC_FFT_VERSION_MAJOR<<16u) | (MC_FFT_VERSION_MINOR<<8u) | MC_FFT_VERSION_PATCH)
+
 /** Get the number of elements required for buffer (see mc_fft_t) */
 #define MC_BUFFER_LENGTH(power2) ((1u<<((power2)+1u)))
 /** Get the number of elements required for digit reverse (see mc_fft_t) */
 #define MC_DIGIT_LENGTH(power2) ((1u<<(power2)))
+/** Compact twiddle storage (can be defined outside, must match for library and user's code):
+ * 0 - Re/Im of angle, 2*angle, 3*angle are stored for each radix-4 butterfly (fastest for small FFTs)
+ * 1 - only Re/Im of angle is stored for radix-4 loop stages, 2*angle & 3*angle are derived in-register
+ *     (~3x smaller twiddle table: less memory traffic when tables don't fit L1/L2) */
+#ifndef MC_COMPACT_TWIDDLE
+#define MC_COMPACT_TWIDDLE (0)
+#endif
+
+#if MC_COMPACT_TWIDDLE
+/** Number of twiddle elements stored per 8 butterflies of radix-4 loop stage (Re/Im x8: angle) */
+#define MC_TWIDDLE_BLOCK_SIZE (16u)
+/** Twiddle factors calculated for each loop (only angle is stored for loop stages):
+ * Loop stages (step >= 32) require step/2 elements, last depth2 stage requires 24 (step == 16) or 6 (step == 8)
+ * For odd power of 2: (2^(n+1)-16)/3 + 6, for even power of 2: (2^(n+1)-32)/3 + 24 */
+#define MC_TWIDDLE_LENGTH(power2) (((power2)%2u) ? (((1u<<((power2)+1u))+2u)/3u) : (((1u<<((power2)+1u))+40u)/3u))
+#else
+/** Number of twiddle elements stored per 8 butterflies of radix-4 loop stage (Re/Im x8: angle, 2*angle, 3*angle) */
+#define MC_TWIDDLE_BLOCK_SIZE (48u)
 /** Twiddle factors calculated for each loop:
  * For instance, for FFT 64-points (n=3): 1, 4, 16 = (4^n-1)/3 (x6 for Re/Im: angle, 2*angle, 3*angle)
  * NOTE: First twiddle is always skipped, then full formula: (((4^n-1)/3)-1)*6 or 2*(4^n-1)-6
  * NOTE: If power of 2 is odd (not a power of 4) then 2 last values are not used  */
 #define MC_TWIDDLE_LENGTH(power2) (((power2)%2u) ? ((((1u<<(power2))-1u)<<1u)-8u) : ((((1u<<(power2))-1u)<<1u)-6u))
+#endif
 /** Get the number of elements required to store twiddle values for specific stage */
-#define MC_TWIDDLE_STAGE_SIZE(step) ((step == 8u) ? 6u : (6u*((step)>>2u)))
+#define MC_TWIDDLE_STAGE_SIZE(step) (((step) == 8u) ? 6u : (((step) == 16u) ? 24u : (MC_TWIDDLE_BLOCK_SIZE*((step)>>5u))))
+
+/** Regularisation of PHAT weighting: 1/sqrt(|C|^2 + eps) (see mcfft_corr.h) */
+#define MC_SPECTRUM_PHAT_EPSILON (1E-30f)
+/** Power floor of log-power spectrum: -200 dB (see mc_fft_log_power()) */
+#define MC_SPECTRUM_POWER_FLOOR (1E-20f)
+
+/** FFT pipeline flags (see mc_fft_t.pipeline, mc_fft_plan()) */
+/** Digit reverse (shuffle) first, then Decimation-In-Time core */
+#define MC_FFT_PIPELINE_DIT     (0u)
+/** Decimation-In-Frequency core first, then digit reverse (shuffle) */
+#define MC_FFT_PIPELINE_DIF     (1u)
+/** Shuffle reads input sequentially and scatters it (instead of gather with sequential writes) */
+#define MC_FFT_PIPELINE_SCATTER (2u)
+/** Number of pipeline combinations */
+#define MC_FFT_PIPELINE_COUNT   (4u)
+
+/** Planner modes (see mc_fft_plan()) */
+/** Pipeline is taken from wisdom (see mcfft_wisdom.h) or chosen by built-in heuristic (cheap, used by mc_fft_create_object()) */
+#define MC_FFT_PLAN_ESTIMATE (0u)
+/** All pipelines are measured on user's data and the fastest one is chosen (and stored to wisdom) */
+#define MC_FFT_PLAN_MEASURE  (1u)
 
 /** FFT context with pre-calculated values and buffer required */
 typedef struct mc_fft_t {
@@ -53,6 +99,7 @@ typedef struct mc_fft_t {
     float *buffer;      /* Buffer required to process FFT */
     uint32_t bufLength; /* Number of buffer elements must be >= MC_BUFFER_LENGTH(power2) */
     uint32_t pow2;      /* length of FFT */
+    uint32_t pipeline;  /* MC_FFT_PIPELINE_* flags (see mc_fft_plan()) */
 
 } mc_fft_t;
 
@@ -76,6 +123,75 @@ void mc_fft_mono(const mc_fft_t *context, float * restrict re, float * restrict
  */
 void mc_ifft_mono(const mc_fft_t *context, float * restrict re, float * restrict im, uint32_t length);
 
+/** Forward FFT without digit reverse: output spectrum is in digit-reversed (scrambled) order
+ * Always DIF core, neither buffer nor digit reverse map of context is used
+ * Use it with mc_ifft_mono_scrambled() when natural order of spectrum is not required 
+ * (convolution, correlation, masking), filters/masks must be scrambled once via mc_fft_scramble()
+ * 
+ * @param context Pointer to context with pre-calculated values
+ * @param re Pointer to real part of signal
+ * @param im Pointer to imag part of signal
+ * @param length Length of Re/Im signal to be processed (must be power of 2 and match FFT context)
+ */
+void mc_fft_mono_scrambled(const mc_fft_t *context, float * restrict re, float * restrict im, uint32_t length);
+
+/** Inverse FFT of spectrum in digit-reversed (scrambled) order, output signal is in natural order
+ * Always DIT core, neither buffer nor digit reverse map of context is used
+ * 
+ * @param context Pointer to context with pre-calculated values
+ * @param re Pointer to real part of scrambled spectrum
+ * @param im Pointer to imag part of scrambled spectrum
+ * @param length Length of Re/Im signal to be processed (must be power of 2 and match FFT context)
+ * 
+ * NOTE: don't forget to call mc_fft_norm() function after (or pre-scale filter/mask by 1/length)
+ */
+void mc_ifft_mono_scrambled(const mc_fft_t *context, float * restrict re, float * restrict im, uint32_t length);
+
+/** Permute spectrum (or mask) from natural to digit-reversed order used by mc_fft_mono_scrambled()
+ * 
+ * @param context Pointer to context with pre-calculated values and buffer required
+ * @param re Pointer to real part of spectrum (or real mask)
+ * @param im Pointer to imag part of spectrum (can be NULL for real mask)
+ * @param length Length of Re/Im (must be power of 2 and match FFT context)
+ */
+void mc_fft_scramble(const mc_fft_t *context, float * restrict re, float * restrict im, uint32_t length);
+
+/** Permute spectrum (or mask) from digit-reversed order to natural order (see mc_fft_scramble())
+ * 
+ * @param context Pointer to context with pre-calculated values and buffer required
+ * @param re Pointer to real part of spectrum (or real mask)
+ * @param im Pointer to imag part of spectrum (can be NULL for real mask)
+ * @param length Length of Re/Im (must be power of 2 and match FFT context)
+ */
+void mc_fft_unscramble(const mc_fft_t *context, float * restrict re, float * restrict im, uint32_t length);
+
+/** Forward FFT with power spectrum output: DIF core and digit reverse gather fused with |X|^2,
+ *  i.e. no shuffle pass of Re/Im and no separate power pass
+ * 
+ * @param context Pointer to context with pre-calculated values
+ * @param re Pointer to real part of signal (spectrum in digit-reversed order on return)
+ * @param im Pointer to imag part of signal (spectrum in digit-reversed order on return)
+ * @param power Pointer to output power spectrum in natural order (can't be the same as re/im)
+ * @param length Length of Re/Im signal to be processed (must be power of 2 and match FFT context)
+ */
+void mc_fft_mono_power(const mc_fft_t *context, float * restrict re, float * restrict im, float * restrict power, uint32_t length);
+
+/** Post-processing of spectrum (any length, out can't be the same as re/im): 
+ *  - power: |X|^2
+ *  - magnitude: |X|
+ *  - log power: 10*log10(max(|X|^2, MC_SPECTRUM_POWER_FLOOR)) dB, fast log: max abs error 1E-4 dB
+ *  - phase: atan2(Im, Re) in [-pi, pi], fast atan2: max abs error 4E-6 rad
+ * 
+ * @param out Pointer to output values
+ * @param re Pointer to real part of spectrum
+ * @param im Pointer to imag part of spectrum
+ * @param length Length of Re/Im/out
+ */
+void mc_fft_power(float * restrict out, const float * restrict re, const float * restrict im, uint32_t length);
+void mc_fft_magnitude(float * restrict out, const float * restrict re, const float * restrict im, uint32_t length);
+void mc_fft_log_power(float * restrict out, const float * restrict re, const float * restrict im, uint32_t length);
+void mc_fft_phase(float * restrict out, const float * restrict re, const float * restrict im, uint32_t length);
+
 /** Get FFT digit reverse of signal
  * 
  * @param out Pointer to user's buffer to store values (see mc_fft_t.digitRev)
@@ -84,6 +200,16 @@ void mc_ifft_mono(const mc_fft_t *context, float * restrict re, float * restrict
  */
 void mc_fft_get_digitRev(uint32_t *out, uint32_t length, uint32_t power2);
 
+/** Get mirror map for spectrum in digit-reversed order (see mc_fft_mono_scrambled()):
+ * out[i] is the position of bin N-k where bin k is placed to position i
+ * Used to split spectrum of two real signals packed as Re/Im without unscrambling
+ * 
+ * @param out Pointer to user's buffer to store values (length is MC_DIGIT_LENGTH(power2))
+ * @param digitRev Pointer to digit reverse map (see mc_fft_get_digitRev())
+ * @param power2 Power of 2 which reflects required length of FFT
+ */
+void mc_fft_get_mirror(uint16_t *out, const uint32_t *digitRev, uint32_t power2);
+
 /** Get FFT twiddle factors
  * 
  * @param out Pointer to user's buffer to store values (see mc_fft_t.twiddle)
@@ -92,12 +218,45 @@ void mc_fft_get_digitRev(uint32_t *out, uint32_t length, uint32_t power2);
  */
 void mc_fft_get_twiddle(float * restrict out, uint32_t length, uint32_t power2);
 
+/** Choose FFT pipeline (DIT/DIF, gather/scatter shuffle) and record it into context
+ * 
+ * @param context Pointer to context with pre-calculated values and buffer required
+ * @param mode MC_FFT_PLAN_ESTIMATE or MC_FFT_PLAN_MEASURE
+ * @param re Pointer to real part of scratch signal (only for MC_FFT_PLAN_MEASURE, content is destroyed)
+ * @param im Pointer to imag part of scratch signal (only for MC_FFT_PLAN_MEASURE, content is destroyed)
+ * @param length Length of Re/Im signal (must be power of 2 and match FFT context)
+ */
+void mc_fft_plan(mc_fft_t *context, uint32_t mode, float * restrict re, float * restrict im, uint32_t length);
+
 /** Get FFT object size in bytes if static/non-malloc allocation is required */
 #define MC_FFT_GET_OBJECT_SIZE(power2) (MC_GET_ALIGNED_SIZE(sizeof(float)*MC_BUFFER_LENGTH(power2)) \
                                         + MC_GET_ALIGNED_SIZE(sizeof(uint32_t)*MC_DIGIT_LENGTH(power2)) \
                                         + MC_GET_ALIGNED_SIZE(sizeof(float)*MC_TWIDDLE_LENGTH(power2)) \
                                         + MC_MEM_ALIGNMENT)
 
+/** Get size of FFT tables (twiddle factors and digit reverse, no buffer) in bytes (see mc_fft_create_tables()) */
+#define MC_FFT_GET_TABLES_SIZE(power2) (MC_GET_ALIGNED_SIZE(sizeof(float)*MC_TWIDDLE_LENGTH(power2)) \
+                                        + MC_GET_ALIGNED_SIZE(sizeof(uint32_t)*MC_DIGIT_LENGTH(power2)))
+
+/** Create tables of FFT (twiddle factors and digit reverse) without buffer in user's memory:
+ *  plan of composite transforms (2-D/3-D/parallel FFT), threads use it with private buffers (see mc_fft_with_buffer())
+ * 
+ * @param context Pointer to FFT context (pow2/twiddle/digitRev/pipeline are set, other fields are kept)
+ * @param power2 Power of 2 which reflects required length of FFT
+ * @param memory_addr Aligned address of user's memory (see MC_FFT_GET_TABLES_SIZE(power2))
+ * @return Aligned address of memory after tables
+ */
+uintptr_t mc_fft_create_tables(mc_fft_t *context, uint32_t power2, uintptr_t memory_addr);
+
+/** Get copy of plan with another buffer of digit reverse (tables are shared), e.g. plan of thread
+ * 
+ * @param plan Pointer to FFT context with tables
+ * @param buffer Pointer to buffer (see MC_BUFFER_LENGTH(power2))
+ * @param bufLength Number of elements of buffer
+ * @return FFT context
+ */
+mc_fft_t mc_fft_with_buffer(const mc_fft_t *plan, float *buffer, uint32_t bufLength);
+
 /** FFT object to control memory alignment and simplify allocation of memory (see mc_fft_t) */
 typedef struct mc_fft_object_t {
     mc_fft_t context;
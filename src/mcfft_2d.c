@@ -0,0 +1,251 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "mcfft_2d.h"
+#include "generic/mcfft_generic.h"
+#include "x86/mcfft_avx.h"
+#include "aarch64/mcfft_neon.h"
+#include <math.h>
+
+#ifndef MC_SELECTOR
+#define MC_SELECTOR g
+#endif
+
+/** Columns per task of transpose column pass (8x8 transpose kernels) */
+#define MC_FFT_2D_TILE (8u)
+
+typedef struct mc_fft_2d_job_t {
+    const mc_fft_2d_t *context;
+    float *re;
+    float *im;
+    uint32_t columns;   /* number of columns of column pass */
+} mc_fft_2d_job_t;
+
+static uint32_t st_fft_2d_max_pow2(uint32_t widthPow2, uint32_t heightPow2) {
+    return (widthPow2 > heightPow2) ? widthPow2 : heightPow2;
+}
+
+static mc_fft_t st_fft_2d_thread_plan(const mc_fft_2d_t *context, const mc_fft_t *plan, uint32_t thread) {
+    return mc_fft_with_buffer(plan, &context->scratch[thread*context->scratchLength], 
+                              MC_BUFFER_LENGTH(st_fft_2d_max_pow2(context->widthPow2, context->heightPow2)));
+}
+
+static float *st_fft_2d_thread_data(const mc_fft_2d_t *context, uint32_t thread) {
+    return &context->scratch[thread*context->scratchLength 
+                             + MC_BUFFER_LENGTH(st_fft_2d_max_pow2(context->widthPow2, context->heightPow2))];
+}
+
+static void st_fft_2d_rows(void *arg, uint32_t index, uint32_t thread) {
+    const mc_fft_2d_job_t *job = (const mc_fft_2d_job_t*)arg;
+    const mc_fft_2d_t *context = job->context;
+    const uint32_t width = 1u<<context->widthPow2;
+    const mc_fft_t fft = st_fft_2d_thread_plan(context, &context->rows, thread);
+    for (uint32_t r = index*MC_FFT_2D_ROWS; r < (index + 1u)*MC_FFT_2D_ROWS; ++r) {
+        mc_fft_mono(&fft, &job->re[r*width], &job->im[r*width], width);
+    }
+}
+
+static void st_fft_2d_rows_real(void *arg, uint32_t index, uint32_t thread) {
+    const mc_fft_2d_job_t *job = (const mc_fft_2d_job_t*)arg;
+    const mc_fft_2d_t *context = job->context;
+    const uint32_t width = 1u<<context->widthPow2;
+    const mc_fft_t fft = st_fft_2d_thread_plan(context, &context->rows, thread);
+    float *zRe = st_fft_2d_thread_data(context, thread);
+    float *zIm = &zRe[width];
+    /** Two real rows per complex FFT, only half of spectrum (width/2+1 bins) is split */
+    for (uint32_t r = index*MC_FFT_2D_ROWS; r < (index + 1u)*MC_FFT_2D_ROWS; r += 2u) {
+        memcpy(zRe, &job->re[r*width], sizeof(float)*width);
+        memcpy(zIm, &job->re[(r + 1u)*width], sizeof(float)*width);
+        mc_fft_mono(&fft, zRe, zIm, width);
+        mc_spectrum_split_dual_g(&job->re[r*width], &job->im[r*width], &job->re[(r + 1u)*width], &job->im[(r + 1u)*width],
+                                 zRe, zIm, context->mirror, (width>>1u) + 1u);
+    }
+}
+
+static void st_fft_2d_columns_vertical(void *arg, uint32_t index, uint32_t thread) {
+    const mc_fft_2d_job_t *job = (const mc_fft_2d_job_t*)arg;
+    const mc_fft_2d_t *context = job->context;
+    const uint32_t col = index*MC_FFT_2D_COLUMNS;
+    const uint32_t count = ((col + MC_FFT_2D_COLUMNS) <= job->columns) ? MC_FFT_2D_COLUMNS : (job->columns - col);
+    (void)thread;
+    MC_FUNC_CALL(fft_columns, MC_SELECTOR)(&job->re[col], &job->im[col], context->twiddle, context->bitRev, 
+                                           1u<<context->widthPow2, context->heightPow2, count);
+}
+
+static void st_fft_2d_columns_transpose(void *arg, uint32_t index, uint32_t thread) {
+    const mc_fft_2d_job_t *job = (const mc_fft_2d_job_t*)arg;
+    const mc_fft_2d_t *context = job->context;
+    const uint32_t width = 1u<<context->widthPow2;
+    const uint32_t height = 1u<<context->heightPow2;
+    const uint32_t col = index*MC_FFT_2D_TILE;
+    if ((col + MC_FFT_2D_TILE) > job->columns) {
+        /** Last column of real 2-D FFT (width/2) */
+        MC_FUNC_CALL(fft_columns, MC_SELECTOR)(&job->re[col], &job->im[col], context->twiddle, context->bitRev, 
+                                               width, context->heightPow2, job->columns - col);
+        return;
+    }
+    const mc_fft_t fft = st_fft_2d_thread_plan(context, &context->columns, thread);
+    float *tRe = st_fft_2d_thread_data(context, thread);
+    float *tIm = &tRe[MC_FFT_2D_TILE*height];
+    MC_FUNC_CALL(transpose_tile, MC_SELECTOR)(tRe, &job->re[col], width, height, height);
+    MC_FUNC_CALL(transpose_tile, MC_SELECTOR)(tIm, &job->im[col], width, height, height);
+    for (uint32_t c = 0; c < MC_FFT_2D_TILE; ++c) {
+        mc_fft_mono(&fft, &tRe[c*height], &tIm[c*height], height);
+    }
+    for (uint32_t k = 0; k < height; k += 8u) {
+        MC_FUNC_CALL(transpose_tile, MC_SELECTOR)(&job->re[k*width + col], &tRe[k], height, width, 8u);
+        MC_FUNC_CALL(transpose_tile, MC_SELECTOR)(&job->im[k*width + col], &tIm[k], height, width, 8u);
+    }
+}
+
+static void st_fft_2d_hermitian(void *arg, uint32_t index, uint32_t thread) {
+    const mc_fft_2d_job_t *job = (const mc_fft_2d_job_t*)arg;
+    const mc_fft_2d_t *context = job->context;
+    const uint32_t width = 1u<<context->widthPow2;
+    const uint32_t heightMask = (1u<<context->heightPow2) - 1u;
+    (void)thread;
+    /** X[h][w] = conj(X[-h][-w]) for w > width/2 */
+    for (uint32_t r = index*MC_FFT_2D_ROWS; r < (index + 1u)*MC_FFT_2D_ROWS; ++r) {
+        const float *mRe = &job->re[((0u - r) & heightMask)*width];
+        const float *mIm = &job->im[((0u - r) & heightMask)*width];
+        for (uint32_t w = (width>>1u) + 1u; w < width; ++w) {
+            job->re[r*width + w] = mRe[width - w];
+            job->im[r*width + w] = -mIm[width - w];
+        }
+    }
+}
+
+static void st_fft_2d_columns(const mc_fft_2d_t *context, mc_thread_pool_t *pool, mc_fft_2d_job_t *job) {
+    if (MC_FFT_2D_VERTICAL == context->mode) {
+        mc_thread_run(pool, st_fft_2d_columns_vertical, job, (job->columns + MC_FFT_2D_COLUMNS - 1u)/MC_FFT_2D_COLUMNS);
+    } else {
+        mc_thread_run(pool, st_fft_2d_columns_transpose, job, (job->columns + MC_FFT_2D_TILE - 1u)/MC_FFT_2D_TILE);
+    }
+}
+
+void mc_fft_2d(const mc_fft_2d_t *context, mc_thread_pool_t *pool, float *re, float *im) {
+    MC_NULLPTR_ASSERT(context);
+    MC_NULLPTR_ASSERT(re);
+    MC_NULLPTR_ASSERT(im);
+    MC_ASSERT((NULL == pool) || (pool->threads <= context->threads));
+    mc_fft_2d_job_t job = {context, re, im, 1u<<context->widthPow2};
+    mc_thread_run(pool, st_fft_2d_rows, &job, (1u<<context->heightPow2)/MC_FFT_2D_ROWS);
+    st_fft_2d_columns(context, pool, &job);
+}
+
+void mc_ifft_2d(const mc_fft_2d_t *context, mc_thread_pool_t *pool, float *re, float *im) {
+    /** Inverse FFT is FFT with swapped Re/Im of input and output */
+    mc_fft_2d(context, pool, im, re);
+}
+
+void mc_fft_2d_real(const mc_fft_2d_t *context, mc_thread_pool_t *pool, float *re, float *im) {
+    MC_NULLPTR_ASSERT(context);
+    MC_NULLPTR_ASSERT(re);
+    MC_NULLPTR_ASSERT(im);
+    MC_ASSERT((NULL == pool) || (pool->threads <= context->threads));
+    mc_fft_2d_job_t job = {context, re, im, ((1u<<context->widthPow2)>>1u) + 1u};
+    mc_thread_run(pool, st_fft_2d_rows_real, &job, (1u<<context->heightPow2)/MC_FFT_2D_ROWS);
+    st_fft_2d_columns(context, pool, &job);
+    mc_thread_run(pool, st_fft_2d_hermitian, &job, (1u<<context->heightPow2)/MC_FFT_2D_ROWS);
+}
+
+static uint32_t st_fft_2d_scratch_length(uint32_t widthPow2, uint32_t heightPow2) {
+    /** Buffer of digit reverse, then pair of real rows or tile of columns (Re then Im) */
+    const uint32_t rowsLength = 2u<<widthPow2;
+    const uint32_t tileLength = (2u*MC_FFT_2D_TILE)<<heightPow2;
+    const uint32_t dataLength = (rowsLength > tileLength) ? rowsLength : tileLength;
+    return (uint32_t)(MC_GET_ALIGNED_SIZE(sizeof(float)*(MC_BUFFER_LENGTH(st_fft_2d_max_pow2(widthPow2, heightPow2)) 
+                                                         + dataLength))/sizeof(float));
+}
+
+size_t mc_fft_2d_get_object_size(uint32_t widthPow2, uint32_t heightPow2, uint32_t threads) {
+    MC_ASSERT((MC_MAX_FFT_POW2 >= widthPow2) && (MC_MIN_FFT_LENGTH <= (1u<<widthPow2)));
+    MC_ASSERT((MC_MAX_FFT_POW2 >= heightPow2) && (MC_MIN_FFT_LENGTH <= (1u<<heightPow2)));
+    MC_ASSERT((threads > 0) && (threads <= MC_THREAD_MAX));
+    return MC_MEM_ALIGNMENT 
+           + MC_FFT_GET_TABLES_SIZE(widthPow2) 
+           + MC_FFT_GET_TABLES_SIZE(heightPow2) 
+           + MC_GET_ALIGNED_SIZE(sizeof(float)*(2u<<heightPow2))
+           + MC_GET_ALIGNED_SIZE(sizeof(uint16_t)*(1u<<heightPow2))
+           + MC_GET_ALIGNED_SIZE(sizeof(uint16_t)*(1u<<widthPow2))
+           + (size_t)threads*sizeof(float)*st_fft_2d_scratch_length(widthPow2, heightPow2);
+}
+
+void mc_fft_2d_create_object(mc_fft_2d_object_t *obj, uint32_t widthPow2, uint32_t heightPow2, uint32_t mode, 
+                             uint32_t threads, void *memory, size_t memSize) {
+    MC_NULLPTR_ASSERT(obj);
+    MC_NULLPTR_ASSERT(memory);
+    MC_ASSERT((MC_FFT_2D_VERTICAL == mode) || (MC_FFT_2D_TRANSPOSE == mode));
+    MC_ASSERT(memSize >= mc_fft_2d_get_object_size(widthPow2, heightPow2, threads));
+    const uint32_t width = 1u<<widthPow2;
+    const uint32_t height = 1u<<heightPow2;
+    const double phi = -2. * (double)MC_PI / (double)height;
+    uintptr_t memory_addr = 0;
+    memset(&obj->context, 0, sizeof(obj->context));
+    obj->memory = memory;
+    obj->context.widthPow2 = widthPow2;
+    obj->context.heightPow2 = heightPow2;
+    obj->context.threads = threads;
+    obj->context.mode = mode;
+    memory_addr = MC_GET_ALIGNED_PTR(obj->memory);
+    memory_addr = mc_fft_create_tables(&obj->context.rows, widthPow2, memory_addr);
+    memory_addr = mc_fft_create_tables(&obj->context.columns, heightPow2, memory_addr);
+    obj->context.twiddle = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*2u*height);
+    obj->context.bitRev = (uint16_t*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(uint16_t)*height);
+    obj->context.mirror = (uint16_t*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(uint16_t)*width);
+    obj->context.scratchLength = st_fft_2d_scratch_length(widthPow2, heightPow2);
+    obj->context.scratch = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*threads*obj->context.scratchLength);
+    MC_ASSERT(memory_addr <= (uintptr_t)obj->memory+memSize);
+    for (uint32_t k = 0; k < height; ++k) {
+        obj->context.twiddle[k] = (float)cos(phi*(double)k);
+        obj->context.twiddle[height + k] = (float)sin(phi*(double)k);
+    }
+    for (uint32_t i = 0; i < height; ++i) {
+        uint32_t rev = 0;
+        for (uint32_t b = 0; b < heightPow2; ++b) {
+            rev |= ((i>>b) & 1u)<<(heightPow2 - 1u - b);
+        }
+        obj->context.bitRev[i] = (uint16_t)rev;
+    }
+    for (uint32_t k = 0; k < width; ++k) {
+        obj->context.mirror[k] = (uint16_t)((width - k) & (width - 1u));
+    }
+}
+
+#ifndef MC_EXCLUDE_MALLOC
+void mc_fft_2d_allocate(mc_fft_2d_object_t *obj, uint32_t widthPow2, uint32_t heightPow2, uint32_t mode, uint32_t threads) {
+    MC_NULLPTR_ASSERT(obj);
+    size_t memory_size = mc_fft_2d_get_object_size(widthPow2, heightPow2, threads);
+    mc_fft_2d_create_object(obj, widthPow2, heightPow2, mode, threads, malloc(memory_size), memory_size);
+}
+
+void mc_fft_2d_free(mc_fft_2d_object_t *obj) {
+    MC_NULLPTR_ASSERT(obj);
+    free(obj->memory);
+}
+#endif // EXCLUDE_MALLOC
@@ -0,0 +1,130 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MC_FFT_2D_H
+#define MC_FFT_2D_H
+
+#include "mcfft.h"
+/** Outside of extern "C": C++ build includes <atomic> */
+#include "mcfft_thread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** 2-D FFT of matrix re/im[height][width] (row-major, Re and Im in separate arrays):
+ *  - Row pass: FFT of every row (mc_fft_mono() with per-thread buffer)
+ *  - Column pass (MC_FFT_2D_VERTICAL): radix-4 butterflies between rows applied to tiles of 
+ *    MC_FFT_2D_COLUMNS columns, i.e. SIMD across columns without transpose
+ *  - Column pass (MC_FFT_2D_TRANSPOSE): tiles of 8 columns are transposed in registers to scratch,
+ *    transformed by mc_fft_mono() and transposed back (cache-blocked)
+ *  - Real input: pairs of rows are transformed by one complex FFT and split, only width/2+1 columns 
+ *    are transformed by column pass, the rest is Hermitian symmetric
+ *  - Rows and columns are split to tasks of thread pool, every thread has its own scratch
+ */
+
+/** Column pass with vertical radix-4 butterflies (default, no extra pass over memory) */
+#define MC_FFT_2D_VERTICAL  (0u)
+/** Column pass with transpose of tiles (cores with small caches, see mc_fft_2d_create_object()) */
+#define MC_FFT_2D_TRANSPOSE (1u)
+/** Columns per task of vertical column pass (one cache line, no false sharing between tasks) */
+#define MC_FFT_2D_COLUMNS (16u)
+/** Rows per task of row pass */
+#define MC_FFT_2D_ROWS (4u)
+
+/** 2-D FFT context with pre-calculated values and buffers required */
+typedef struct mc_fft_2d_t {
+    /** NOTE: All arrays in structure better to align by 64 bytes.
+     *        Use mc_fft_2d_allocate()/mc_fft_2d_create_object() if possible */
+    mc_fft_t rows;          /* Tables of FFT of rows (buffer is per thread) */
+    mc_fft_t columns;       /* Tables of FFT of columns (buffer is per thread) */
+    float *twiddle;         /* W_height^k, k < height (Re then Im) for vertical butterflies */
+    uint16_t *bitRev;       /* Bit reverse of row index */
+    uint16_t *mirror;       /* (width - k) mod width: split of real rows */
+    float *scratch;         /* Per-thread scratch: buffer of digit reverse, pair of real rows or tile of columns */
+    uint32_t scratchLength; /* Number of scratch elements per thread */
+    uint32_t widthPow2;     /* length of rows */
+    uint32_t heightPow2;    /* length of columns */
+    uint32_t mode;          /* MC_FFT_2D_VERTICAL or MC_FFT_2D_TRANSPOSE */
+    uint32_t threads;       /* max number of threads */
+} mc_fft_2d_t;
+
+/** Forward 2-D FFT of complex matrix
+ * 
+ * @param context Pointer to 2-D FFT context
+ * @param pool Pointer to thread pool (NULL - caller's thread only), number of threads must be <= threads of context
+ * @param re Pointer to real part of matrix [height][width]
+ * @param im Pointer to imag part of matrix [height][width]
+ */
+void mc_fft_2d(const mc_fft_2d_t *context, mc_thread_pool_t *pool, float *re, float *im);
+
+/** Inverse 2-D FFT of complex matrix (see mc_fft_2d())
+ * 
+ * NOTE: don't forget to call mc_fft_norm() function after (length is width*height)
+ */
+void mc_ifft_2d(const mc_fft_2d_t *context, mc_thread_pool_t *pool, float *re, float *im);
+
+/** Forward 2-D FFT of real matrix (complex spectrum of whole matrix is returned)
+ * 
+ * @param context Pointer to 2-D FFT context
+ * @param pool Pointer to thread pool (NULL - caller's thread only), number of threads must be <= threads of context
+ * @param re Pointer to real matrix [height][width] (real part of spectrum on return)
+ * @param im Pointer to imag part of spectrum [height][width] (output only)
+ */
+void mc_fft_2d_real(const mc_fft_2d_t *context, mc_thread_pool_t *pool, float *re, float *im);
+
+/** Get 2-D FFT object size in bytes (see mc_fft_2d_create_object()) */
+size_t mc_fft_2d_get_object_size(uint32_t widthPow2, uint32_t heightPow2, uint32_t threads);
+
+/** 2-D FFT object to control memory alignment and simplify allocation of memory (see mc_fft_2d_t) */
+typedef struct mc_fft_2d_object_t {
+    mc_fft_2d_t context;
+    void *memory;
+} mc_fft_2d_object_t;
+
+/** Create 2-D FFT object based on allocated memory (non-malloc API)
+ * 
+ * @param obj Pointer to user's structure where object will be created
+ * @param widthPow2 Power of 2 which reflects length of rows (5..MC_MAX_FFT_POW2)
+ * @param heightPow2 Power of 2 which reflects length of columns (5..MC_MAX_FFT_POW2)
+ * @param mode Column pass: MC_FFT_2D_VERTICAL or MC_FFT_2D_TRANSPOSE (vertical is faster on AVX2 desktop
+ *             for heights 2^5..2^14, transpose keeps working set of column pass to 8 columns)
+ * @param threads Max number of threads (scratch is allocated per thread)
+ * @param memory Pointer to user's memory which used to create object
+ * @param memSize User's memory size in bytes (see mc_fft_2d_get_object_size())
+ */
+void mc_fft_2d_create_object(mc_fft_2d_object_t *obj, uint32_t widthPow2, uint32_t heightPow2, uint32_t mode, 
+                             uint32_t threads, void *memory, size_t memSize);
+
+/** Allocate 2-D FFT object via malloc/free API (can be excluded by defining EXCLUDE_MALLOC macro) */
+void mc_fft_2d_allocate(mc_fft_2d_object_t *obj, uint32_t widthPow2, uint32_t heightPow2, uint32_t mode, uint32_t threads);
+
+/** Release 2-D FFT object via malloc/free API (can be excluded by defining EXCLUDE_MALLOC macro) */
+void mc_fft_2d_free(mc_fft_2d_object_t *obj);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MC_FFT_2D_H */
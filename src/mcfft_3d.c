@@ -0,0 +1,213 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "mcfft_3d.h"
+#include "generic/mcfft_generic.h"
+#include "x86/mcfft_avx.h"
+#include "aarch64/mcfft_neon.h"
+#include <math.h>
+
+#ifndef MC_SELECTOR
+#define MC_SELECTOR g
+#endif
+
+/** Pencils per task of transpose pass (8x8 transpose kernels) */
+#define MC_FFT_3D_TILE (8u)
+/** Max length of volume (32-bit indexes) */
+#define MC_FFT_3D_MAX_POW2 (30u)
+
+/** Pass over pencils of one axis: slabs of adjacent pencils (columns) */
+typedef struct mc_fft_3d_job_t {
+    const mc_fft_3d_t *context;
+    const mc_fft_3d_axis_t *axis;
+    float *re;
+    float *im;
+    uint32_t stride;        /* distance between points of pencil */
+    uint32_t slabStride;    /* distance between slabs */
+    uint32_t columns;       /* number of adjacent pencils per slab */
+    uint32_t tasks;         /* tasks per slab */
+} mc_fft_3d_job_t;
+
+static uint32_t st_fft_3d_buffer_length(const mc_fft_3d_t *context) {
+    uint32_t power2 = (context->widthPow2 > context->heightPow2) ? context->widthPow2 : context->heightPow2;
+    power2 = (power2 > context->depthPow2) ? power2 : context->depthPow2;
+    return MC_BUFFER_LENGTH(power2);
+}
+
+static mc_fft_t st_fft_3d_thread_plan(const mc_fft_3d_t *context, const mc_fft_t *plan, uint32_t thread) {
+    return mc_fft_with_buffer(plan, &context->scratch[thread*context->scratchLength], st_fft_3d_buffer_length(context));
+}
+
+static void st_fft_3d_x(void *arg, uint32_t index, uint32_t thread) {
+    const mc_fft_3d_job_t *job = (const mc_fft_3d_job_t*)arg;
+    const mc_fft_3d_t *context = job->context;
+    const uint32_t width = 1u<<context->widthPow2;
+    const mc_fft_t fft = st_fft_3d_thread_plan(context, &context->x, thread);
+    for (uint32_t r = index*MC_FFT_3D_ROWS; r < (index + 1u)*MC_FFT_3D_ROWS; ++r) {
+        mc_fft_mono(&fft, &job->re[r*width], &job->im[r*width], width);
+    }
+}
+
+static void st_fft_3d_vertical(void *arg, uint32_t index, uint32_t thread) {
+    const mc_fft_3d_job_t *job = (const mc_fft_3d_job_t*)arg;
+    const uint32_t col = (index % job->tasks)*MC_FFT_3D_COLUMNS;
+    const uint32_t offset = (index / job->tasks)*job->slabStride + col;
+    const uint32_t count = ((col + MC_FFT_3D_COLUMNS) <= job->columns) ? MC_FFT_3D_COLUMNS : (job->columns - col);
+    (void)thread;
+    MC_FUNC_CALL(fft_columns, MC_SELECTOR)(&job->re[offset], &job->im[offset], job->axis->twiddle, job->axis->bitRev, 
+                                           job->stride, job->axis->fft.pow2, count);
+}
+
+static void st_fft_3d_transpose(void *arg, uint32_t index, uint32_t thread) {
+    const mc_fft_3d_job_t *job = (const mc_fft_3d_job_t*)arg;
+    const mc_fft_3d_t *context = job->context;
+    const uint32_t length = 1u<<job->axis->fft.pow2;
+    const uint32_t offset = (index / job->tasks)*job->slabStride + (index % job->tasks)*MC_FFT_3D_TILE;
+    const mc_fft_t fft = st_fft_3d_thread_plan(context, &job->axis->fft, thread);
+    float *tRe = &context->scratch[thread*context->scratchLength + st_fft_3d_buffer_length(context)];
+    float *tIm = &tRe[MC_FFT_3D_TILE*length];
+    MC_FUNC_CALL(transpose_tile, MC_SELECTOR)(tRe, &job->re[offset], job->stride, length, length);
+    MC_FUNC_CALL(transpose_tile, MC_SELECTOR)(tIm, &job->im[offset], job->stride, length, length);
+    for (uint32_t c = 0; c < MC_FFT_3D_TILE; ++c) {
+        mc_fft_mono(&fft, &tRe[c*length], &tIm[c*length], length);
+    }
+    for (uint32_t k = 0; k < length; k += 8u) {
+        MC_FUNC_CALL(transpose_tile, MC_SELECTOR)(&job->re[offset + k*job->stride], &tRe[k], length, job->stride, 8u);
+        MC_FUNC_CALL(transpose_tile, MC_SELECTOR)(&job->im[offset + k*job->stride], &tIm[k], length, job->stride, 8u);
+    }
+}
+
+/** Pencils of Y/Z axis: slabs x columns */
+static void st_fft_3d_axis(const mc_fft_3d_t *context, mc_thread_pool_t *pool, float *re, float *im, 
+                           const mc_fft_3d_axis_t *axis, uint32_t stride, uint32_t slabs, uint32_t slabStride) {
+    const uint32_t tile = (MC_FFT_3D_VERTICAL == context->mode) ? MC_FFT_3D_COLUMNS : MC_FFT_3D_TILE;
+    mc_fft_3d_job_t job = {context, axis, re, im, stride, slabStride, stride, (stride + tile - 1u)/tile};
+    mc_thread_run(pool, (MC_FFT_3D_VERTICAL == context->mode) ? st_fft_3d_vertical : st_fft_3d_transpose, 
+                  &job, slabs*job.tasks);
+}
+
+void mc_fft_3d(const mc_fft_3d_t *context, mc_thread_pool_t *pool, float *re, float *im) {
+    MC_NULLPTR_ASSERT(context);
+    MC_NULLPTR_ASSERT(re);
+    MC_NULLPTR_ASSERT(im);
+    MC_ASSERT((NULL == pool) || (pool->threads <= context->threads));
+    const uint32_t width = 1u<<context->widthPow2;
+    const uint32_t plane = width<<context->heightPow2;
+    const uint32_t depth = 1u<<context->depthPow2;
+    mc_fft_3d_job_t job = {context, NULL, re, im, 1u, width, 0, 0};
+    mc_thread_run(pool, st_fft_3d_x, &job, (plane*depth)/(width*MC_FFT_3D_ROWS));
+    /** Y pencils: stride of row, one slab per plane; Z pencils: stride of plane, whole plane is one slab */
+    st_fft_3d_axis(context, pool, re, im, &context->y, width, depth, plane);
+    st_fft_3d_axis(context, pool, re, im, &context->z, plane, 1u, 0);
+}
+
+void mc_ifft_3d(const mc_fft_3d_t *context, mc_thread_pool_t *pool, float *re, float *im) {
+    /** Inverse FFT is FFT with swapped Re/Im of input and output */
+    mc_fft_3d(context, pool, im, re);
+}
+
+static uint32_t st_fft_3d_scratch_length(uint32_t widthPow2, uint32_t heightPow2, uint32_t depthPow2) {
+    /** Buffer of digit reverse, then tile of pencils (Re then Im) */
+    uint32_t power2 = (widthPow2 > heightPow2) ? widthPow2 : heightPow2;
+    power2 = (power2 > depthPow2) ? power2 : depthPow2;
+    return (uint32_t)(MC_GET_ALIGNED_SIZE(sizeof(float)*(MC_BUFFER_LENGTH(power2) + ((2u*MC_FFT_3D_TILE)<<power2)))
+                      / sizeof(float));
+}
+
+static size_t st_fft_3d_axis_size(uint32_t power2) {
+    return MC_FFT_GET_TABLES_SIZE(power2)
+           + MC_GET_ALIGNED_SIZE(sizeof(float)*(2u<<power2))
+           + MC_GET_ALIGNED_SIZE(sizeof(uint16_t)*(1u<<power2));
+}
+
+size_t mc_fft_3d_get_object_size(uint32_t widthPow2, uint32_t heightPow2, uint32_t depthPow2, uint32_t threads) {
+    MC_ASSERT((MC_MAX_FFT_POW2 >= widthPow2) && (MC_MIN_FFT_LENGTH <= (1u<<widthPow2)));
+    MC_ASSERT((MC_MAX_FFT_POW2 >= heightPow2) && (MC_MIN_FFT_LENGTH <= (1u<<heightPow2)));
+    MC_ASSERT((MC_MAX_FFT_POW2 >= depthPow2) && (MC_MIN_FFT_LENGTH <= (1u<<depthPow2)));
+    MC_ASSERT(MC_FFT_3D_MAX_POW2 >= (widthPow2 + heightPow2 + depthPow2));
+    MC_ASSERT((threads > 0) && (threads <= MC_THREAD_MAX));
+    return MC_MEM_ALIGNMENT 
+           + MC_FFT_GET_TABLES_SIZE(widthPow2) 
+           + st_fft_3d_axis_size(heightPow2)
+           + st_fft_3d_axis_size(depthPow2)
+           + (size_t)threads*sizeof(float)*st_fft_3d_scratch_length(widthPow2, heightPow2, depthPow2);
+}
+
+static uintptr_t st_fft_3d_axis_plan(mc_fft_3d_axis_t *axis, uint32_t power2, uintptr_t memory_addr) {
+    const uint32_t length = 1u<<power2;
+    const double phi = -2. * (double)MC_PI / (double)length;
+    memory_addr = mc_fft_create_tables(&axis->fft, power2, memory_addr);
+    axis->twiddle = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*2u*length);
+    axis->bitRev = (uint16_t*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(uint16_t)*length);
+    for (uint32_t k = 0; k < length; ++k) {
+        uint32_t rev = 0;
+        for (uint32_t b = 0; b < power2; ++b) {
+            rev |= ((k>>b) & 1u)<<(power2 - 1u - b);
+        }
+        axis->twiddle[k] = (float)cos(phi*(double)k);
+        axis->twiddle[length + k] = (float)sin(phi*(double)k);
+        axis->bitRev[k] = (uint16_t)rev;
+    }
+    return memory_addr;
+}
+
+void mc_fft_3d_create_object(mc_fft_3d_object_t *obj, uint32_t widthPow2, uint32_t heightPow2, uint32_t depthPow2, 
+                             uint32_t mode, uint32_t threads, void *memory, size_t memSize) {
+    MC_NULLPTR_ASSERT(obj);
+    MC_NULLPTR_ASSERT(memory);
+    MC_ASSERT((MC_FFT_3D_VERTICAL == mode) || (MC_FFT_3D_TRANSPOSE == mode));
+    MC_ASSERT(memSize >= mc_fft_3d_get_object_size(widthPow2, heightPow2, depthPow2, threads));
+    uintptr_t memory_addr = 0;
+    memset(&obj->context, 0, sizeof(obj->context));
+    obj->memory = memory;
+    obj->context.widthPow2 = widthPow2;
+    obj->context.heightPow2 = heightPow2;
+    obj->context.depthPow2 = depthPow2;
+    obj->context.mode = mode;
+    obj->context.threads = threads;
+    memory_addr = MC_GET_ALIGNED_PTR(obj->memory);
+    memory_addr = mc_fft_create_tables(&obj->context.x, widthPow2, memory_addr);
+    memory_addr = st_fft_3d_axis_plan(&obj->context.y, heightPow2, memory_addr);
+    memory_addr = st_fft_3d_axis_plan(&obj->context.z, depthPow2, memory_addr);
+    obj->context.scratchLength = st_fft_3d_scratch_length(widthPow2, heightPow2, depthPow2);
+    obj->context.scratch = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*threads*obj->context.scratchLength);
+    MC_ASSERT(memory_addr <= (uintptr_t)obj->memory+memSize);
+}
+
+#ifndef MC_EXCLUDE_MALLOC
+void mc_fft_3d_allocate(mc_fft_3d_object_t *obj, uint32_t widthPow2, uint32_t heightPow2, uint32_t depthPow2, 
+                        uint32_t mode, uint32_t threads) {
+    MC_NULLPTR_ASSERT(obj);
+    size_t memory_size = mc_fft_3d_get_object_size(widthPow2, heightPow2, depthPow2, threads);
+    mc_fft_3d_create_object(obj, widthPow2, heightPow2, depthPow2, mode, threads, malloc(memory_size), memory_size);
+}
+
+void mc_fft_3d_free(mc_fft_3d_object_t *obj) {
+    MC_NULLPTR_ASSERT(obj);
+    free(obj->memory);
+}
+#endif // EXCLUDE_MALLOC
@@ -0,0 +1,127 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MC_FFT_3D_H
+#define MC_FFT_3D_H
+
+#include "mcfft.h"
+/** Outside of extern "C": C++ build includes <atomic> */
+#include "mcfft_thread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** 3-D FFT of volume re/im[depth][height][width] (row-major, Re and Im in separate arrays), 
+ *  pencil decomposition, one pass per axis:
+ *  - X pencils (contiguous rows): mc_fft_mono() with per-thread buffer
+ *  - Y pencils (stride width) and Z pencils (stride height*width): tiles of adjacent pencils are
+ *    transformed by vertical radix-4 butterflies (MC_FFT_3D_VERTICAL, see mc_fft_columns_*())
+ *    or transposed by 8x8 blocks to scratch, transformed and transposed back (MC_FFT_3D_TRANSPOSE)
+ *  - Pencils of every axis are split to tasks of thread pool, every thread has its own scratch
+ */
+
+/** Y/Z passes with vertical butterflies over tiles of MC_FFT_3D_COLUMNS pencils */
+#define MC_FFT_3D_VERTICAL  (0u)
+/** Y/Z passes with cache-blocked transpose of tiles of 8 pencils */
+#define MC_FFT_3D_TRANSPOSE (1u)
+
+/** Pencils per task of vertical pass (one cache line, no false sharing between tasks) */
+#define MC_FFT_3D_COLUMNS (16u)
+/** Rows per task of X pass */
+#define MC_FFT_3D_ROWS (8u)
+
+/** Tables of Y/Z axis */
+typedef struct mc_fft_3d_axis_t {
+    mc_fft_t fft;           /* Tables of FFT of pencils (buffer is per thread) */
+    float *twiddle;         /* W_length^k, k < length (Re then Im) for vertical butterflies */
+    uint16_t *bitRev;       /* Bit reverse of index of pencil point */
+} mc_fft_3d_axis_t;
+
+/** 3-D FFT context with pre-calculated values and buffers required */
+typedef struct mc_fft_3d_t {
+    /** NOTE: All arrays in structure better to align by 64 bytes.
+     *        Use mc_fft_3d_allocate()/mc_fft_3d_create_object() if possible */
+    mc_fft_t x;             /* Tables of FFT of X pencils (buffer is per thread) */
+    mc_fft_3d_axis_t y;
+    mc_fft_3d_axis_t z;
+    float *scratch;         /* Per-thread scratch: buffer of digit reverse and tile of pencils */
+    uint32_t scratchLength; /* Number of scratch elements per thread */
+    uint32_t widthPow2;     /* length of X pencils */
+    uint32_t heightPow2;    /* length of Y pencils */
+    uint32_t depthPow2;     /* length of Z pencils */
+    uint32_t mode;          /* MC_FFT_3D_VERTICAL or MC_FFT_3D_TRANSPOSE */
+    uint32_t threads;       /* max number of threads */
+} mc_fft_3d_t;
+
+/** Forward 3-D FFT
+ * 
+ * @param context Pointer to 3-D FFT context
+ * @param pool Pointer to thread pool (NULL - caller's thread only), number of threads must be <= threads of context
+ * @param re Pointer to real part of volume [depth][height][width]
+ * @param im Pointer to imag part of volume [depth][height][width]
+ */
+void mc_fft_3d(const mc_fft_3d_t *context, mc_thread_pool_t *pool, float *re, float *im);
+
+/** Inverse 3-D FFT (see mc_fft_3d())
+ * 
+ * NOTE: don't forget to call mc_fft_norm() function after (length is width*height*depth)
+ */
+void mc_ifft_3d(const mc_fft_3d_t *context, mc_thread_pool_t *pool, float *re, float *im);
+
+/** Get 3-D FFT object size in bytes (see mc_fft_3d_create_object()) */
+size_t mc_fft_3d_get_object_size(uint32_t widthPow2, uint32_t heightPow2, uint32_t depthPow2, uint32_t threads);
+
+/** 3-D FFT object to control memory alignment and simplify allocation of memory (see mc_fft_3d_t) */
+typedef struct mc_fft_3d_object_t {
+    mc_fft_3d_t context;
+    void *memory;
+} mc_fft_3d_object_t;
+
+/** Create 3-D FFT object based on allocated memory (non-malloc API)
+ * 
+ * @param obj Pointer to user's structure where object will be created
+ * @param widthPow2 Power of 2 which reflects length of X pencils (5..MC_MAX_FFT_POW2)
+ * @param heightPow2 Power of 2 which reflects length of Y pencils (5..MC_MAX_FFT_POW2)
+ * @param depthPow2 Power of 2 which reflects length of Z pencils (5..MC_MAX_FFT_POW2)
+ * @param mode Y/Z passes: MC_FFT_3D_VERTICAL or MC_FFT_3D_TRANSPOSE
+ * @param threads Max number of threads (scratch is allocated per thread)
+ * @param memory Pointer to user's memory which used to create object
+ * @param memSize User's memory size in bytes (see mc_fft_3d_get_object_size())
+ */
+void mc_fft_3d_create_object(mc_fft_3d_object_t *obj, uint32_t widthPow2, uint32_t heightPow2, uint32_t depthPow2, 
+                             uint32_t mode, uint32_t threads, void *memory, size_t memSize);
+
+/** Allocate 3-D FFT object via malloc/free API (can be excluded by defining EXCLUDE_MALLOC macro) */
+void mc_fft_3d_allocate(mc_fft_3d_object_t *obj, uint32_t widthPow2, uint32_t heightPow2, uint32_t depthPow2, 
+                        uint32_t mode, uint32_t threads);
+
+/** Release 3-D FFT object via malloc/free API (can be excluded by defining EXCLUDE_MALLOC macro) */
+void mc_fft_3d_free(mc_fft_3d_object_t *obj);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MC_FFT_3D_H */
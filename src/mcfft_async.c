@@ -0,0 +1,258 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(_MSC_VER) && !defined(_POSIX_C_SOURCE)
+/** nanosleep() with strict -std=c11 */
+#define _POSIX_C_SOURCE 200809L
+#endif
+#include "mcfft_async.h"
+
+#ifndef MC_EXCLUDE_THREADS
+#include <time.h>
+#define MC_ASYNC_LOAD(var) atomic_load_explicit(&(var), memory_order_acquire)
+#define MC_ASYNC_STORE(var, value) atomic_store_explicit(&(var), (value), memory_order_release)
+#define MC_ASYNC_CAS(var, expected, value) atomic_compare_exchange_weak(&(var), &(expected), (value))
+#define MC_ASYNC_ADD(var, value) atomic_fetch_add(&(var), (value))
+#define MC_ASYNC_SUB(var, value) atomic_fetch_sub(&(var), (value))
+#else
+#define MC_ASYNC_LOAD(var) (var)
+#define MC_ASYNC_STORE(var, value) ((var) = (value))
+#define MC_ASYNC_CAS(var, expected, value) (((var) = (value)), 1)
+#define MC_ASYNC_ADD(var, value) (((var) += (value)) - (value))
+#define MC_ASYNC_SUB(var, value) (((var) -= (value)) + (value))
+#endif // MC_EXCLUDE_THREADS
+
+static void st_async_queue_init(mc_async_queue_t *queue, mc_async_cell_t *cells, uint32_t capacity) {
+    queue->cells = cells;
+    queue->mask = capacity - 1u;
+    for (uint32_t i = 0; i < capacity; ++i) {
+        MC_ASYNC_STORE(cells[i].sequence, i);
+    }
+    MC_ASYNC_STORE(queue->head, 0);
+    MC_ASYNC_STORE(queue->tail, 0);
+}
+
+/** Cell is free for push at position pos if sequence == pos, ready for pop if sequence == pos+1 */
+static mc_async_cell_t *st_async_queue_claim(mc_async_queue_t *queue, MC_ATOMIC_UINT *position, uint32_t ready) {
+    uint32_t pos = MC_ASYNC_LOAD(*position);
+    while (1) {
+        mc_async_cell_t *cell = &queue->cells[pos & queue->mask];
+        const int32_t diff = (int32_t)(MC_ASYNC_LOAD(cell->sequence) - (pos + ready));
+        if (0 == diff) {
+            if (MC_ASYNC_CAS(*position, pos, pos + 1u)) {
+                return cell;
+            }
+        } else if (diff < 0) {
+            /** Full for push, empty for pop */
+            return NULL;
+        } else {
+            pos = MC_ASYNC_LOAD(*position);
+        }
+    }
+}
+
+static uint32_t st_async_push(mc_async_queue_t *queue, const mc_batch_job_t *job, mc_async_callback_t callback, void *user) {
+    mc_async_cell_t *cell = st_async_queue_claim(queue, &queue->head, 0);
+    if (NULL == cell) {
+        return 0;
+    }
+    const uint32_t sequence = MC_ASYNC_LOAD(cell->sequence);
+    cell->job = *job;
+    cell->callback = callback;
+    cell->user = user;
+    MC_ASYNC_STORE(cell->sequence, sequence + 1u);
+    return 1u;
+}
+
+static uint32_t st_async_pop(mc_async_queue_t *queue, mc_batch_job_t *job, mc_async_callback_t *callback, void **user) {
+    mc_async_cell_t *cell = st_async_queue_claim(queue, &queue->tail, 1u);
+    if (NULL == cell) {
+        return 0;
+    }
+    const uint32_t sequence = MC_ASYNC_LOAD(cell->sequence);
+    *job = cell->job;
+    *callback = cell->callback;
+    *user = cell->user;
+    /** Free for push of the next round */
+    MC_ASYNC_STORE(cell->sequence, sequence + queue->mask);
+    return 1u;
+}
+
+uint32_t mc_async_submit(mc_async_t *context, const mc_batch_job_t *job, mc_async_callback_t callback, void *user) {
+    MC_NULLPTR_ASSERT(context);
+    MC_NULLPTR_ASSERT(job);
+    MC_NULLPTR_ASSERT(job->fft);
+    MC_ASSERT(context->pow2 >= job->fft->pow2);
+    MC_ASSERT((1u<<job->fft->pow2) == job->length);
+    /** Jobs in flight never exceed capacity: completion queue can't overflow (single consumer, see mc_async_poll()) */
+    if (MC_ASYNC_ADD(context->pending, 1u) >= context->capacity) {
+        (void)MC_ASYNC_SUB(context->pending, 1u);
+        return 0;
+    }
+    /** Cell of submission queue can still be held by worker which claimed it (job is counted as done by others) */
+    if (!st_async_push(&context->submitted, job, callback, user)) {
+        (void)MC_ASYNC_SUB(context->pending, 1u);
+        return 0;
+    }
+    return 1u;
+}
+
+uint32_t mc_async_poll(mc_async_t *context, void **user) {
+    MC_NULLPTR_ASSERT(context);
+    MC_NULLPTR_ASSERT(user);
+    mc_batch_job_t job;
+    mc_async_callback_t callback = NULL;
+    if (!st_async_pop(&context->completed, &job, &callback, user)) {
+        return 0;
+    }
+    (void)MC_ASYNC_SUB(context->pending, 1u);
+    return 1u;
+}
+
+uint32_t mc_async_pending(mc_async_t *context) {
+    MC_NULLPTR_ASSERT(context);
+    return MC_ASYNC_LOAD(context->pending);
+}
+
+static uint32_t st_async_process_one(mc_async_t *context, uint32_t thread) {
+    mc_batch_job_t job;
+    mc_async_callback_t callback = NULL;
+    void *user = NULL;
+    if (!st_async_pop(&context->submitted, &job, &callback, &user)) {
+        return 0;
+    }
+    mc_batch_job_execute(&job, &context->scratch[thread*context->scratchLength], context->scratchLength);
+    if (NULL != callback) {
+        callback(user, &job);
+        (void)MC_ASYNC_SUB(context->pending, 1u);
+    } else {
+        uint32_t isPushed = st_async_push(&context->completed, &job, NULL, user);
+        MC_ASSERT(isPushed);
+        (void)isPushed;
+    }
+    return 1u;
+}
+
+uint32_t mc_async_process(mc_async_t *context, uint32_t maxJobs) {
+    MC_NULLPTR_ASSERT(context);
+    uint32_t jobs = 0;
+    while ((jobs < maxJobs) && st_async_process_one(context, context->workers)) {
+        ++jobs;
+    }
+    return jobs;
+}
+
+#ifndef MC_EXCLUDE_THREADS
+typedef struct mc_async_worker_arg_t {
+    mc_async_t *context;
+    uint32_t thread;
+} mc_async_worker_arg_t;
+
+static void *st_async_worker(void *arg) {
+    mc_async_t *context = ((mc_async_worker_arg_t*)arg)->context;
+    const uint32_t thread = ((mc_async_worker_arg_t*)arg)->thread;
+    const struct timespec idle = {0, MC_ASYNC_IDLE_NS};
+    uint32_t spins = 0;
+    free(arg);
+    while (!MC_ASYNC_LOAD(context->stop)) {
+        if (st_async_process_one(context, thread)) {
+            spins = 0;
+        } else if (++spins >= MC_THREAD_SPIN_COUNT) {
+            nanosleep(&idle, NULL);
+        }
+    }
+    return NULL;
+}
+#endif // MC_EXCLUDE_THREADS
+
+size_t mc_async_get_object_size(uint32_t power2, uint32_t workers, uint32_t capacity) {
+    MC_ASSERT(MC_MAX_FFT_POW2 >= power2);
+    MC_ASSERT(workers <= MC_THREAD_MAX);
+    MC_ASSERT((capacity > 0) && (0 == (capacity & (capacity - 1u))));
+    return MC_MEM_ALIGNMENT 
+           + 2u*MC_GET_ALIGNED_SIZE(sizeof(mc_async_cell_t)*capacity)
+           + (workers + 1u)*MC_GET_ALIGNED_SIZE(sizeof(float)*MC_BUFFER_LENGTH(power2));
+}
+
+void mc_async_create_object(mc_async_object_t *obj, uint32_t power2, uint32_t workers, uint32_t capacity, 
+                            void *memory, size_t memSize) {
+    MC_NULLPTR_ASSERT(obj);
+    MC_NULLPTR_ASSERT(memory);
+    MC_ASSERT(memSize >= mc_async_get_object_size(power2, workers, capacity));
+    uintptr_t memory_addr = 0;
+    memset(&obj->context, 0, sizeof(obj->context));
+    obj->memory = memory;
+    obj->context.pow2 = power2;
+    obj->context.capacity = capacity;
+    memory_addr = MC_GET_ALIGNED_PTR(obj->memory);
+    st_async_queue_init(&obj->context.submitted, (mc_async_cell_t*)memory_addr, capacity);
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(mc_async_cell_t)*capacity);
+    st_async_queue_init(&obj->context.completed, (mc_async_cell_t*)memory_addr, capacity);
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(mc_async_cell_t)*capacity);
+    obj->context.scratchLength = (uint32_t)(MC_GET_ALIGNED_SIZE(sizeof(float)*MC_BUFFER_LENGTH(power2))/sizeof(float));
+    obj->context.scratch = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*(workers + 1u)*obj->context.scratchLength);
+    MC_ASSERT(memory_addr <= (uintptr_t)obj->memory+memSize);
+    MC_ASYNC_STORE(obj->context.pending, 0);
+    MC_ASYNC_STORE(obj->context.stop, 0);
+#ifndef MC_EXCLUDE_THREADS
+    for (uint32_t i = 0; i < workers; ++i) {
+        mc_async_worker_arg_t *arg = (mc_async_worker_arg_t*)malloc(sizeof(mc_async_worker_arg_t));
+        MC_NULLPTR_ASSERT(arg);
+        arg->context = &obj->context;
+        arg->thread = i;
+        if (0 != pthread_create(&obj->context.threads[i], NULL, st_async_worker, arg)) {
+            /** Continue with workers started so far */
+            free(arg);
+            break;
+        }
+        obj->context.workers = i + 1u;
+    }
+#endif // MC_EXCLUDE_THREADS
+}
+
+void mc_async_stop(mc_async_t *context) {
+    MC_NULLPTR_ASSERT(context);
+    MC_ASYNC_STORE(context->stop, 1u);
+#ifndef MC_EXCLUDE_THREADS
+    for (uint32_t i = 0; i < context->workers; ++i) {
+        pthread_join(context->threads[i], NULL);
+    }
+#endif // MC_EXCLUDE_THREADS
+    context->workers = 0;
+}
+
+#ifndef MC_EXCLUDE_MALLOC
+void mc_async_allocate(mc_async_object_t *obj, uint32_t power2, uint32_t workers, uint32_t capacity) {
+    MC_NULLPTR_ASSERT(obj);
+    size_t memory_size = mc_async_get_object_size(power2, workers, capacity);
+    mc_async_create_object(obj, power2, workers, capacity, malloc(memory_size), memory_size);
+}
+
+void mc_async_free(mc_async_object_t *obj) {
+    MC_NULLPTR_ASSERT(obj);
+    mc_async_stop(&obj->context);
+    free(obj->memory);
+}
+#endif // EXCLUDE_MALLOC
@@ -0,0 +1,160 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MC_FFT_ASYNC_H
+#define MC_FFT_ASYNC_H
+
+#include "mcfft_batch.h"
+/** Outside of extern "C": C++ build includes <atomic> */
+#include "mcfft_thread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Asynchronous execution of FFT/convolution jobs (see mc_batch_job_t) for latency-critical threads:
+ *  - mc_async_submit() and mc_async_poll() are wait-free for caller in common case: 
+ *    bounded lock-free queues (sequence per cell), no mutexes, no syscalls, no allocation
+ *  - Workers take jobs from submission queue, completion is reported by callback (on worker's thread)
+ *    or by completion queue (see mc_async_poll())
+ *  - Idle workers spin MC_THREAD_SPIN_COUNT iterations, then poll every MC_ASYNC_IDLE_NS: 
+ *    submitter never wakes workers up (no syscall in hot path)
+ *  - Jobs can be processed by user's threads as well (see mc_async_process()), 
+ *    it's the only way if threads are excluded (MC_EXCLUDE_THREADS)
+ */
+
+/** Sleep interval of idle worker in nanoseconds (max extra latency of job after idle period) */
+#define MC_ASYNC_IDLE_NS (50000u)
+
+/** Completion callback: called on worker's thread when job is done
+ * 
+ * @param user User's argument of job (see mc_async_submit())
+ * @param job Pointer to copy of job
+ */
+typedef void (*mc_async_callback_t)(void *user, const mc_batch_job_t *job);
+
+/** Cell of lock-free queue */
+typedef struct mc_async_cell_t {
+    MC_ATOMIC_UINT sequence;        /* position of cell in queue (ready to push/pop) */
+    mc_batch_job_t job;
+    mc_async_callback_t callback;
+    void *user;
+} mc_async_cell_t;
+
+/** Bounded multi-producer/multi-consumer lock-free queue */
+typedef struct mc_async_queue_t {
+    mc_async_cell_t *cells;
+    uint32_t mask;                  /* capacity - 1 */
+    MC_ATOMIC_UINT head;            /* push position */
+    uint8_t padding[MC_MEM_ALIGNMENT];  /* head and tail in different cache lines */
+    MC_ATOMIC_UINT tail;            /* pop position */
+} mc_async_queue_t;
+
+/** Asynchronous executor context */
+typedef struct mc_async_t {
+    /** NOTE: All arrays in structure better to align by 64 bytes.
+     *        Use mc_async_allocate()/mc_async_create_object() if possible */
+    mc_async_queue_t submitted;     /* jobs to be processed */
+    mc_async_queue_t completed;     /* done jobs without callback */
+    float *scratch;                 /* Per-thread buffer of digit reverse (workers then mc_async_process()) */
+    uint32_t scratchLength;         /* Number of scratch elements per thread */
+    uint32_t pow2;                  /* max length of FFT of jobs */
+    uint32_t capacity;              /* max number of jobs in flight (submitted and not polled) */
+    uint32_t workers;               /* number of worker threads */
+    MC_ATOMIC_UINT pending;         /* jobs in flight */
+    MC_ATOMIC_UINT stop;
+#ifndef MC_EXCLUDE_THREADS
+    pthread_t threads[MC_THREAD_MAX];
+#endif // MC_EXCLUDE_THREADS
+} mc_async_t;
+
+/** Submit job (lock-free, never blocks)
+ * 
+ * @param context Pointer to async context
+ * @param job Pointer to job (copied, arrays of job must stay valid until completion)
+ * @param callback Completion callback (NULL - completion is reported by mc_async_poll())
+ * @param user User's argument of callback/poll
+ * @return 1 if job is queued, 0 if capacity is exhausted or queue cell is not released by worker yet 
+ *         (poll completions and retry)
+ */
+uint32_t mc_async_submit(mc_async_t *context, const mc_batch_job_t *job, mc_async_callback_t callback, void *user);
+
+/** Take one completed job submitted without callback (lock-free, never blocks)
+ *  NOTE: single consumer: must not be called concurrently (released cell of completion queue is required 
+ *        before job leaves capacity)
+ * 
+ * @param context Pointer to async context
+ * @param user Pointer to user's argument of completed job (output)
+ * @return 1 if job is completed, 0 if there is no completed job
+ */
+uint32_t mc_async_poll(mc_async_t *context, void **user);
+
+/** Get number of jobs in flight (submitted and neither polled nor reported by callback) */
+uint32_t mc_async_pending(mc_async_t *context);
+
+/** Process submitted jobs on caller's thread (user's worker)
+ *  NOTE: must not be called concurrently (one scratch buffer is reserved for caller)
+ * 
+ * @param context Pointer to async context
+ * @param maxJobs Max number of jobs to be processed
+ * @return Number of processed jobs
+ */
+uint32_t mc_async_process(mc_async_t *context, uint32_t maxJobs);
+
+/** Get async object size in bytes (see mc_async_create_object()) */
+size_t mc_async_get_object_size(uint32_t power2, uint32_t workers, uint32_t capacity);
+
+/** Async object to control memory alignment and simplify allocation of memory (see mc_async_t) */
+typedef struct mc_async_object_t {
+    mc_async_t context;
+    void *memory;
+} mc_async_object_t;
+
+/** Create async object based on allocated memory (non-malloc API) and start workers
+ * 
+ * @param obj Pointer to user's structure where object will be created
+ * @param power2 Power of 2 which reflects max length of FFT of jobs
+ * @param workers Number of worker threads (0 - jobs are processed by mc_async_process() only,
+ *                workers are not started if threads are excluded)
+ * @param capacity Max number of jobs in flight (power of 2)
+ * @param memory Pointer to user's memory which used to create object
+ * @param memSize User's memory size in bytes (see mc_async_get_object_size())
+ */
+void mc_async_create_object(mc_async_object_t *obj, uint32_t power2, uint32_t workers, uint32_t capacity, 
+                            void *memory, size_t memSize);
+
+/** Stop and join workers (jobs in queue are not processed), must be called before memory is released */
+void mc_async_stop(mc_async_t *context);
+
+/** Allocate async object via malloc/free API and start workers (can be excluded by defining EXCLUDE_MALLOC macro) */
+void mc_async_allocate(mc_async_object_t *obj, uint32_t power2, uint32_t workers, uint32_t capacity);
+
+/** Stop workers and release async object via malloc/free API (can be excluded by defining EXCLUDE_MALLOC macro) */
+void mc_async_free(mc_async_object_t *obj);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MC_FFT_ASYNC_H */
@@ -0,0 +1,220 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "mcfft_batch.h"
+#include "generic/mcfft_generic.h"
+#include "x86/mcfft_avx.h"
+#include "aarch64/mcfft_neon.h"
+
+#ifndef MC_SELECTOR
+#define MC_SELECTOR g
+#endif
+
+#define MC_BATCH_QUEUE(head, tail) ((((uint64_t)(head))<<32u) | (uint64_t)(tail))
+#define MC_BATCH_HEAD(queue) ((uint32_t)((queue)>>32u))
+#define MC_BATCH_TAIL(queue) ((uint32_t)((queue) & 0xFFFFFFFFu))
+
+/** Estimated cost of job (butterflies) */
+static uint64_t st_batch_cost(const mc_batch_job_t *job) {
+    const uint64_t cost = (uint64_t)job->length*(job->fft->pow2 + 1u);
+    return (MC_BATCH_CONV == job->type) ? 2u*cost : cost;
+}
+
+void mc_batch_job_execute(const mc_batch_job_t *job, float *buffer, uint32_t bufLength) {
+    MC_NULLPTR_ASSERT(job);
+    MC_NULLPTR_ASSERT(job->fft);
+    MC_NULLPTR_ASSERT(buffer);
+    /** Plan is shared by threads: private buffer of digit reverse */
+    mc_fft_t fft = mc_fft_with_buffer(job->fft, buffer, bufLength);
+    switch (job->type) {
+        case MC_BATCH_FFT:
+            mc_fft_mono(&fft, job->re, job->im, job->length);
+            break;
+        case MC_BATCH_IFFT:
+            mc_ifft_mono(&fft, job->re, job->im, job->length);
+            break;
+        case MC_BATCH_CONV:
+            mc_fft_mono_scrambled(&fft, job->re, job->im, job->length);
+            MC_FUNC_CALL(spectrum_mul, MC_SELECTOR)(job->re, job->im, job->filterRe, job->filterIm, job->length);
+            mc_ifft_mono_scrambled(&fft, job->re, job->im, job->length);
+            break;
+        default:
+            MC_ASSERT(0);
+            break;
+    }
+}
+
+static void st_batch_execute(const mc_batch_t *context, const mc_batch_job_t *job, uint32_t thread) {
+    mc_batch_job_execute(job, &context->scratch[thread*context->scratchLength], context->scratchLength);
+}
+
+#ifndef MC_EXCLUDE_THREADS
+/** Owner takes job from the front of queue */
+static uint32_t st_batch_pop(mc_batch_t *context, uint32_t queue, uint32_t *index) {
+    uint64_t value = atomic_load(&context->queues[queue]);
+    while (MC_BATCH_HEAD(value) < MC_BATCH_TAIL(value)) {
+        if (atomic_compare_exchange_weak(&context->queues[queue], &value, 
+                                         MC_BATCH_QUEUE(MC_BATCH_HEAD(value) + 1u, MC_BATCH_TAIL(value)))) {
+            *index = MC_BATCH_HEAD(value);
+            return 1u;
+        }
+    }
+    return 0;
+}
+
+/** Thief takes job from the back of queue (far from owner) */
+static uint32_t st_batch_steal(mc_batch_t *context, uint32_t queue, uint32_t *index) {
+    uint64_t value = atomic_load(&context->queues[queue]);
+    while (MC_BATCH_HEAD(value) < MC_BATCH_TAIL(value)) {
+        if (atomic_compare_exchange_weak(&context->queues[queue], &value, 
+                                         MC_BATCH_QUEUE(MC_BATCH_HEAD(value), MC_BATCH_TAIL(value) - 1u))) {
+            *index = MC_BATCH_TAIL(value) - 1u;
+            return 1u;
+        }
+    }
+    return 0;
+}
+
+static void st_batch_task(void *arg, uint32_t queue, uint32_t thread) {
+    mc_batch_t *context = (mc_batch_t*)arg;
+    uint32_t index = 0;
+    MC_ASSERT(thread < context->threads);
+    while (st_batch_pop(context, queue, &index)) {
+        st_batch_execute(context, &context->jobs[index], thread);
+    }
+    /** Queues are never refilled during batch: pass without success means batch is done */
+    for (uint32_t stolen = 1u; stolen;) {
+        stolen = 0;
+        for (uint32_t i = 1u; i < context->threads; ++i) {
+            const uint32_t victim = (queue + i) % context->threads;
+            while (st_batch_steal(context, victim, &index)) {
+                st_batch_execute(context, &context->jobs[index], thread);
+                stolen = 1u;
+            }
+        }
+    }
+}
+#else
+static void st_batch_task(void *arg, uint32_t queue, uint32_t thread) {
+    mc_batch_t *context = (mc_batch_t*)arg;
+    MC_ASSERT(thread < context->threads);
+    for (uint32_t i = MC_BATCH_HEAD(context->queues[queue]); i < MC_BATCH_TAIL(context->queues[queue]); ++i) {
+        st_batch_execute(context, &context->jobs[i], thread);
+    }
+}
+#endif // MC_EXCLUDE_THREADS
+
+static void st_batch_split(mc_batch_t *context, const mc_batch_job_t *jobs, uint32_t count) {
+    uint64_t total = 0, sum = 0;
+    uint32_t head = 0;
+    for (uint32_t i = 0; i < count; ++i) {
+        MC_NULLPTR_ASSERT(jobs[i].fft);
+        MC_NULLPTR_ASSERT(jobs[i].re);
+        MC_NULLPTR_ASSERT(jobs[i].im);
+        MC_ASSERT((1u<<jobs[i].fft->pow2) == jobs[i].length);
+        MC_ASSERT(context->pow2 >= jobs[i].fft->pow2);
+        MC_ASSERT((MC_BATCH_CONV != jobs[i].type) || ((NULL != jobs[i].filterRe) && (NULL != jobs[i].filterIm)));
+        total += st_batch_cost(&jobs[i]);
+    }
+    /** Queue q ends where prefix cost reaches (q+1)/threads of total */
+    for (uint32_t q = 0; q < context->threads; ++q) {
+        const uint64_t bound = (total*(q + 1u))/context->threads;
+        uint32_t tail = head;
+        while ((tail < count) && ((sum < bound) || (q + 1u == context->threads))) {
+            sum += st_batch_cost(&jobs[tail]);
+            ++tail;
+        }
+#ifndef MC_EXCLUDE_THREADS
+        atomic_store(&context->queues[q], MC_BATCH_QUEUE(head, tail));
+#else
+        context->queues[q] = MC_BATCH_QUEUE(head, tail);
+#endif // MC_EXCLUDE_THREADS
+        head = tail;
+    }
+}
+
+void mc_batch_set_executor(mc_batch_t *context, mc_batch_executor_t executor, void *executorArg) {
+    MC_NULLPTR_ASSERT(context);
+    context->executor = executor;
+    context->executorArg = executorArg;
+}
+
+void mc_batch_run(mc_batch_t *context, mc_thread_pool_t *pool, const mc_batch_job_t *jobs, uint32_t count) {
+    MC_NULLPTR_ASSERT(context);
+    MC_ASSERT((0 == count) || (NULL != jobs));
+    MC_ASSERT((NULL == pool) || (pool->threads <= context->threads));
+    if (0 == count) {
+        return;
+    }
+    if ((NULL == pool) && (NULL == context->executor)) {
+        for (uint32_t i = 0; i < count; ++i) {
+            st_batch_execute(context, &jobs[i], 0);
+        }
+        return;
+    }
+    context->jobs = jobs;
+    st_batch_split(context, jobs, count);
+    if (NULL != pool) {
+        mc_thread_pool_run(pool, st_batch_task, context, context->threads);
+    } else {
+        context->executor(context->executorArg, st_batch_task, context, context->threads);
+    }
+    context->jobs = NULL;
+}
+
+void mc_batch_create_object(mc_batch_object_t *obj, uint32_t power2, uint32_t threads, void *memory, size_t memSize) {
+    MC_NULLPTR_ASSERT(obj);
+    MC_NULLPTR_ASSERT(memory);
+    MC_ASSERT(MC_MAX_FFT_POW2 >= power2);
+    MC_ASSERT((threads > 0) && (threads <= MC_THREAD_MAX));
+    MC_ASSERT(memSize >= MC_BATCH_GET_OBJECT_SIZE(power2, threads));
+    uintptr_t memory_addr = 0;
+    memset(&obj->context, 0, sizeof(obj->context));
+    obj->memory = memory;
+    obj->context.pow2 = power2;
+    obj->context.threads = threads;
+    obj->context.scratchLength = (uint32_t)(MC_GET_ALIGNED_SIZE(sizeof(float)*MC_BUFFER_LENGTH(power2))/sizeof(float));
+    memory_addr = MC_GET_ALIGNED_PTR(obj->memory);
+    obj->context.scratch = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*threads*obj->context.scratchLength);
+#ifndef MC_EXCLUDE_THREADS
+    for (uint32_t q = 0; q < MC_THREAD_MAX; ++q) {
+        atomic_init(&obj->context.queues[q], 0);
+    }
+#endif // MC_EXCLUDE_THREADS
+    MC_ASSERT(memory_addr <= (uintptr_t)obj->memory+memSize);
+}
+
+#ifndef MC_EXCLUDE_MALLOC
+void mc_batch_allocate(mc_batch_object_t *obj, uint32_t power2, uint32_t threads) {
+    MC_NULLPTR_ASSERT(obj);
+    size_t memory_size = MC_BATCH_GET_OBJECT_SIZE(power2, threads);
+    mc_batch_create_object(obj, power2, threads, malloc(memory_size), memory_size);
+}
+
+void mc_batch_free(mc_batch_object_t *obj) {
+    MC_NULLPTR_ASSERT(obj);
+    free(obj->memory);
+}
+#endif // EXCLUDE_MALLOC
@@ -0,0 +1,146 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MC_FFT_BATCH_H
+#define MC_FFT_BATCH_H
+
+#include "mcfft.h"
+/** Outside of extern "C": C++ build includes <atomic> */
+#include "mcfft_thread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Work-stealing scheduler of batch of independent FFT/convolution jobs (different plans and lengths):
+ *  - Jobs are split to contiguous ranges of equal estimated cost (length*log2(length)), one range per queue
+ *  - Every thread pops jobs from the front of its own queue, idle threads steal from the back of other queues
+ *  - Every thread has its own scratch buffer: mc_fft_t.buffer of plans is never used, 
+ *    so one plan can be shared by jobs running concurrently
+ *  - Threads are provided by mc_thread_pool_t or by user's executor (see mc_batch_executor_t)
+ *  - If threads are excluded (MC_EXCLUDE_THREADS) queues are executed without stealing
+ */
+
+/** Forward FFT of job (natural order, see mc_fft_mono()) */
+#define MC_BATCH_FFT  (0u)
+/** Inverse FFT of job (natural order, see mc_ifft_mono()), mc_fft_norm() is not applied */
+#define MC_BATCH_IFFT (1u)
+/** Circular convolution with filter spectrum: scrambled FFT, multiplication, scrambled inverse FFT */
+#define MC_BATCH_CONV (2u)
+
+/** Job of batch */
+typedef struct mc_batch_job_t {
+    const mc_fft_t *fft;        /* Plan of FFT (buffer is not used) */
+    float *re;                  /* Real part of signal, result in place */
+    float *im;                  /* Imag part of signal, result in place */
+    const float *filterRe;      /* MC_BATCH_CONV only: Re of filter spectrum in digit-reversed order 
+                                   (see mc_fft_scramble()) scaled by 1/length */
+    const float *filterIm;      /* MC_BATCH_CONV only: Im of filter spectrum (see filterRe) */
+    uint32_t length;            /* Length of signal (must be power of 2 and match plan) */
+    uint32_t type;              /* MC_BATCH_* */
+} mc_batch_job_t;
+
+/** User's executor of tasks (replaces mc_thread_pool_run()): 
+ *  must call task(arg, index, thread) for every index 0..tasks-1 and return when all tasks are done,
+ *  thread must be < threads of batch context and unique among concurrently running tasks
+ * 
+ * @param executor User's argument of executor (see mc_batch_set_executor())
+ * @param task Task function
+ * @param arg Argument of task
+ * @param tasks Number of tasks
+ */
+typedef void (*mc_batch_executor_t)(void *executor, mc_thread_task_t task, void *arg, uint32_t tasks);
+
+/** Batch scheduler context with per-thread scratch */
+typedef struct mc_batch_t {
+    /** NOTE: All arrays in structure better to align by 64 bytes.
+     *        Use mc_batch_allocate()/mc_batch_create_object() if possible */
+    float *scratch;                 /* Per-thread buffer of digit reverse */
+    uint32_t scratchLength;         /* Number of scratch elements per thread */
+    uint32_t pow2;                  /* max length of FFT of jobs */
+    uint32_t threads;               /* max number of threads (number of queues) */
+    mc_batch_executor_t executor;   /* user's executor (NULL - none) */
+    void *executorArg;
+    const mc_batch_job_t *jobs;     /* current batch */
+    MC_ATOMIC_ULLONG queues[MC_THREAD_MAX]; /* range of job indexes per queue: head<<32 | tail */
+} mc_batch_t;
+
+/** Execute one job on caller's thread with caller's buffer instead of buffer of plan
+ * 
+ * @param job Pointer to job
+ * @param buffer Buffer of digit reverse (not shared with concurrently running jobs)
+ * @param bufLength Number of buffer elements (must be >= MC_BUFFER_LENGTH(power2) of plan)
+ */
+void mc_batch_job_execute(const mc_batch_job_t *job, float *buffer, uint32_t bufLength);
+
+/** Set user's executor of batch (used by mc_batch_run() without pool)
+ * 
+ * @param context Pointer to batch context
+ * @param executor User's executor (NULL - caller's thread only)
+ * @param executorArg User's argument of executor
+ */
+void mc_batch_set_executor(mc_batch_t *context, mc_batch_executor_t executor, void *executorArg);
+
+/** Execute batch of jobs, returns when all jobs are done
+ *  NOTE: must not be called concurrently for the same context
+ * 
+ * @param context Pointer to batch context
+ * @param pool Pointer to thread pool (NULL - user's executor or caller's thread), 
+ *             number of threads must be <= threads of context
+ * @param jobs Array of jobs (length of every job must be <= 2^power2 of context)
+ * @param count Number of jobs
+ */
+void mc_batch_run(mc_batch_t *context, mc_thread_pool_t *pool, const mc_batch_job_t *jobs, uint32_t count);
+
+/** Get batch object size in bytes (see mc_batch_create_object()) */
+#define MC_BATCH_GET_OBJECT_SIZE(power2, threads) (MC_MEM_ALIGNMENT \
+        + (threads)*MC_GET_ALIGNED_SIZE(sizeof(float)*MC_BUFFER_LENGTH(power2)))
+
+/** Batch object to control memory alignment and simplify allocation of memory (see mc_batch_t) */
+typedef struct mc_batch_object_t {
+    mc_batch_t context;
+    void *memory;
+} mc_batch_object_t;
+
+/** Create batch object based on allocated memory (non-malloc API)
+ * 
+ * @param obj Pointer to user's structure where object will be created
+ * @param power2 Power of 2 which reflects max length of FFT of jobs
+ * @param threads Max number of threads (scratch is allocated per thread, 1..MC_THREAD_MAX)
+ * @param memory Pointer to user's memory which used to create object
+ * @param memSize User's memory size in bytes (see MC_BATCH_GET_OBJECT_SIZE())
+ */
+void mc_batch_create_object(mc_batch_object_t *obj, uint32_t power2, uint32_t threads, void *memory, size_t memSize);
+
+/** Allocate batch object via malloc/free API (can be excluded by defining EXCLUDE_MALLOC macro) */
+void mc_batch_allocate(mc_batch_object_t *obj, uint32_t power2, uint32_t threads);
+
+/** Release batch object via malloc/free API (can be excluded by defining EXCLUDE_MALLOC macro) */
+void mc_batch_free(mc_batch_object_t *obj);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MC_FFT_BATCH_H */
@@ -0,0 +1,153 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "mcfft_channelizer.h"
+#include "generic/mcfft_generic.h"
+#include "x86/mcfft_avx.h"
+#include "aarch64/mcfft_neon.h"
+#include <math.h>
+
+#ifndef MC_SELECTOR
+#define MC_SELECTOR g
+#endif
+
+void mc_channelizer_process(mc_channelizer_t *context, float * restrict outRe, float * restrict outIm, 
+                            const float * restrict inRe, const float * restrict inIm, uint32_t length) {
+    MC_NULLPTR_ASSERT(context);
+    MC_NULLPTR_ASSERT(outRe);
+    MC_NULLPTR_ASSERT(outIm);
+    MC_NULLPTR_ASSERT(inRe);
+    const uint32_t channels = 1u<<context->fft.pow2;
+    const uint32_t decimation = context->decimation;
+    const uint32_t window = context->taps*channels;
+    const uint32_t historyLength = 2u*window;
+    float *re = context->history;
+    float *im = &context->history[historyLength];
+    MC_ASSERT(0 == (length % decimation));
+    for (uint32_t frame = 0; frame < (length/decimation); ++frame) {
+        const float *srcRe = &inRe[frame*decimation];
+        const float *srcIm = (NULL != inIm) ? &inIm[frame*decimation] : NULL;
+        float *frameRe = &outRe[frame*channels];
+        float *frameIm = &outIm[frame*channels];
+        const uint32_t shift = context->shift;
+        if (context->position < decimation) {
+            /** The newest samples which remain in window are moved to the end of history */
+            const uint32_t keep = window - decimation;
+            memmove(&re[historyLength - keep], &re[context->position], sizeof(float)*keep);
+            memmove(&im[historyLength - keep], &im[context->position], sizeof(float)*keep);
+            context->position = historyLength - keep;
+        }
+        context->position -= decimation;
+        float *dstRe = &re[context->position];
+        float *dstIm = &im[context->position];
+        for (uint32_t i = 0; i < decimation; ++i) {
+            dstRe[i] = srcRe[decimation - 1u - i];
+            dstIm[i] = (NULL != srcIm) ? srcIm[decimation - 1u - i] : 0.f;
+        }
+        /** Branch k is written to (k - shift) mod K */
+        MC_FUNC_CALL(polyphase_mac, MC_SELECTOR)(frameRe, frameIm, &dstRe[shift], &dstIm[shift], &context->filter[shift], 
+                                                 channels, channels - shift, context->taps);
+        if (0 != shift) {
+            MC_FUNC_CALL(polyphase_mac, MC_SELECTOR)(&frameRe[channels - shift], &frameIm[channels - shift], dstRe, dstIm, 
+                                                     context->filter, channels, shift, context->taps);
+        }
+        mc_ifft_mono(&context->fft, frameRe, frameIm, channels);
+        context->shift = (shift + decimation) & (channels - 1u);
+    }
+}
+
+void mc_channelizer_reset(mc_channelizer_t *context) {
+    MC_NULLPTR_ASSERT(context);
+    const uint32_t window = context->taps*(1u<<context->fft.pow2);
+    memset(context->history, 0, sizeof(float)*4u*window);
+    context->position = window;
+    context->shift = 0;
+}
+
+void mc_channelizer_create_object(mc_channelizer_object_t *obj, uint32_t power2, uint32_t taps, uint32_t mode, 
+                                  const float *filter, void *memory, size_t memSize) {
+    MC_NULLPTR_ASSERT(obj);
+    MC_NULLPTR_ASSERT(memory);
+    MC_ASSERT(MC_MAX_FFT_LENGTH >= (1u<<power2));
+    MC_ASSERT((1u<<power2) >= MC_MIN_FFT_LENGTH);
+    MC_ASSERT(taps > 0);
+    MC_ASSERT(MC_CHANNELIZER_OVERSAMPLED >= mode);
+    uintptr_t memory_addr;
+    const uint32_t channels = 1u<<power2;
+    const uint32_t window = taps*channels;
+    memset(&obj->context, 0, sizeof(obj->context));
+    obj->memory = memory;
+    obj->context.taps = taps;
+    obj->context.decimation = (MC_CHANNELIZER_OVERSAMPLED == mode) ? (channels>>1u) : channels;
+    obj->context.fft.pow2 = power2;
+    memory_addr = MC_GET_ALIGNED_PTR(obj->memory);
+    obj->context.fft.buffer = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*MC_BUFFER_LENGTH(power2));
+    obj->context.fft.bufLength = MC_BUFFER_LENGTH(power2);
+    obj->context.fft.digitRev = (uint32_t*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(uint32_t)*MC_DIGIT_LENGTH(power2));
+    obj->context.fft.twiddle = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*MC_TWIDDLE_LENGTH(power2));
+    obj->context.filter = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*window);
+    obj->context.history = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*4u*window);
+    MC_ASSERT(memory_addr <= (uintptr_t)obj->memory+memSize);
+    mc_fft_get_digitRev(obj->context.fft.digitRev, MC_DIGIT_LENGTH(power2), power2);
+    mc_fft_get_twiddle(obj->context.fft.twiddle, MC_TWIDDLE_LENGTH(power2), power2);
+    mc_fft_plan(&obj->context.fft, MC_FFT_PLAN_ESTIMATE, NULL, NULL, channels);
+    if (NULL != filter) {
+        memcpy(obj->context.filter, filter, sizeof(float)*window);
+    } else {
+        const double center = 0.5*(double)(window - 1u);
+        double sum = 0;
+        for (uint32_t n = 0; n < window; ++n) {
+            const double x = (double)MC_PI*((double)n - center)/(double)channels;
+            const double phase = 2.*(double)MC_PI*(double)n/(double)(window - 1u);
+            const double value = ((0. != x) ? (sin(x)/x) : 1.)*(0.42 - 0.5*cos(phase) + 0.08*cos(2.*phase));
+            obj->context.filter[n] = (float)value;
+            sum += value;
+        }
+        for (uint32_t n = 0; n < window; ++n) {
+            obj->context.filter[n] = (float)((double)obj->context.filter[n]/sum);
+        }
+    }
+    mc_channelizer_reset(&obj->context);
+}
+
+#ifndef MC_EXCLUDE_MALLOC
+void mc_channelizer_allocate(mc_channelizer_object_t *obj, uint32_t power2, uint32_t taps, uint32_t mode, 
+                             const float *filter) {
+    MC_NULLPTR_ASSERT(obj);
+    MC_ASSERT(MC_MAX_FFT_LENGTH >= (1u<<power2));
+    MC_ASSERT((1u<<power2) >= MC_MIN_FFT_LENGTH);
+    size_t memory_size = MC_CHANNELIZER_GET_OBJECT_SIZE(power2, taps);
+    mc_channelizer_create_object(obj, power2, taps, mode, filter, malloc(memory_size), memory_size);
+}
+
+void mc_channelizer_free(mc_channelizer_object_t *obj) {
+    MC_NULLPTR_ASSERT(obj);
+    free(obj->memory);
+}
+#endif // EXCLUDE_MALLOC
@@ -0,0 +1,114 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MC_FFT_CHANNELIZER_H
+#define MC_FFT_CHANNELIZER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "mcfft.h"
+
+/** Polyphase filter bank channelizer of complex signal to K = 2^power2 channels with decimation D:
+ *  - y_m[t] = sum(h[n]*x[tD+D-1-n]*exp(-2j*pi*m*(tD-n)/K), n = 0..taps*K-1), channel m is centered at m/K*fs
+ *  - MC_CHANNELIZER_CRITICAL: D = K, MC_CHANNELIZER_OVERSAMPLED: D = K/2 (adjacent channels overlap by half)
+ *  - Branch sums of polyphase FIR are written directly to output frame (circular shift of oversampled mode is
+ *    folded into write position), inverse FFT of K points is done in place, one FFT plan is reused by all frames
+ *  - History of input is kept in reversed order (newest first), so every branch sum is contiguous for SIMD:
+ *    v[k] = sum(h[k + p*K]*r[k + p*K], p = 0..taps-1)
+ */
+
+/** Channelizer modes */
+#define MC_CHANNELIZER_CRITICAL    (0u)
+#define MC_CHANNELIZER_OVERSAMPLED (1u)
+
+/** Channelizer context with pre-calculated values and buffers required */
+typedef struct mc_channelizer_t {
+    /** NOTE: All arrays in structure better to align by 64 bytes.
+     *        Use mc_channelizer_allocate()/mc_channelizer_create_object() if possible */
+    mc_fft_t fft;           /* FFT context of K points */
+    float *filter;          /* Prototype low-pass filter h[n] (taps*K values) */
+    float *history;         /* Input history in reversed order (Re then Im, 2*taps*K values each) */
+    uint32_t position;      /* index of the newest sample in history */
+    uint32_t shift;         /* circular shift of branch sums: t*D mod K */
+    uint32_t decimation;    /* D */
+    uint32_t taps;          /* taps per branch */
+} mc_channelizer_t;
+
+/** Get channelizer object size in bytes if static/non-malloc allocation is required */
+#define MC_CHANNELIZER_GET_OBJECT_SIZE(power2, taps) (MC_FFT_GET_OBJECT_SIZE(power2) \
+                                                      + MC_GET_ALIGNED_SIZE(sizeof(float)*(taps)*(1u<<(power2))) \
+                                                      + MC_GET_ALIGNED_SIZE(sizeof(float)*4u*(taps)*(1u<<(power2))))
+
+/** Split input to channels, one frame of K channels is produced per D input samples
+ * 
+ * @param context Pointer to channelizer context
+ * @param outRe Pointer to real part of output frames [length/D][K]
+ * @param outIm Pointer to imag part of output frames [length/D][K]
+ * @param inRe Pointer to real part of input signal
+ * @param inIm Pointer to imag part of input signal (NULL for real signal)
+ * @param length Length of input signal (must be multiple of D)
+ */
+void mc_channelizer_process(mc_channelizer_t *context, float * restrict outRe, float * restrict outIm, 
+                            const float * restrict inRe, const float * restrict inIm, uint32_t length);
+
+/** Clear history of input (start of new stream)
+ * 
+ * @param context Pointer to channelizer context
+ */
+void mc_channelizer_reset(mc_channelizer_t *context);
+
+/** Channelizer object to control memory alignment and simplify allocation of memory (see mc_channelizer_t) */
+typedef struct mc_channelizer_object_t {
+    mc_channelizer_t context;
+    void *memory;
+} mc_channelizer_object_t;
+
+/** Create channelizer object based on allocated memory (non-malloc API)
+ * 
+ * @param obj Pointer to user's structure where object will be created
+ * @param power2 Power of 2 which reflects number of channels K
+ * @param taps Number of taps per branch (length of prototype filter is taps*K)
+ * @param mode MC_CHANNELIZER_CRITICAL or MC_CHANNELIZER_OVERSAMPLED
+ * @param filter Pointer to prototype filter (taps*K values, copied), 
+ *               NULL - Blackman windowed sinc with cut-off 1/(2K) and unit DC gain
+ * @param memory Pointer to user's memory which used to create object
+ * @param memSize User's memory size in bytes (see MC_CHANNELIZER_GET_OBJECT_SIZE(power2, taps))
+ */
+void mc_channelizer_create_object(mc_channelizer_object_t *obj, uint32_t power2, uint32_t taps, uint32_t mode, 
+                                  const float *filter, void *memory, size_t memSize);
+
+/** Allocate channelizer object via malloc/free API (can be excluded by defining EXCLUDE_MALLOC macro) */
+void mc_channelizer_allocate(mc_channelizer_object_t *obj, uint32_t power2, uint32_t taps, uint32_t mode, 
+                             const float *filter);
+
+/** Release channelizer object via malloc/free API (can be excluded by defining EXCLUDE_MALLOC macro) */
+void mc_channelizer_free(mc_channelizer_object_t *obj);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MC_FFT_CHANNELIZER_H */
@@ -0,0 +1,132 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "mcfft_conv.h"
+#include "generic/mcfft_generic.h"
+#include "x86/mcfft_avx.h"
+#include "aarch64/mcfft_neon.h"
+
+#ifndef MC_SELECTOR
+#define MC_SELECTOR g
+#endif
+
+void mc_conv_set_filter(mc_conv_t *context, const float *filter, uint32_t filterLength) {
+    MC_NULLPTR_ASSERT(context);
+    MC_NULLPTR_ASSERT(filter);
+    MC_ASSERT(filterLength > 0);
+    MC_ASSERT(MC_CONV_BLOCK_LENGTH(context->pow2) >= filterLength);
+    const uint32_t fftLength = 1u<<context->pow2;
+    const float norm_coeff = 1.f / (float)fftLength;
+    float *hRe = context->spectrum;
+    float *hIm = &context->spectrum[fftLength];
+    memset(context->spectrum, 0, sizeof(float)*MC_CONV_SPECTRUM_LENGTH(context->pow2));
+    for (uint32_t i = 0; i < filterLength; ++i) {
+        hRe[i] = filter[i] * norm_coeff;
+    }
+    /** Spectrum is left in digit-reversed order (the same order as DIF output of signal) */
+    MC_FUNC_CALL(fft_dif_mono_core, MC_SELECTOR)(hRe, hIm, context->twiddle, context->pow2);
+    context->filterLength = filterLength;
+}
+
+void mc_conv_reset(mc_conv_t *context) {
+    MC_NULLPTR_ASSERT(context);
+    memset(context->history, 0, sizeof(float)*MC_CONV_HISTORY_LENGTH(context->pow2));
+}
+
+void mc_conv_process(mc_conv_t *context, const float *in, float *out, uint32_t length) {
+    MC_NULLPTR_ASSERT(context);
+    MC_NULLPTR_ASSERT(in);
+    MC_NULLPTR_ASSERT(out);
+    const uint32_t fftLength = 1u<<context->pow2;
+    const uint32_t blockLength = MC_CONV_BLOCK_LENGTH(context->pow2);
+    float * restrict re = context->work;
+    float * restrict im = &context->work[fftLength];
+    MC_ASSERT(0 == (length % blockLength));
+    
+    while (length > 0) {
+        /** Re: [history | block0], Im: [block0 | block1] (or zeros if there is no block1) */
+        uint32_t isDual = (length >= 2u*blockLength);
+        memcpy(re, context->history, sizeof(float)*blockLength);
+        memcpy(&re[blockLength], in, sizeof(float)*blockLength);
+        if (isDual) {
+            memcpy(im, in, sizeof(float)*fftLength);
+            memcpy(context->history, &in[blockLength], sizeof(float)*blockLength);
+        } else {
+            memset(im, 0, sizeof(float)*fftLength);
+            memcpy(context->history, in, sizeof(float)*blockLength);
+        }
+        MC_FUNC_CALL(fft_dif_mono_core, MC_SELECTOR)(re, im, context->twiddle, context->pow2);
+        MC_FUNC_CALL(spectrum_mul, MC_SELECTOR)(re, im, context->spectrum, &context->spectrum[fftLength], fftLength);
+        MC_FUNC_CALL(ifft_dit_mono_core, MC_SELECTOR)(re, im, context->twiddle, context->pow2);
+        /** First half is wrapped around (circular convolution), second half is linear convolution */
+        memcpy(out, &re[blockLength], sizeof(float)*blockLength);
+        if (isDual) {
+            memcpy(&out[blockLength], &im[blockLength], sizeof(float)*blockLength);
+        }
+        in += (isDual ? fftLength : blockLength);
+        out += (isDual ? fftLength : blockLength);
+        length -= (isDual ? fftLength : blockLength);
+    }
+}
+
+void mc_conv_create_object(mc_conv_object_t *obj, uint32_t power2, const float *filter, uint32_t filterLength, 
+                           void *memory, size_t memSize) {
+    MC_NULLPTR_ASSERT(obj);
+    MC_NULLPTR_ASSERT(memory);
+    MC_ASSERT(MC_MAX_FFT_LENGTH >= (1u<<power2));
+    MC_ASSERT((1u<<power2) >= MC_MIN_FFT_LENGTH);
+    MC_ASSERT(memSize >= MC_CONV_GET_OBJECT_SIZE(power2));
+    uintptr_t memory_addr = 0;
+    memset(&obj->context, 0, sizeof(obj->context));
+    obj->memory = memory;
+    obj->context.pow2 = power2;
+    memory_addr = MC_GET_ALIGNED_PTR(obj->memory);
+    obj->context.twiddle = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*MC_TWIDDLE_LENGTH(power2));
+    obj->context.spectrum = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*MC_CONV_SPECTRUM_LENGTH(power2));
+    obj->context.work = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*MC_CONV_WORK_LENGTH(power2));
+    obj->context.history = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*MC_CONV_HISTORY_LENGTH(power2));
+    MC_ASSERT(memory_addr <= (uintptr_t)obj->memory+memSize);
+    mc_fft_get_twiddle(obj->context.twiddle, MC_TWIDDLE_LENGTH(power2), power2);
+    mc_conv_set_filter(&obj->context, filter, filterLength);
+    mc_conv_reset(&obj->context);
+}
+
+#ifndef MC_EXCLUDE_MALLOC
+void mc_conv_allocate(mc_conv_object_t *obj, uint32_t power2, const float *filter, uint32_t filterLength) {
+    MC_NULLPTR_ASSERT(obj);
+    MC_ASSERT(MC_MAX_FFT_LENGTH >= (1u<<power2));
+    MC_ASSERT((1u<<power2) >= MC_MIN_FFT_LENGTH);
+    size_t memory_size = MC_CONV_GET_OBJECT_SIZE(power2);
+    mc_conv_create_object(obj, power2, filter, filterLength, malloc(memory_size), memory_size);
+}
+
+void mc_conv_free(mc_conv_object_t *obj) {
+    MC_NULLPTR_ASSERT(obj);
+    free(obj->memory);
+}
+#endif // EXCLUDE_MALLOC
@@ -0,0 +1,129 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MC_FFT_CONV_H
+#define MC_FFT_CONV_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "mcfft.h"
+
+/** Streaming FIR convolver (overlap-save) of real signal with real filter:
+ *  - FFT length is 2^power2, block (hop) length is 2^(power2-1), filter length <= block length
+ *  - Filter spectrum is pre-scaled by 1/N (no mc_fft_norm() required)
+ *  - Forward FFT is DIF core, inverse FFT is DIT core: spectrum stays in digit-reversed order,
+ *    no digit reverse (shuffle) passes at all
+ *  - Two real blocks are processed by one complex FFT (Re/Im), filter is real so outputs don't mix
+ */
+
+/** Get the number of elements required for filter spectrum (see mc_conv_t) */
+#define MC_CONV_SPECTRUM_LENGTH(power2) ((1u<<((power2)+1u)))
+/** Get the number of elements required for work buffer (see mc_conv_t) */
+#define MC_CONV_WORK_LENGTH(power2) ((1u<<((power2)+1u)))
+/** Get the number of elements required for input history (see mc_conv_t) */
+#define MC_CONV_HISTORY_LENGTH(power2) ((1u<<((power2)-1u)))
+/** Get block length of convolver (see mc_conv_process()) */
+#define MC_CONV_BLOCK_LENGTH(power2) ((1u<<((power2)-1u)))
+
+/** Convolver context with pre-calculated values and buffers required */
+typedef struct mc_conv_t {
+    /** NOTE: All arrays in structure better to align by 64 bytes.
+     *        Use mc_conv_allocate()/mc_conv_create_object() if possible */
+    float *twiddle;         /* Number of twiddle elements must be == MC_TWIDDLE_LENGTH(power2) */
+    float *spectrum;        /* Filter spectrum (Re then Im) in digit-reversed order scaled by 1/N */
+    float *work;            /* Work buffer (Re then Im) */
+    float *history;         /* Tail of previous input block */
+    uint32_t pow2;          /* length of FFT */
+    uint32_t filterLength;  /* length of filter */
+} mc_conv_t;
+
+/** Set (or replace) filter of convolver, history of input is kept
+ * 
+ * @param context Pointer to convolver context
+ * @param filter Pointer to filter coefficients
+ * @param filterLength Length of filter (must be <= MC_CONV_BLOCK_LENGTH(power2))
+ */
+void mc_conv_set_filter(mc_conv_t *context, const float *filter, uint32_t filterLength);
+
+/** Reset input history of convolver (as if input was zero before) */
+void mc_conv_reset(mc_conv_t *context);
+
+/** Convolve next part of input stream with filter
+ * 
+ * @param context Pointer to convolver context
+ * @param in Pointer to input signal
+ * @param out Pointer to output signal (can be the same as in)
+ * @param length Length of signal (must be multiple of MC_CONV_BLOCK_LENGTH(power2))
+ * 
+ * NOTE: even number of blocks is the most efficient (odd block is processed by separate FFT)
+ */
+void mc_conv_process(mc_conv_t *context, const float *in, float *out, uint32_t length);
+
+/** Get convolver object size in bytes if static/non-malloc allocation is required */
+#define MC_CONV_GET_OBJECT_SIZE(power2) (MC_GET_ALIGNED_SIZE(sizeof(float)*MC_TWIDDLE_LENGTH(power2)) \
+                                         + MC_GET_ALIGNED_SIZE(sizeof(float)*MC_CONV_SPECTRUM_LENGTH(power2)) \
+                                         + MC_GET_ALIGNED_SIZE(sizeof(float)*MC_CONV_WORK_LENGTH(power2)) \
+                                         + MC_GET_ALIGNED_SIZE(sizeof(float)*MC_CONV_HISTORY_LENGTH(power2)) \
+                                         + MC_MEM_ALIGNMENT)
+
+/** Convolver object to control memory alignment and simplify allocation of memory (see mc_conv_t) */
+typedef struct mc_conv_object_t {
+    mc_conv_t context;
+    void *memory;
+} mc_conv_object_t;
+
+/** Create convolver object based on allocated memory (non-malloc API)
+ * 
+ * @param obj Pointer to user's structure where object will be created
+ * @param power2 Power of 2 which reflects required length of FFT
+ * @param filter Pointer to filter coefficients
+ * @param filterLength Length of filter (must be <= MC_CONV_BLOCK_LENGTH(power2))
+ * @param memory Pointer to user's memory which used to create object
+ * @param memSize User's memory size in bytes (see MC_CONV_GET_OBJECT_SIZE(power2))
+ */
+void mc_conv_create_object(mc_conv_object_t *obj, uint32_t power2, const float *filter, uint32_t filterLength, 
+                           void *memory, size_t memSize);
+
+/** Allocate convolver object via malloc/free API (can be excluded by defining EXCLUDE_MALLOC macro)
+ * 
+ * @param obj Pointer to user's structure where object will be created
+ * @param power2 Power of 2 which reflects required length of FFT
+ * @param filter Pointer to filter coefficients
+ * @param filterLength Length of filter (must be <= MC_CONV_BLOCK_LENGTH(power2))
+ */
+void mc_conv_allocate(mc_conv_object_t *obj, uint32_t power2, const float *filter, uint32_t filterLength);
+
+/** Release convolver object via malloc/free API (can be excluded by defining EXCLUDE_MALLOC macro)
+ * 
+ * @param obj Pointer to user's structure where object is created by mc_conv_allocate() function
+ */
+void mc_conv_free(mc_conv_object_t *obj);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MC_FFT_CONV_H */
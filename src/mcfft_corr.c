@@ -0,0 +1,122 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "mcfft_corr.h"
+#include "generic/mcfft_generic.h"
+#include "x86/mcfft_avx.h"
+#include "aarch64/mcfft_neon.h"
+
+#ifndef MC_SELECTOR
+#define MC_SELECTOR g
+#endif
+
+void mc_corr_cross(mc_corr_t *context, const float *x, const float *y, uint32_t length, float *out, uint32_t isPhat) {
+    MC_NULLPTR_ASSERT(context);
+    MC_NULLPTR_ASSERT(x);
+    MC_NULLPTR_ASSERT(y);
+    MC_NULLPTR_ASSERT(out);
+    const uint32_t fftLength = 1u<<context->pow2;
+    float * restrict re = context->work;
+    float * restrict im = &context->work[fftLength];
+    MC_ASSERT((length > 0) && (length <= fftLength));
+
+    memcpy(re, x, sizeof(float)*length);
+    memcpy(im, y, sizeof(float)*length);
+    memset(&re[length], 0, sizeof(float)*(fftLength - length));
+    memset(&im[length], 0, sizeof(float)*(fftLength - length));
+    MC_FUNC_CALL(fft_dif_mono_core, MC_SELECTOR)(re, im, context->twiddle, context->pow2);
+    MC_FUNC_CALL(spectrum_xcorr, MC_SELECTOR)(out, context->scratch, re, im, context->mirror, fftLength, 
+                                              isPhat, 1.f / (float)fftLength);
+    MC_FUNC_CALL(ifft_dit_mono_core, MC_SELECTOR)(out, context->scratch, context->twiddle, context->pow2);
+}
+
+void mc_corr_auto(mc_corr_t *context, const float *x, uint32_t length, float *out) {
+    mc_corr_cross(context, x, x, length, out, 0);
+}
+
+float mc_corr_find_peak(const float *corr, uint32_t length, uint32_t maxLag, float *peakValue) {
+    MC_NULLPTR_ASSERT(corr);
+    MC_ASSERT(maxLag < (length>>1u));
+    float posValue, negValue = 0.f;
+    int32_t lag = (int32_t)MC_FUNC_CALL(max_index, MC_SELECTOR)(corr, maxLag + 1u, &posValue);
+    if (maxLag > 0) {
+        uint32_t negIndex = MC_FUNC_CALL(max_index, MC_SELECTOR)(&corr[length - maxLag], maxLag, &negValue);
+        if (negValue > posValue) {
+            lag = (int32_t)negIndex - (int32_t)maxLag;
+            posValue = negValue;
+        }
+    }
+    /** Parabola through 3 neighbours (indices are circular) */
+    float ym1 = corr[(uint32_t)(lag - 1) & (length - 1u)];
+    float y0 = posValue;
+    float yp1 = corr[(uint32_t)(lag + 1) & (length - 1u)];
+    float denom = ym1 - 2.f*y0 + yp1;
+    float delta = (denom < 0.f) ? 0.5f*(ym1 - yp1)/denom : 0.f;
+    if (NULL != peakValue) {
+        *peakValue = y0 - 0.25f*(ym1 - yp1)*delta;
+    }
+    return (float)lag + delta;
+}
+
+void mc_corr_create_object(mc_corr_object_t *obj, uint32_t power2, void *memory, size_t memSize) {
+    MC_NULLPTR_ASSERT(obj);
+    MC_NULLPTR_ASSERT(memory);
+    MC_ASSERT(MC_MAX_FFT_LENGTH >= (1u<<power2));
+    MC_ASSERT((1u<<power2) >= MC_MIN_FFT_LENGTH);
+    MC_ASSERT(memSize >= MC_CORR_GET_OBJECT_SIZE(power2));
+    uintptr_t memory_addr = 0;
+    memset(&obj->context, 0, sizeof(obj->context));
+    obj->memory = memory;
+    obj->context.pow2 = power2;
+    memory_addr = MC_GET_ALIGNED_PTR(obj->memory);
+    obj->context.twiddle = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*MC_TWIDDLE_LENGTH(power2));
+    obj->context.mirror = (uint16_t*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(uint16_t)*MC_DIGIT_LENGTH(power2));
+    obj->context.work = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*MC_CORR_WORK_LENGTH(power2));
+    obj->context.scratch = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*(1u<<power2));
+    MC_ASSERT(memory_addr <= (uintptr_t)obj->memory+memSize);
+    mc_fft_get_twiddle(obj->context.twiddle, MC_TWIDDLE_LENGTH(power2), power2);
+    /** Work memory is used as temporary storage of digit maps */
+    uint32_t *digitRev = (uint32_t*)obj->context.work;
+    mc_fft_get_digitRev(digitRev, MC_DIGIT_LENGTH(power2), power2);
+    mc_fft_get_mirror(obj->context.mirror, digitRev, power2);
+}
+
+#ifndef MC_EXCLUDE_MALLOC
+void mc_corr_allocate(mc_corr_object_t *obj, uint32_t power2) {
+    MC_NULLPTR_ASSERT(obj);
+    MC_ASSERT(MC_MAX_FFT_LENGTH >= (1u<<power2));
+    MC_ASSERT((1u<<power2) >= MC_MIN_FFT_LENGTH);
+    size_t memory_size = MC_CORR_GET_OBJECT_SIZE(power2);
+    mc_corr_create_object(obj, power2, malloc(memory_size), memory_size);
+}
+
+void mc_corr_free(mc_corr_object_t *obj) {
+    MC_NULLPTR_ASSERT(obj);
+    free(obj->memory);
+}
+#endif // EXCLUDE_MALLOC
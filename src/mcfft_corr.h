@@ -0,0 +1,125 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MC_FFT_CORR_H
+#define MC_FFT_CORR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "mcfft.h"
+
+/** Cross-correlation (and GCC-PHAT) of real signals:
+ *  - Both signals are packed to one complex FFT (x is Re, y is Im), FFT length is 2^power2
+ *  - Forward FFT is DIF core, inverse FFT is DIT core: no digit reverse (shuffle) passes at all
+ *  - Spectrum split, conjugate multiply, optional PHAT weighting and 1/N scaling are one fused kernel
+ *  - Result is circular: r[t] = sum(x[n+t]*y[n]), lag t >= 0 is out[t], lag t < 0 is out[N+t].
+ *    Signals no longer than N/2 give linear correlation without wrap around
+ */
+
+/** Get the number of elements required for work buffer (see mc_corr_t) */
+#define MC_CORR_WORK_LENGTH(power2) ((1u<<((power2)+1u)))
+
+/** Correlator context with pre-calculated values and buffers required */
+typedef struct mc_corr_t {
+    /** NOTE: All arrays in structure better to align by 64 bytes.
+     *        Use mc_corr_allocate()/mc_corr_create_object() if possible */
+    float *twiddle;         /* Number of twiddle elements must be == MC_TWIDDLE_LENGTH(power2) */
+    uint16_t *mirror;       /* Mirror map of spectrum in digit-reversed order (see mc_fft_get_mirror()) */
+    float *work;            /* Work buffer (Re then Im) */
+    float *scratch;         /* Imaginary part of cross-spectrum */
+    uint32_t pow2;          /* length of FFT */
+} mc_corr_t;
+
+/** Cross-correlation of two real signals
+ * 
+ * @param context Pointer to correlator context
+ * @param x Pointer to the first signal
+ * @param y Pointer to the second signal (reference)
+ * @param length Length of signals (must be <= 2^power2, zero padded up to 2^power2)
+ * @param out Pointer to output correlation (length is 2^power2, see circular lags above)
+ * @param isPhat 0 - plain correlation, otherwise PHAT weighting (cross-spectrum is normalised by its magnitude)
+ */
+void mc_corr_cross(mc_corr_t *context, const float *x, const float *y, uint32_t length, float *out, uint32_t isPhat);
+
+/** Auto-correlation of real signal (out[0] is energy of signal)
+ * 
+ * @param context Pointer to correlator context
+ * @param x Pointer to signal
+ * @param length Length of signal (must be <= 2^power2, zero padded up to 2^power2)
+ * @param out Pointer to output correlation (length is 2^power2, see circular lags above)
+ */
+void mc_corr_auto(mc_corr_t *context, const float *x, uint32_t length, float *out);
+
+/** Find peak of circular correlation with parabolic interpolation
+ * 
+ * @param corr Pointer to correlation (output of mc_corr_cross()/mc_corr_auto())
+ * @param length Length of correlation (2^power2)
+ * @param maxLag Maximum absolute lag to search (must be < length/2)
+ * @param peakValue Pointer to store interpolated peak value (can be NULL)
+ * @return Signed fractional lag of peak
+ */
+float mc_corr_find_peak(const float *corr, uint32_t length, uint32_t maxLag, float *peakValue);
+
+/** Get correlator object size in bytes if static/non-malloc allocation is required */
+#define MC_CORR_GET_OBJECT_SIZE(power2) (MC_GET_ALIGNED_SIZE(sizeof(float)*MC_TWIDDLE_LENGTH(power2)) \
+                                         + MC_GET_ALIGNED_SIZE(sizeof(uint16_t)*MC_DIGIT_LENGTH(power2)) \
+                                         + MC_GET_ALIGNED_SIZE(sizeof(float)*MC_CORR_WORK_LENGTH(power2)) \
+                                         + MC_GET_ALIGNED_SIZE(sizeof(float)*(1u<<(power2))) \
+                                         + MC_MEM_ALIGNMENT)
+
+/** Correlator object to control memory alignment and simplify allocation of memory (see mc_corr_t) */
+typedef struct mc_corr_object_t {
+    mc_corr_t context;
+    void *memory;
+} mc_corr_object_t;
+
+/** Create correlator object based on allocated memory (non-malloc API)
+ * 
+ * @param obj Pointer to user's structure where object will be created
+ * @param power2 Power of 2 which reflects required length of FFT
+ * @param memory Pointer to user's memory which used to create object
+ * @param memSize User's memory size in bytes (see MC_CORR_GET_OBJECT_SIZE(power2))
+ */
+void mc_corr_create_object(mc_corr_object_t *obj, uint32_t power2, void *memory, size_t memSize);
+
+/** Allocate correlator object via malloc/free API (can be excluded by defining EXCLUDE_MALLOC macro)
+ * 
+ * @param obj Pointer to user's structure where object will be created
+ * @param power2 Power of 2 which reflects required length of FFT
+ */
+void mc_corr_allocate(mc_corr_object_t *obj, uint32_t power2);
+
+/** Release correlator object via malloc/free API (can be excluded by defining EXCLUDE_MALLOC macro)
+ * 
+ * @param obj Pointer to user's structure where object is created by mc_corr_allocate() function
+ */
+void mc_corr_free(mc_corr_object_t *obj);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MC_FFT_CORR_H */
@@ -0,0 +1,274 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "mcfft_dct.h"
+#include "generic/mcfft_generic.h"
+#include "x86/mcfft_avx.h"
+#include "aarch64/mcfft_neon.h"
+#include <math.h>
+
+#ifndef MC_SELECTOR
+#define MC_SELECTOR g
+#endif
+
+#define MC_DCT_SQRT_HALF (0.70710678118654752)
+
+static void st_dct_direct(const mc_dct_t *context, float *out, const float *in) {
+    const uint32_t length = 1u<<context->pow2;
+    for (uint32_t k = 0; k < length; ++k) {
+        const float *basis = &context->twiddle[k*length];
+        float acc = 0;
+        for (uint32_t n = 0; n < length; ++n) {
+            acc += basis[n]*in[n];
+        }
+        context->work[k] = acc;
+    }
+    memcpy(out, context->work, sizeof(float)*length);
+}
+
+static void st_dct_ii(const mc_dct_t *context, float *out, const float *in) {
+    /** z[m] = v[2m] + j*v[2m+1], v = {x[0], x[2], ..., x[3], x[1]}, Z = FFT(z):
+     *  c[k] = A[k]*Z[k] + B[k]*conj(Z[N/2-k]), X[k] = Re(c[k]), X[N-k] = -Im(c[k]) */
+    const uint32_t length = 1u<<context->pow2;
+    const uint32_t half = length>>1u;
+    float *re = context->work;
+    float *im = &context->work[half];
+    const float *tw = context->twiddle;
+    MC_FUNC_CALL(gather_signed, MC_SELECTOR)(context->work, in, context->index, length);
+    mc_fft_mono(&context->fft, re, im, half);
+    const float middle = (float)((re[0] - im[0])*MC_DCT_SQRT_HALF);
+    MC_FUNC_CALL(gather_signed, MC_SELECTOR)(&context->work[length], context->work, &context->index[2u*length], length);
+    MC_FUNC_CALL(spectrum_mul, MC_SELECTOR)(re, im, tw, &tw[half], half);
+    MC_FUNC_CALL(spectrum_mac, MC_SELECTOR)(re, im, &context->work[length], &context->work[length + half], 
+                                            &tw[length], &tw[length + half], half);
+    MC_FUNC_CALL(gather_signed, MC_SELECTOR)(out, context->work, &context->index[3u*length], length);
+    out[(MC_DST_II == context->type) ? (half - 1u) : half] = middle;
+}
+
+static void st_dct_iii(const mc_dct_t *context, float *out, const float *in) {
+    /** Inverse of DCT-II steps (scale N/2 is the scale of unnormalised IFFT):
+     *  Z[k] = A[k]*(X[k] - j*X[N-k]) + B[k]*(X[N/2-k] + j*X[N/2+k]), z = IFFT(Z) */
+    const uint32_t length = 1u<<context->pow2;
+    const uint32_t half = length>>1u;
+    float *re = context->work;
+    float *im = &context->work[half];
+    const float *tw = context->twiddle;
+    const uint32_t isSine = (MC_DST_III == context->type);
+    const float first = in[isSine ? (length - 1u) : 0];
+    const float middle = (float)(in[isSine ? (half - 1u) : half]/MC_DCT_SQRT_HALF);
+    MC_FUNC_CALL(gather_signed, MC_SELECTOR)(context->work, in, context->index, 2u*length);
+    MC_FUNC_CALL(spectrum_mul, MC_SELECTOR)(re, im, tw, &tw[half], half);
+    MC_FUNC_CALL(spectrum_mac, MC_SELECTOR)(re, im, &context->work[length], &context->work[length + half], 
+                                            &tw[length], &tw[length + half], half);
+    re[0] = 0.5f*(first + middle);
+    im[0] = 0.5f*(first - middle);
+    mc_ifft_mono(&context->fft, re, im, half);
+    MC_FUNC_CALL(gather_signed, MC_SELECTOR)(out, context->work, &context->index[3u*length], length);
+}
+
+static void st_dct_iv(const mc_dct_t *context, float *out, const float *in) {
+    /** z[m] = (x[2m] + j*x[N-1-2m])*A[m], c = FFT(z)*B: X[2k] = Re(c[k]), X[N-1-2k] = -Im(c[k]) */
+    const uint32_t length = 1u<<context->pow2;
+    const uint32_t half = length>>1u;
+    float *re = context->work;
+    float *im = &context->work[half];
+    const float *tw = context->twiddle;
+    MC_FUNC_CALL(gather_signed, MC_SELECTOR)(context->work, in, context->index, length);
+    MC_FUNC_CALL(spectrum_mul, MC_SELECTOR)(re, im, tw, &tw[half], half);
+    mc_fft_mono(&context->fft, re, im, half);
+    MC_FUNC_CALL(spectrum_mul, MC_SELECTOR)(re, im, &tw[length], &tw[length + half], half);
+    MC_FUNC_CALL(gather_signed, MC_SELECTOR)(out, context->work, &context->index[3u*length], length);
+}
+
+void mc_dct(const mc_dct_t *context, float *out, const float *in) {
+    MC_NULLPTR_ASSERT(context);
+    MC_NULLPTR_ASSERT(out);
+    MC_NULLPTR_ASSERT(in);
+    if ((1u<<context->fft.pow2) < MC_MIN_FFT_LENGTH) {
+        st_dct_direct(context, out, in);
+    } else if ((MC_DCT_II == context->type) || (MC_DST_II == context->type)) {
+        st_dct_ii(context, out, in);
+    } else if ((MC_DCT_III == context->type) || (MC_DST_III == context->type)) {
+        st_dct_iii(context, out, in);
+    } else {
+        st_dct_iv(context, out, in);
+    }
+}
+
+static double st_dct_basis(uint32_t type, uint32_t k, uint32_t n, uint32_t length) {
+    const double phi = (double)MC_PI/(double)(2u*length);
+    switch (type) {
+    case MC_DCT_II:
+        return cos(phi*(double)((2u*n + 1u)*k));
+    case MC_DCT_III:
+        return (0 == n) ? 0.5 : cos(phi*(double)(n*(2u*k + 1u)));
+    case MC_DST_II:
+        return sin(phi*(double)((2u*n + 1u)*(k + 1u)));
+    case MC_DST_III:
+        return ((length - 1u) == n) ? ((k & 1u) ? -0.5 : 0.5) : sin(phi*(double)((n + 1u)*(2u*k + 1u)));
+    case MC_DCT_IV:
+        return cos(0.5*phi*(double)((2u*n + 1u)*(2u*k + 1u)));
+    default:
+        return sin(0.5*phi*(double)((2u*n + 1u)*(2u*k + 1u)));
+    }
+}
+
+static uint16_t st_dct_even_odd(uint32_t j, uint32_t length) {
+    /** Sample of x stored at z[j] (Re then Im): v[n] = x[2n], v[N-1-n] = x[2n+1], z[m] = v[2m] + j*v[2m+1] */
+    const uint32_t half = length>>1u;
+    const uint32_t n = 2u*(j % half) + (j / half);
+    return (uint16_t)((n < half) ? (2u*n) : (2u*(length - 1u - n) + 1u));
+}
+
+static void st_dct_tables(mc_dct_t *context) {
+    const uint32_t length = 1u<<context->pow2;
+    const uint32_t half = length>>1u;
+    const uint32_t type = context->type;
+    const uint32_t isSine = (MC_DST_II == type) || (MC_DST_III == type) || (MC_DST_IV == type);
+    const double phi = (double)MC_PI/(double)(2u*length);
+    uint16_t *pre = context->index;
+    uint16_t *mirror = &context->index[2u*length];
+    uint16_t *post = &context->index[3u*length];
+    float *aRe = context->twiddle;
+    float *aIm = &context->twiddle[half];
+    float *bRe = &context->twiddle[length];
+    float *bIm = &context->twiddle[length + half];
+    memset(context->index, 0, sizeof(uint16_t)*4u*length);
+    if ((MC_DCT_II == type) || (MC_DST_II == type)) {
+        /** DST-II(x)[k] = DCT-II((-1)^n*x)[N-1-k] */
+        for (uint32_t j = 0; j < length; ++j) {
+            const uint16_t n = st_dct_even_odd(j, length);
+            pre[j] = (uint16_t)(n | ((isSine && (n & 1u)) ? MC_GATHER_NEGATE : 0));
+        }
+        for (uint32_t k = 0; k < half; ++k) {
+            mirror[k] = (uint16_t)((half - k) & (half - 1u));
+            mirror[half + k] = (uint16_t)((half + ((half - k) & (half - 1u))) | MC_GATHER_NEGATE);
+            post[isSine ? (length - 1u - k) : k] = (uint16_t)k;
+            if (0 != k) {
+                post[isSine ? (k - 1u) : (length - k)] = (uint16_t)((half + k) | MC_GATHER_NEGATE);
+            }
+            /** A = (W4N^k - j*W4N^5k)/2, B = (W4N^k + j*W4N^5k)/2 */
+            const double a = phi*(double)k;
+            const double b = phi*(double)(5u*k);
+            aRe[k] = (float)(0.5*(cos(a) - sin(b)));
+            aIm[k] = (float)(0.5*(-sin(a) - cos(b)));
+            bRe[k] = (float)(0.5*(cos(a) + sin(b)));
+            bIm[k] = (float)(0.5*(-sin(a) + cos(b)));
+        }
+    } else if ((MC_DCT_III == type) || (MC_DST_III == type)) {
+        /** DST-III(x)[k] = (-1)^k*DCT-III(reversed x)[k] */
+        for (uint32_t k = 1u; k < half; ++k) {
+            const uint32_t idx[4] = {k, length - k, half - k, half + k};
+            for (uint32_t i = 0; i < 4u; ++i) {
+                pre[i*half + k] = (uint16_t)(isSine ? (length - 1u - idx[i]) : idx[i]);
+            }
+            pre[half + k] |= MC_GATHER_NEGATE;
+        }
+        for (uint32_t j = 0; j < length; ++j) {
+            const uint16_t n = st_dct_even_odd(j, length);
+            post[n] = (uint16_t)(j | ((isSine && (n & 1u)) ? MC_GATHER_NEGATE : 0));
+        }
+        for (uint32_t k = 0; k < half; ++k) {
+            /** A = (1 + j*W_N^-k)*W4N^-k/2, B = (1 - j*W_N^-k)*W4N^(N/2-k)/2 */
+            const double w = 4.0*phi*(double)k + 0.5*(double)MC_PI;
+            const double a = -phi*(double)k;
+            const double b = phi*(double)(half - k);
+            aRe[k] = (float)(0.5*((1.0 + cos(w))*cos(a) + sin(w)*sin(a)));
+            aIm[k] = (float)(0.5*((1.0 + cos(w))*(-sin(a)) + sin(w)*cos(a)));
+            bRe[k] = (float)(0.5*((1.0 - cos(w))*cos(b) - sin(w)*sin(b)));
+            bIm[k] = (float)(0.5*((1.0 - cos(w))*(-sin(b)) - sin(w)*cos(b)));
+        }
+    } else {
+        /** DST-IV(x)[k] = (-1)^k*DCT-IV(reversed x)[k] */
+        for (uint32_t m = 0; m < half; ++m) {
+            pre[m] = (uint16_t)(isSine ? (length - 1u - 2u*m) : (2u*m));
+            pre[half + m] = (uint16_t)(isSine ? (2u*m) : (length - 1u - 2u*m));
+            post[2u*m] = (uint16_t)m;
+            post[length - 1u - 2u*m] = (uint16_t)((half + m) | (isSine ? 0 : MC_GATHER_NEGATE));
+            /** A = W8N^(4m+1), B = W2N^m */
+            aRe[m] = (float)cos(0.5*phi*(double)(4u*m + 1u));
+            aIm[m] = (float)-sin(0.5*phi*(double)(4u*m + 1u));
+            bRe[m] = (float)cos(2.0*phi*(double)m);
+            bIm[m] = (float)-sin(2.0*phi*(double)m);
+        }
+    }
+}
+
+void mc_dct_create_object(mc_dct_object_t *obj, uint32_t power2, uint32_t type, void *memory, size_t memSize) {
+    MC_NULLPTR_ASSERT(obj);
+    MC_NULLPTR_ASSERT(memory);
+    MC_ASSERT(MC_DST_IV >= type);
+    MC_ASSERT((2u*MC_MAX_FFT_LENGTH) >= (1u<<power2));
+    MC_ASSERT((1u<<power2) >= MC_MIN_FFT_LENGTH);
+    uintptr_t memory_addr;
+    const uint32_t length = 1u<<power2;
+    const uint32_t fftPow2 = power2 - 1u;
+    memset(&obj->context, 0, sizeof(obj->context));
+    obj->memory = memory;
+    obj->context.pow2 = power2;
+    obj->context.type = type;
+    obj->context.fft.pow2 = fftPow2;
+    memory_addr = MC_GET_ALIGNED_PTR(obj->memory);
+    obj->context.fft.buffer = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*MC_BUFFER_LENGTH(fftPow2));
+    obj->context.fft.bufLength = MC_BUFFER_LENGTH(fftPow2);
+    obj->context.fft.digitRev = (uint32_t*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(uint32_t)*MC_DIGIT_LENGTH(fftPow2));
+    obj->context.fft.twiddle = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*MC_TWIDDLE_LENGTH(fftPow2));
+    obj->context.twiddle = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*MC_DCT_TWIDDLE_LENGTH(power2));
+    obj->context.index = (uint16_t*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(uint16_t)*4u*length);
+    obj->context.work = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*2u*length);
+    MC_ASSERT(memory_addr <= (uintptr_t)obj->memory+memSize);
+    if ((length>>1u) < MC_MIN_FFT_LENGTH) {
+        for (uint32_t k = 0; k < length; ++k) {
+            for (uint32_t n = 0; n < length; ++n) {
+                obj->context.twiddle[k*length + n] = (float)st_dct_basis(type, k, n, length);
+            }
+        }
+    } else {
+        mc_fft_get_digitRev(obj->context.fft.digitRev, MC_DIGIT_LENGTH(fftPow2), fftPow2);
+        mc_fft_get_twiddle(obj->context.fft.twiddle, MC_TWIDDLE_LENGTH(fftPow2), fftPow2);
+        mc_fft_plan(&obj->context.fft, MC_FFT_PLAN_ESTIMATE, NULL, NULL, length>>1u);
+        st_dct_tables(&obj->context);
+    }
+}
+
+#ifndef MC_EXCLUDE_MALLOC
+void mc_dct_allocate(mc_dct_object_t *obj, uint32_t power2, uint32_t type) {
+    MC_NULLPTR_ASSERT(obj);
+    MC_ASSERT((2u*MC_MAX_FFT_LENGTH) >= (1u<<power2));
+    MC_ASSERT((1u<<power2) >= MC_MIN_FFT_LENGTH);
+    size_t memory_size = MC_DCT_GET_OBJECT_SIZE(power2);
+    mc_dct_create_object(obj, power2, type, malloc(memory_size), memory_size);
+}
+
+void mc_dct_free(mc_dct_object_t *obj) {
+    MC_NULLPTR_ASSERT(obj);
+    free(obj->memory);
+}
+#endif // EXCLUDE_MALLOC
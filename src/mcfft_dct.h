@@ -0,0 +1,111 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MC_FFT_DCT_H
+#define MC_FFT_DCT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "mcfft.h"
+
+/** DCT/DST of types II, III and IV of length N = 2^power2 via complex FFT of N/2 points:
+ *  - DCT-II:  X[k] = sum(x[n]*cos(pi*(2n+1)*k/2N))
+ *  - DCT-III: X[k] = x[0]/2 + sum(x[n]*cos(pi*n*(2k+1)/2N), n = 1..N-1)
+ *  - DCT-IV:  X[k] = sum(x[n]*cos(pi*(2n+1)*(2k+1)/4N))
+ *  - DST-II:  X[k] = sum(x[n]*sin(pi*(2n+1)*(k+1)/2N))
+ *  - DST-III: X[k] = (-1)^k*x[N-1]/2 + sum(x[n]*sin(pi*(n+1)*(2k+1)/2N), n = 0..N-2)
+ *  - DST-IV:  X[k] = sum(x[n]*sin(pi*(2n+1)*(2k+1)/4N))
+ *  - Transforms are not normalised: III(II(x)) = II(III(x)) = IV(IV(x)) = x*N/2
+ *  - Input permutation (even/odd samples to Re/Im), spectrum mirror and output permutation are signed gathers,
+ *    DST is DCT with reversed input/output and alternating signs folded into gather maps
+ *  - Pre/post twiddles of real-data symmetry are two complex multiplies (mc_spectrum_mul/mac)
+ *  - N/2 < MC_MIN_FFT_LENGTH: direct transform by pre-calculated basis
+ */
+
+/** Transform types */
+#define MC_DCT_II  (0u)
+#define MC_DCT_III (1u)
+#define MC_DCT_IV  (2u)
+#define MC_DST_II  (3u)
+#define MC_DST_III (4u)
+#define MC_DST_IV  (5u)
+
+/** Number of twiddle elements: pre/post multipliers or basis [N][N] of direct transform */
+#define MC_DCT_TWIDDLE_LENGTH(power2) (((1u<<(power2)) < (2u*MC_MIN_FFT_LENGTH)) ? (1u<<(2u*(power2))) : (2u<<(power2)))
+
+/** DCT context with pre-calculated values and buffers required */
+typedef struct mc_dct_t {
+    /** NOTE: All arrays in structure better to align by 64 bytes.
+     *        Use mc_dct_allocate()/mc_dct_create_object() if possible */
+    mc_fft_t fft;           /* FFT context of N/2 points (not used by direct transform) */
+    float *twiddle;         /* Multipliers A[k], B[k] (N/2 values each, Re then Im) or basis [N][N] */
+    uint16_t *index;        /* Gather maps (MSB - negate): input (2N), mirror of spectrum (N), output (N) */
+    float *work;            /* Work buffer (2N) */
+    uint32_t pow2;          /* N = 2^pow2 */
+    uint32_t type;          /* MC_DCT_* or MC_DST_* */
+} mc_dct_t;
+
+/** Get DCT object size in bytes if static/non-malloc allocation is required */
+#define MC_DCT_GET_OBJECT_SIZE(power2) (MC_FFT_GET_OBJECT_SIZE((power2)-1u) \
+                                        + MC_GET_ALIGNED_SIZE(sizeof(float)*MC_DCT_TWIDDLE_LENGTH(power2)) \
+                                        + MC_GET_ALIGNED_SIZE(sizeof(uint16_t)*(4u<<(power2))) \
+                                        + MC_GET_ALIGNED_SIZE(sizeof(float)*(2u<<(power2))))
+
+/** DCT/DST of type selected by context
+ * 
+ * @param context Pointer to DCT context
+ * @param out Pointer to output (N values, can be the same as input)
+ * @param in Pointer to input (N values)
+ */
+void mc_dct(const mc_dct_t *context, float *out, const float *in);
+
+/** DCT object to control memory alignment and simplify allocation of memory (see mc_dct_t) */
+typedef struct mc_dct_object_t {
+    mc_dct_t context;
+    void *memory;
+} mc_dct_object_t;
+
+/** Create DCT object based on allocated memory (non-malloc API)
+ * 
+ * @param obj Pointer to user's structure where object will be created
+ * @param power2 Power of 2 which reflects length of transform (MC_MIN_FFT_LENGTH <= N <= 2*MC_MAX_FFT_LENGTH)
+ * @param type Transform type (MC_DCT_* or MC_DST_*)
+ * @param memory Pointer to user's memory which used to create object
+ * @param memSize User's memory size in bytes (see MC_DCT_GET_OBJECT_SIZE(power2))
+ */
+void mc_dct_create_object(mc_dct_object_t *obj, uint32_t power2, uint32_t type, void *memory, size_t memSize);
+
+/** Allocate DCT object via malloc/free API (can be excluded by defining EXCLUDE_MALLOC macro) */
+void mc_dct_allocate(mc_dct_object_t *obj, uint32_t power2, uint32_t type);
+
+/** Release DCT object via malloc/free API (can be excluded by defining EXCLUDE_MALLOC macro) */
+void mc_dct_free(mc_dct_object_t *obj);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MC_FFT_DCT_H */
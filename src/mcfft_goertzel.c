@@ -0,0 +1,173 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "mcfft_goertzel.h"
+#include "generic/mcfft_generic.h"
+#include "x86/mcfft_avx.h"
+#include "aarch64/mcfft_neon.h"
+#include <math.h>
+
+#ifndef MC_SELECTOR
+#define MC_SELECTOR g
+#endif
+
+/** Bins are processed by vectors of 8 (AVX) or 4 (NEON) lanes, list is padded by zero coefficients */
+#define MC_GOERTZEL_BIN_LENGTH(binCount) (((binCount) + 7u) & ~7u)
+
+static uint32_t st_goertzel_get_method(uint32_t power2, uint32_t binCount, uint32_t method) {
+    if (MC_GOERTZEL_AUTO != method) {
+        return method;
+    }
+    const uint64_t length = 1u<<power2;
+    const uint64_t vectors = MC_GOERTZEL_BIN_LENGTH(binCount)>>3u;
+    /** Cost model (in units of ~0.1ns per point, measured on AVX):
+     *  recursion is latency bound, 20 per sample of a pass over 1-2 vectors of 8 bins, 6 per vector if 4 vectors hide latency,
+     *  FFT 3 per point and stage of radix-2 (twiddles, digit reverse and copy of input included), gather 12 per bin */
+    const uint64_t directCost = length*(6u*(vectors & ~3ull) + 20u*(((vectors & 3u) + 1u)>>1u));
+    const uint64_t fftCost = 3u*length*power2 + 12u*binCount;
+    return (directCost <= fftCost) ? MC_GOERTZEL_DIRECT : MC_GOERTZEL_FFT;
+}
+
+void mc_goertzel(const mc_goertzel_t *context, float * restrict outRe, float * restrict outIm, 
+                 const float * restrict inRe, const float * restrict inIm) {
+    MC_NULLPTR_ASSERT(context);
+    MC_NULLPTR_ASSERT(outRe);
+    MC_NULLPTR_ASSERT(outIm);
+    MC_NULLPTR_ASSERT(inRe);
+    const uint32_t length = 1u<<context->pow2;
+    const uint32_t binCount = context->binCount;
+    if (MC_GOERTZEL_FFT == context->method) {
+        float *re = context->work;
+        float *im = &context->work[length];
+        memcpy(re, inRe, sizeof(float)*length);
+        if (NULL != inIm) {
+            memcpy(im, inIm, sizeof(float)*length);
+        } else {
+            memset(im, 0, sizeof(float)*length);
+        }
+        mc_fft_mono(&context->fft, re, im, length);
+        for (uint32_t i = 0; i < binCount; ++i) {
+            outRe[i] = re[context->bins[i]];
+            outIm[i] = im[context->bins[i]];
+        }
+        return;
+    }
+    const uint32_t binLength = context->binLength;
+    float *re = context->work;
+    float *im = &context->work[binLength];
+    MC_FUNC_CALL(goertzel, MC_SELECTOR)(re, im, inRe, context->coeff, length, binLength);
+    if (NULL == inIm) {
+        memcpy(outRe, re, sizeof(float)*binCount);
+        memcpy(outIm, im, sizeof(float)*binCount);
+        return;
+    }
+    /** Linearity: X = G(re) + j*G(im) */
+    float *imRe = &context->work[2u*binLength];
+    float *imIm = &context->work[3u*binLength];
+    MC_FUNC_CALL(goertzel, MC_SELECTOR)(imRe, imIm, inIm, context->coeff, length, binLength);
+    for (uint32_t i = 0; i < binCount; ++i) {
+        outRe[i] = re[i] - imIm[i];
+        outIm[i] = im[i] + imRe[i];
+    }
+}
+
+size_t mc_goertzel_get_object_size(uint32_t power2, uint32_t binCount, uint32_t method) {
+    MC_ASSERT(MC_MAX_FFT_LENGTH >= (1u<<power2));
+    MC_ASSERT((1u<<power2) >= MC_MIN_FFT_LENGTH);
+    MC_ASSERT(binCount > 0);
+    MC_ASSERT(MC_GOERTZEL_FFT >= method);
+    const uint32_t binLength = MC_GOERTZEL_BIN_LENGTH(binCount);
+    size_t size = MC_GET_ALIGNED_SIZE(sizeof(uint32_t)*binCount) + MC_MEM_ALIGNMENT;
+    if (MC_GOERTZEL_FFT == st_goertzel_get_method(power2, binCount, method)) {
+        size += MC_FFT_GET_OBJECT_SIZE(power2) + MC_GET_ALIGNED_SIZE(sizeof(float)*(2u<<power2));
+    } else {
+        size += MC_GET_ALIGNED_SIZE(sizeof(float)*2u*binLength) + MC_GET_ALIGNED_SIZE(sizeof(float)*4u*binLength);
+    }
+    return size;
+}
+
+void mc_goertzel_create_object(mc_goertzel_object_t *obj, uint32_t power2, const uint32_t *bins, uint32_t binCount, 
+                               uint32_t method, void *memory, size_t memSize) {
+    MC_NULLPTR_ASSERT(obj);
+    MC_NULLPTR_ASSERT(bins);
+    MC_NULLPTR_ASSERT(memory);
+    MC_ASSERT(memSize >= mc_goertzel_get_object_size(power2, binCount, method));
+    const uint32_t length = 1u<<power2;
+    const uint32_t binLength = MC_GOERTZEL_BIN_LENGTH(binCount);
+    uintptr_t memory_addr;
+    memset(&obj->context, 0, sizeof(obj->context));
+    obj->memory = memory;
+    obj->context.pow2 = power2;
+    obj->context.binCount = binCount;
+    obj->context.binLength = binLength;
+    obj->context.method = st_goertzel_get_method(power2, binCount, method);
+    memory_addr = MC_GET_ALIGNED_PTR(obj->memory);
+    obj->context.bins = (uint32_t*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(uint32_t)*binCount);
+    for (uint32_t i = 0; i < binCount; ++i) {
+        MC_ASSERT(bins[i] < length);
+        obj->context.bins[i] = bins[i];
+    }
+    if (MC_GOERTZEL_FFT == obj->context.method) {
+        obj->context.fft.pow2 = power2;
+        obj->context.fft.buffer = (float*)memory_addr;
+        memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*MC_BUFFER_LENGTH(power2));
+        obj->context.fft.bufLength = MC_BUFFER_LENGTH(power2);
+        obj->context.fft.digitRev = (uint32_t*)memory_addr;
+        memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(uint32_t)*MC_DIGIT_LENGTH(power2));
+        obj->context.fft.twiddle = (float*)memory_addr;
+        memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*MC_TWIDDLE_LENGTH(power2));
+        obj->context.work = (float*)memory_addr;
+        memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*2u*length);
+        MC_ASSERT(memory_addr <= (uintptr_t)obj->memory+memSize);
+        mc_fft_get_digitRev(obj->context.fft.digitRev, MC_DIGIT_LENGTH(power2), power2);
+        mc_fft_get_twiddle(obj->context.fft.twiddle, MC_TWIDDLE_LENGTH(power2), power2);
+        mc_fft_plan(&obj->context.fft, MC_FFT_PLAN_ESTIMATE, NULL, NULL, length);
+        return;
+    }
+    obj->context.coeff = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*2u*binLength);
+    obj->context.work = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*4u*binLength);
+    MC_ASSERT(memory_addr <= (uintptr_t)obj->memory+memSize);
+    const double phi = 2. * (double)MC_PI / (double)length;
+    for (uint32_t i = 0; i < binLength; ++i) {
+        obj->context.coeff[i] = (i < binCount) ? (float)cos(phi*(double)bins[i]) : 0.f;
+        obj->context.coeff[binLength + i] = (i < binCount) ? (float)sin(phi*(double)bins[i]) : 0.f;
+    }
+}
+
+#ifndef MC_EXCLUDE_MALLOC
+void mc_goertzel_allocate(mc_goertzel_object_t *obj, uint32_t power2, const uint32_t *bins, uint32_t binCount, 
+                          uint32_t method) {
+    MC_NULLPTR_ASSERT(obj);
+    size_t memory_size = mc_goertzel_get_object_size(power2, binCount, method);
+    mc_goertzel_create_object(obj, power2, bins, binCount, method, malloc(memory_size), memory_size);
+}
+
+void mc_goertzel_free(mc_goertzel_object_t *obj) {
+    MC_NULLPTR_ASSERT(obj);
+    free(obj->memory);
+}
+#endif // EXCLUDE_MALLOC
@@ -0,0 +1,105 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MC_FFT_GOERTZEL_H
+#define MC_FFT_GOERTZEL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "mcfft.h"
+
+/** Selected-bin DFT of a block of N = 2^power2 samples for an arbitrary list of bins (e.g. DTMF, pilot tones)
+ *  - MC_GOERTZEL_DIRECT: Goertzel recursion s[n] = x[n] + 2cos(w)*s[n-1] - s[n-2], X[k] = exp(jw)*s[N-1] - s[N-2],
+ *    w = 2*pi*k/N, O(N) per bin, SIMD lanes run different bins over the same input sample
+ *  - MC_GOERTZEL_FFT: full mc_fft_mono() and gather of requested bins, O(N*log2(N)) for any number of bins
+ *  - MC_GOERTZEL_AUTO: the cheapest method for real input is chosen by cost model (see mc_goertzel_create_object())
+ *  - Error of recursion grows for bins near 0 and N/2 (poles near z = 1), FFT is more accurate there
+ */
+
+/** Selected-bin DFT methods */
+#define MC_GOERTZEL_AUTO   (0u)
+#define MC_GOERTZEL_DIRECT (1u)
+#define MC_GOERTZEL_FFT    (2u)
+
+/** Selected-bin DFT context with pre-calculated values and buffers required */
+typedef struct mc_goertzel_t {
+    /** NOTE: All arrays in structure better to align by 64 bytes.
+     *        Use mc_goertzel_allocate()/mc_goertzel_create_object() if possible */
+    mc_fft_t fft;           /* FFT context (MC_GOERTZEL_FFT only) */
+    uint32_t *bins;         /* Requested bins */
+    float *coeff;           /* cos(w), sin(w) of requested bins padded to vector length (MC_GOERTZEL_DIRECT only) */
+    float *work;            /* Work buffer (Re then Im) */
+    uint32_t pow2;          /* length of block */
+    uint32_t binCount;      /* number of requested bins */
+    uint32_t binLength;     /* number of bins padded to vector length */
+    uint32_t method;        /* MC_GOERTZEL_DIRECT or MC_GOERTZEL_FFT */
+} mc_goertzel_t;
+
+/** Selected-bin DFT of one block
+ * 
+ * @param context Pointer to selected-bin DFT context
+ * @param outRe Pointer to real part of spectrum (binCount bins in order of bin list)
+ * @param outIm Pointer to imag part of spectrum (binCount bins in order of bin list)
+ * @param inRe Pointer to real part of signal (N samples)
+ * @param inIm Pointer to imag part of signal (N samples, NULL for real signal)
+ */
+void mc_goertzel(const mc_goertzel_t *context, float * restrict outRe, float * restrict outIm, 
+                 const float * restrict inRe, const float * restrict inIm);
+
+/** Selected-bin DFT object to control memory alignment and simplify allocation of memory (see mc_goertzel_t) */
+typedef struct mc_goertzel_object_t {
+    mc_goertzel_t context;
+    void *memory;
+} mc_goertzel_object_t;
+
+/** Get selected-bin DFT object size in bytes if static/non-malloc allocation is required (depends on method) */
+size_t mc_goertzel_get_object_size(uint32_t power2, uint32_t binCount, uint32_t method);
+
+/** Create selected-bin DFT object based on allocated memory (non-malloc API)
+ * 
+ * @param obj Pointer to user's structure where object will be created
+ * @param power2 Power of 2 which reflects length of block N
+ * @param bins Pointer to list of requested bins (0 <= bin < N, copied)
+ * @param binCount Number of requested bins
+ * @param method MC_GOERTZEL_AUTO, MC_GOERTZEL_DIRECT or MC_GOERTZEL_FFT
+ * @param memory Pointer to user's memory which used to create object
+ * @param memSize User's memory size in bytes (see mc_goertzel_get_object_size())
+ */
+void mc_goertzel_create_object(mc_goertzel_object_t *obj, uint32_t power2, const uint32_t *bins, uint32_t binCount, 
+                               uint32_t method, void *memory, size_t memSize);
+
+/** Allocate selected-bin DFT object via malloc/free API (can be excluded by defining EXCLUDE_MALLOC macro) */
+void mc_goertzel_allocate(mc_goertzel_object_t *obj, uint32_t power2, const uint32_t *bins, uint32_t binCount, 
+                          uint32_t method);
+
+/** Release selected-bin DFT object via malloc/free API (can be excluded by defining EXCLUDE_MALLOC macro) */
+void mc_goertzel_free(mc_goertzel_object_t *obj);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MC_FFT_GOERTZEL_H */
@@ -0,0 +1,128 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "mcfft_image.h"
+
+MC_STATIC_ASSERT(64u == sizeof(mc_fft_image_header_t));
+
+size_t mc_fft_export_image(const mc_fft_t *context, void *memory, size_t memSize) {
+    MC_NULLPTR_ASSERT(context);
+    MC_NULLPTR_ASSERT(context->twiddle);
+    MC_NULLPTR_ASSERT(context->digitRev);
+    MC_ASSERT(MC_MAX_FFT_LENGTH >= (1u<<context->pow2));
+    MC_ASSERT((1u<<context->pow2) >= MC_MIN_FFT_LENGTH);
+    size_t imageSize = MC_FFT_GET_IMAGE_SIZE(context->pow2);
+    if (NULL == memory) {
+        return imageSize;
+    }
+    MC_ASSERT(memSize >= imageSize);
+    MC_ASSERT(MC_GET_ALIGNED_PTR(memory) == (uintptr_t)memory);
+    mc_fft_image_header_t *header = (mc_fft_image_header_t*)memory;
+    memset(memory, 0, imageSize);
+    header->magic = MC_FFT_IMAGE_MAGIC;
+    header->version = MC_FFT_IMAGE_VERSION;
+    header->libVersion = MC_FFT_VERSION;
+    header->compactTwiddle = MC_COMPACT_TWIDDLE;
+    header->pow2 = context->pow2;
+    header->pipeline = context->pipeline;
+    header->imageSize = (uint32_t)imageSize;
+    header->twiddleOffset = (uint32_t)MC_GET_ALIGNED_SIZE(sizeof(mc_fft_image_header_t));
+    header->digitRevOffset = header->twiddleOffset + (uint32_t)MC_GET_ALIGNED_SIZE(sizeof(float)*MC_TWIDDLE_LENGTH(context->pow2));
+    memcpy((uint8_t*)memory + header->twiddleOffset, context->twiddle, sizeof(float)*MC_TWIDDLE_LENGTH(context->pow2));
+    memcpy((uint8_t*)memory + header->digitRevOffset, context->digitRev, sizeof(uint32_t)*MC_DIGIT_LENGTH(context->pow2));
+    return imageSize;
+}
+
+uint32_t mc_fft_attach_image(mc_fft_t *context, const void *image, size_t imageSize, float *buffer, uint32_t bufLength) {
+    MC_NULLPTR_ASSERT(context);
+    MC_NULLPTR_ASSERT(image);
+    MC_NULLPTR_ASSERT(buffer);
+    MC_ASSERT(MC_GET_ALIGNED_PTR(image) == (uintptr_t)image);
+    const mc_fft_image_header_t *header = (const mc_fft_image_header_t*)image;
+    if ((imageSize < sizeof(mc_fft_image_header_t)) || (MC_FFT_IMAGE_MAGIC != header->magic) ||
+        (MC_FFT_IMAGE_VERSION != header->version) || (MC_FFT_VERSION != header->libVersion) ||
+        (MC_COMPACT_TWIDDLE != header->compactTwiddle) || (MC_MAX_FFT_POW2 < header->pow2) ||
+        (MC_MIN_FFT_LENGTH > (1u<<header->pow2)) || (MC_FFT_PIPELINE_COUNT <= header->pipeline)) {
+        return 0;
+    }
+    /** Offsets are checked instead of trusted (image can be corrupted/truncated file) */
+    if ((MC_FFT_GET_IMAGE_SIZE(header->pow2) != header->imageSize) || (imageSize < header->imageSize) ||
+        (0 != (header->twiddleOffset % MC_MEM_ALIGNMENT)) || (0 != (header->digitRevOffset % MC_MEM_ALIGNMENT)) ||
+        (header->twiddleOffset < sizeof(mc_fft_image_header_t)) || (header->digitRevOffset < sizeof(mc_fft_image_header_t)) ||
+        ((header->twiddleOffset + sizeof(float)*MC_TWIDDLE_LENGTH(header->pow2)) > header->imageSize) ||
+        ((header->digitRevOffset + sizeof(uint32_t)*MC_DIGIT_LENGTH(header->pow2)) > header->imageSize) ||
+        (MC_BUFFER_LENGTH(header->pow2) > bufLength)) {
+        return 0;
+    }
+    memset(context, 0, sizeof(*context));
+    /** NOTE: tables are never written by FFT functions, const is dropped only to match mc_fft_t */
+    context->twiddle = (float*)((const uint8_t*)image + header->twiddleOffset);
+    context->digitRev = (uint32_t*)((const uint8_t*)image + header->digitRevOffset);
+    context->buffer = buffer;
+    context->bufLength = bufLength;
+    context->pow2 = header->pow2;
+    context->pipeline = header->pipeline;
+    return 1u;
+}
+
+#ifndef MC_EXCLUDE_FILE_IO
+#ifndef MC_EXCLUDE_MALLOC
+uint32_t mc_fft_export_image_to_file(const mc_fft_t *context, const char *path) {
+    MC_NULLPTR_ASSERT(context);
+    MC_NULLPTR_ASSERT(path);
+    size_t imageSize = mc_fft_export_image(context, NULL, 0);
+    uint32_t isWritten = 0;
+    void *memory = malloc(imageSize + MC_MEM_ALIGNMENT);
+    if (NULL != memory) {
+        void *image = (void*)MC_GET_ALIGNED_PTR(memory);
+        (void)mc_fft_export_image(context, image, imageSize);
+        isWritten = mc_file_write(path, image, imageSize);
+        free(memory);
+    }
+    return isWritten;
+}
+#endif // MC_EXCLUDE_MALLOC
+
+uint32_t mc_fft_open_image_file(mc_fft_image_object_t *obj, const char *path, float *buffer, uint32_t bufLength) {
+    MC_NULLPTR_ASSERT(obj);
+    MC_NULLPTR_ASSERT(path);
+    memset(obj, 0, sizeof(*obj));
+    obj->image = mc_file_map(path, &obj->imageSize);
+    if (NULL == obj->image) {
+        return 0;
+    }
+    if ((MC_GET_ALIGNED_PTR(obj->image) != (uintptr_t)obj->image) || 
+        (0 == mc_fft_attach_image(&obj->context, obj->image, obj->imageSize, buffer, bufLength))) {
+        mc_fft_close_image_file(obj);
+        return 0;
+    }
+    return 1u;
+}
+
+void mc_fft_close_image_file(mc_fft_image_object_t *obj) {
+    MC_NULLPTR_ASSERT(obj);
+    mc_file_unmap(obj->image, obj->imageSize);
+    memset(obj, 0, sizeof(*obj));
+}
+#endif // MC_EXCLUDE_FILE_IO
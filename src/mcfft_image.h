@@ -0,0 +1,122 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MC_FFT_IMAGE_H
+#define MC_FFT_IMAGE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "mcfft.h"
+
+/** Plan image is serialized read-only part of FFT context (twiddle factors & digit reverse map):
+ *  - Position-independent: header keeps offsets from the beginning of image, not pointers
+ *  - Tables are aligned by MC_MEM_ALIGNMENT inside image (image itself must be aligned as well, mmap is)
+ *  - mc_fft_mono()/mc_ifft_mono() use tables directly from image (no copy), so processes which
+ *    mmap the same image file share one page-cache copy of tables. Only buffer is per-context
+ * 
+ * Image is rejected if it was created by another library version or twiddle layout (MC_COMPACT_TWIDDLE)
+ * NOTE: Image uses native byte order
+ */
+
+/** Plan image magic: 'MCFI' */
+#define MC_FFT_IMAGE_MAGIC (0x4946434Du)
+/** Plan image format version */
+#define MC_FFT_IMAGE_VERSION (1u)
+
+/** Plan image header (offsets are in bytes from the beginning of image) */
+typedef struct mc_fft_image_header_t {
+    uint32_t magic;             /* MC_FFT_IMAGE_MAGIC */
+    uint32_t version;           /* MC_FFT_IMAGE_VERSION */
+    uint32_t libVersion;        /* MC_FFT_VERSION */
+    uint32_t compactTwiddle;    /* MC_COMPACT_TWIDDLE */
+    uint32_t pow2;              /* length of FFT */
+    uint32_t pipeline;          /* MC_FFT_PIPELINE_* flags chosen by planner */
+    uint32_t imageSize;         /* Size of whole image */
+    uint32_t twiddleOffset;     /* MC_TWIDDLE_LENGTH(pow2) x float */
+    uint32_t digitRevOffset;    /* MC_DIGIT_LENGTH(pow2) x uint32_t */
+    uint32_t reserved[7];
+} mc_fft_image_header_t;
+
+/** Get plan image size in bytes */
+#define MC_FFT_GET_IMAGE_SIZE(power2) (MC_GET_ALIGNED_SIZE(sizeof(mc_fft_image_header_t)) \
+                                       + MC_GET_ALIGNED_SIZE(sizeof(float)*MC_TWIDDLE_LENGTH(power2)) \
+                                       + MC_GET_ALIGNED_SIZE(sizeof(uint32_t)*MC_DIGIT_LENGTH(power2)))
+
+/** Export read-only part of FFT context to plan image
+ * 
+ * @param context Pointer to context with pre-calculated values (see mc_fft_create_object())
+ * @param memory Pointer to user's memory (must be aligned by MC_MEM_ALIGNMENT), can be NULL to get required size
+ * @param memSize Size of user's memory in bytes (see MC_FFT_GET_IMAGE_SIZE(power2))
+ * @return Number of bytes written (required if memory is NULL)
+ */
+size_t mc_fft_export_image(const mc_fft_t *context, void *memory, size_t memSize);
+
+/** Attach plan image to FFT context (tables are used in-place, image must outlive context)
+ * 
+ * @param context Pointer to user's context to be initialised
+ * @param image Pointer to plan image (must be aligned by MC_MEM_ALIGNMENT)
+ * @param imageSize Size of plan image in bytes
+ * @param buffer Pointer to user's buffer (see mc_fft_t.buffer)
+ * @param bufLength Number of buffer elements (see MC_BUFFER_LENGTH(power2))
+ * @return 1 if image is valid and attached, 0 otherwise
+ */
+uint32_t mc_fft_attach_image(mc_fft_t *context, const void *image, size_t imageSize, float *buffer, uint32_t bufLength);
+
+#ifndef MC_EXCLUDE_FILE_IO
+/** FFT context attached to mapped plan image file */
+typedef struct mc_fft_image_object_t {
+    mc_fft_t context;
+    const void *image;
+    size_t imageSize;
+} mc_fft_image_object_t;
+
+#ifndef MC_EXCLUDE_MALLOC
+/** Export plan image to file (can be excluded by defining EXCLUDE_MALLOC macro, use mc_fft_export_image() instead)
+ * 
+ * @return 1 if file is written, 0 otherwise
+ */
+uint32_t mc_fft_export_image_to_file(const mc_fft_t *context, const char *path);
+#endif // MC_EXCLUDE_MALLOC
+
+/** Map plan image file (mmap if supported) and attach it to FFT context
+ * 
+ * @param obj Pointer to user's structure where object will be created
+ * @param path Path to plan image file
+ * @param buffer Pointer to user's buffer (see mc_fft_t.buffer)
+ * @param bufLength Number of buffer elements (see MC_BUFFER_LENGTH(power2))
+ * @return 1 if image is valid and attached, 0 otherwise
+ */
+uint32_t mc_fft_open_image_file(mc_fft_image_object_t *obj, const char *path, float *buffer, uint32_t bufLength);
+
+/** Unmap plan image file (see mc_fft_open_image_file()) */
+void mc_fft_close_image_file(mc_fft_image_object_t *obj);
+#endif // MC_EXCLUDE_FILE_IO
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MC_FFT_IMAGE_H */
@@ -0,0 +1,176 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "mcfft_mdct.h"
+#include "generic/mcfft_generic.h"
+#include "x86/mcfft_avx.h"
+#include "aarch64/mcfft_neon.h"
+#include <math.h>
+
+#ifndef MC_SELECTOR
+#define MC_SELECTOR g
+#endif
+
+void mc_mdct(const mc_mdct_t *context, float *out, const float *in) {
+    MC_NULLPTR_ASSERT(context);
+    MC_NULLPTR_ASSERT(out);
+    MC_NULLPTR_ASSERT(in);
+    const uint32_t length = 1u<<context->pow2;
+    const uint32_t quarter = length>>2u;
+    const uint32_t eighth = length>>3u;
+    /** Fold (a, b, c, d) -> (-c_r - d, a - b_r), z[m] = u[2m] + j*u[M-1-2m]: 
+     *  m < N/8 reads c/d (Re) and a/b (Im), m >= N/8 reads a/b (Re) and c/d (Im) */
+    const uint32_t offsetLow[4] = {3u*quarter, 3u*quarter - 1u, quarter, quarter - 1u};
+    const uint32_t offsetHigh[4] = {0, 2u*quarter - 1u, 2u*quarter, length - 1u};
+    float *re = context->work;
+    float *im = &context->work[quarter];
+    MC_FUNC_CALL(mdct_fold, MC_SELECTOR)(re, im, in, context->fold, offsetLow, eighth);
+    MC_FUNC_CALL(mdct_fold, MC_SELECTOR)(&re[eighth], &im[eighth], in, &context->fold[6u*eighth], offsetHigh, eighth);
+    mc_fft_mono(&context->fft, re, im, quarter);
+    MC_FUNC_CALL(mdct_unfold, MC_SELECTOR)(out, re, im, context->rotation, quarter);
+}
+
+void mc_imdct(mc_mdct_t *context, float *out, const float *in) {
+    MC_NULLPTR_ASSERT(context);
+    MC_NULLPTR_ASSERT(out);
+    MC_NULLPTR_ASSERT(in);
+    const uint32_t length = 1u<<context->pow2;
+    const uint32_t half = length>>1u;
+    const uint32_t quarter = length>>2u;
+    /** DCT-IV: z[m] = X[2m] + j*X[M-1-2m], then unfold of DCT-IV output u to frame y by gather */
+    const uint32_t offset[4] = {0, half - 1u, 0, half - 1u};
+    float *re = context->work;
+    float *im = &context->work[quarter];
+    float *u = &context->work[half];
+    float *y = &context->work[length];
+    MC_FUNC_CALL(mdct_fold, MC_SELECTOR)(re, im, in, context->unfold, offset, quarter);
+    mc_fft_mono(&context->fft, re, im, quarter);
+    MC_FUNC_CALL(mdct_unfold, MC_SELECTOR)(u, re, im, context->rotation, quarter);
+    MC_FUNC_CALL(gather_signed, MC_SELECTOR)(y, u, context->index, length);
+    MC_FUNC_CALL(mdct_overlap, MC_SELECTOR)(out, context->overlap, y, context->window, half);
+}
+
+void mc_mdct_reset(mc_mdct_t *context) {
+    MC_NULLPTR_ASSERT(context);
+    memset(context->overlap, 0, sizeof(float)*(1u<<(context->pow2 - 1u)));
+}
+
+static void st_mdct_fold_table(float *coeff, const float *window, const uint32_t *offset, const float *sign, 
+                               uint32_t first, uint32_t count, uint32_t length) {
+    /** coeff = {sign*w[f0+2m], sign*w[r1-2m], sign*w[f2+2m], sign*w[r3-2m], rotRe, rotIm}, rotation W_8M^(4m+1), length = M */
+    const double phi = -(double)MC_PI/(double)(4u*length);
+    for (uint32_t m = 0; m < count; ++m) {
+        coeff[m] = sign[0]*((NULL != window) ? window[offset[0] + 2u*m] : 1.f);
+        coeff[count + m] = sign[1]*((NULL != window) ? window[offset[1] - 2u*m] : 1.f);
+        coeff[2u*count + m] = sign[2]*((NULL != window) ? window[offset[2] + 2u*m] : 1.f);
+        coeff[3u*count + m] = sign[3]*((NULL != window) ? window[offset[3] - 2u*m] : 1.f);
+        coeff[4u*count + m] = (float)cos(phi*(double)(4u*(first + m) + 1u));
+        coeff[5u*count + m] = (float)sin(phi*(double)(4u*(first + m) + 1u));
+    }
+}
+
+void mc_mdct_create_object(mc_mdct_object_t *obj, uint32_t power2, const float *window, void *memory, size_t memSize) {
+    MC_NULLPTR_ASSERT(obj);
+    MC_NULLPTR_ASSERT(memory);
+    MC_ASSERT((4u*MC_MAX_FFT_LENGTH) >= (1u<<power2));
+    MC_ASSERT((1u<<power2) >= (4u*MC_MIN_FFT_LENGTH));
+    uintptr_t memory_addr;
+    const uint32_t length = 1u<<power2;
+    const uint32_t half = length>>1u;
+    const uint32_t quarter = length>>2u;
+    const uint32_t eighth = length>>3u;
+    const uint32_t fftPow2 = power2 - 2u;
+    memset(&obj->context, 0, sizeof(obj->context));
+    obj->memory = memory;
+    obj->context.pow2 = power2;
+    obj->context.fft.pow2 = fftPow2;
+    memory_addr = MC_GET_ALIGNED_PTR(obj->memory);
+    obj->context.fft.buffer = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*MC_BUFFER_LENGTH(fftPow2));
+    obj->context.fft.bufLength = MC_BUFFER_LENGTH(fftPow2);
+    obj->context.fft.digitRev = (uint32_t*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(uint32_t)*MC_DIGIT_LENGTH(fftPow2));
+    obj->context.fft.twiddle = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*MC_TWIDDLE_LENGTH(fftPow2));
+    obj->context.fold = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*12u*eighth);
+    obj->context.unfold = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*6u*quarter);
+    obj->context.rotation = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*half);
+    obj->context.window = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*length);
+    obj->context.index = (uint16_t*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(uint16_t)*length);
+    obj->context.overlap = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*half);
+    obj->context.work = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*2u*length);
+    MC_ASSERT(memory_addr <= (uintptr_t)obj->memory+memSize);
+    mc_fft_get_digitRev(obj->context.fft.digitRev, MC_DIGIT_LENGTH(fftPow2), fftPow2);
+    mc_fft_get_twiddle(obj->context.fft.twiddle, MC_TWIDDLE_LENGTH(fftPow2), fftPow2);
+    mc_fft_plan(&obj->context.fft, MC_FFT_PLAN_ESTIMATE, NULL, NULL, quarter);
+    for (uint32_t n = 0; n < length; ++n) {
+        obj->context.window[n] = (NULL != window) ? window[n] : (float)sin((double)MC_PI*((double)n + 0.5)/(double)length);
+    }
+    {
+        const uint32_t offsetLow[4] = {3u*quarter, 3u*quarter - 1u, quarter, quarter - 1u};
+        const uint32_t offsetHigh[4] = {0, half - 1u, half, length - 1u};
+        const uint32_t offset[4] = {0, half - 1u, 0, half - 1u};
+        const float signLow[4] = {-1.f, -1.f, -1.f, 1.f};
+        const float signHigh[4] = {1.f, -1.f, -1.f, -1.f};
+        const float scale = 2.f/(float)half;
+        const float signUnfold[4] = {scale, 0, 0, scale};
+        st_mdct_fold_table(obj->context.fold, obj->context.window, offsetLow, signLow, 0, eighth, half);
+        st_mdct_fold_table(&obj->context.fold[6u*eighth], obj->context.window, offsetHigh, signHigh, eighth, eighth, half);
+        st_mdct_fold_table(obj->context.unfold, NULL, offset, signUnfold, 0, quarter, half);
+    }
+    for (uint32_t k = 0; k < quarter; ++k) {
+        obj->context.rotation[k] = (float)cos(2.*(double)MC_PI*(double)k/(double)length);
+        obj->context.rotation[quarter + k] = (float)-sin(2.*(double)MC_PI*(double)k/(double)length);
+    }
+    /** Unfold of DCT-IV output u: y = (u_h, -u_h_r, -u_l_r, -u_l), u = (u_l, u_h) */
+    for (uint32_t n = 0; n < quarter; ++n) {
+        obj->context.index[n] = (uint16_t)(quarter + n);
+        obj->context.index[quarter + n] = (uint16_t)((half - 1u - n) | MC_GATHER_NEGATE);
+        obj->context.index[half + n] = (uint16_t)((quarter - 1u - n) | MC_GATHER_NEGATE);
+        obj->context.index[3u*quarter + n] = (uint16_t)(n | MC_GATHER_NEGATE);
+    }
+    mc_mdct_reset(&obj->context);
+}
+
+#ifndef MC_EXCLUDE_MALLOC
+void mc_mdct_allocate(mc_mdct_object_t *obj, uint32_t power2, const float *window) {
+    MC_NULLPTR_ASSERT(obj);
+    MC_ASSERT((4u*MC_MAX_FFT_LENGTH) >= (1u<<power2));
+    MC_ASSERT((1u<<power2) >= (4u*MC_MIN_FFT_LENGTH));
+    size_t memory_size = MC_MDCT_GET_OBJECT_SIZE(power2);
+    mc_mdct_create_object(obj, power2, window, malloc(memory_size), memory_size);
+}
+
+void mc_mdct_free(mc_mdct_object_t *obj) {
+    MC_NULLPTR_ASSERT(obj);
+    free(obj->memory);
+}
+#endif // EXCLUDE_MALLOC
@@ -0,0 +1,116 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MC_FFT_MDCT_H
+#define MC_FFT_MDCT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "mcfft.h"
+
+/** MDCT/IMDCT with windowed TDAC, frame of N = 2^power2 samples, M = N/2 coefficients:
+ *  - MDCT:  X[k] = sum(w[n]*x[n]*cos(pi/M*(n + 1/2 + M/2)*(k + 1/2)), n = 0..N-1)
+ *  - IMDCT: y[n] = w[n]*2/M*sum(X[k]*cos(pi/M*(n + 1/2 + M/2)*(k + 1/2)), k = 0..M-1),
+ *    frames are overlapped by M samples and added (overlap is kept by context)
+ *  - Perfect reconstruction if w[n]^2 + w[n+M]^2 = 1 and w[n] = w[N-1-n] (sine, KBD windows)
+ *  - DCT-IV of folded frame via complex FFT of N/4 points:
+ *    window, fold (4 strided streams) and pre-rotation are one pass, post-rotation and interleave of output are one pass
+ */
+
+/** MDCT context with pre-calculated values and buffers required */
+typedef struct mc_mdct_t {
+    /** NOTE: All arrays in structure better to align by 64 bytes.
+     *        Use mc_mdct_allocate()/mc_mdct_create_object() if possible */
+    mc_fft_t fft;           /* FFT context of N/4 points */
+    float *fold;            /* MDCT fold of two halves: signed window of 4 streams and pre-rotation (6*N/8 values per half) */
+    float *unfold;          /* IMDCT pre-rotation with scale 2/M (6*N/4 values, see mc_mdct_fold_*()) */
+    float *rotation;        /* Post-rotation W_N^k (N/4 values, Re then Im) */
+    float *window;          /* Window (N values) */
+    uint16_t *index;        /* Gather map of IMDCT unfold (N values, MSB - negate) */
+    float *overlap;         /* Windowed second half of the previous IMDCT frame (M values) */
+    float *work;            /* Work buffer (2N) */
+    uint32_t pow2;          /* N = 2^pow2 */
+} mc_mdct_t;
+
+/** Get MDCT object size in bytes if static/non-malloc allocation is required */
+#define MC_MDCT_GET_OBJECT_SIZE(power2) (MC_FFT_GET_OBJECT_SIZE((power2)-2u) \
+                                         + MC_GET_ALIGNED_SIZE(sizeof(float)*((3u<<(power2))>>1u)) \
+                                         + MC_GET_ALIGNED_SIZE(sizeof(float)*((3u<<(power2))>>1u)) \
+                                         + MC_GET_ALIGNED_SIZE(sizeof(float)*(1u<<((power2)-1u))) \
+                                         + MC_GET_ALIGNED_SIZE(sizeof(float)*(1u<<(power2))) \
+                                         + MC_GET_ALIGNED_SIZE(sizeof(uint16_t)*(1u<<(power2))) \
+                                         + MC_GET_ALIGNED_SIZE(sizeof(float)*(1u<<((power2)-1u))) \
+                                         + MC_GET_ALIGNED_SIZE(sizeof(float)*(2u<<(power2))))
+
+/** Forward MDCT of windowed frame
+ * 
+ * @param context Pointer to MDCT context
+ * @param out Pointer to coefficients (M values)
+ * @param in Pointer to frame (N samples: M samples of the previous hop and M samples of the current hop)
+ */
+void mc_mdct(const mc_mdct_t *context, float *out, const float *in);
+
+/** Inverse MDCT with windowed overlap-add of the previous frame (TDAC)
+ * 
+ * @param context Pointer to MDCT context (overlap is updated)
+ * @param out Pointer to reconstructed samples (M values, delayed by M samples relative to MDCT input hop)
+ * @param in Pointer to coefficients (M values)
+ */
+void mc_imdct(mc_mdct_t *context, float *out, const float *in);
+
+/** Clear overlap of IMDCT (start of new stream)
+ * 
+ * @param context Pointer to MDCT context
+ */
+void mc_mdct_reset(mc_mdct_t *context);
+
+/** MDCT object to control memory alignment and simplify allocation of memory (see mc_mdct_t) */
+typedef struct mc_mdct_object_t {
+    mc_mdct_t context;
+    void *memory;
+} mc_mdct_object_t;
+
+/** Create MDCT object based on allocated memory (non-malloc API)
+ * 
+ * @param obj Pointer to user's structure where object will be created
+ * @param power2 Power of 2 which reflects frame length N (4*MC_MIN_FFT_LENGTH <= N <= 4*MC_MAX_FFT_LENGTH)
+ * @param window Pointer to window (N values, copied), NULL - sine window sin(pi*(n + 1/2)/N)
+ * @param memory Pointer to user's memory which used to create object
+ * @param memSize User's memory size in bytes (see MC_MDCT_GET_OBJECT_SIZE(power2))
+ */
+void mc_mdct_create_object(mc_mdct_object_t *obj, uint32_t power2, const float *window, void *memory, size_t memSize);
+
+/** Allocate MDCT object via malloc/free API (can be excluded by defining EXCLUDE_MALLOC macro) */
+void mc_mdct_allocate(mc_mdct_object_t *obj, uint32_t power2, const float *window);
+
+/** Release MDCT object via malloc/free API (can be excluded by defining EXCLUDE_MALLOC macro) */
+void mc_mdct_free(mc_mdct_object_t *obj);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MC_FFT_MDCT_H */
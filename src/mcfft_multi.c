@@ -0,0 +1,134 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "mcfft_multi.h"
+#include "generic/mcfft_generic.h"
+#include "x86/mcfft_avx.h"
+#include "aarch64/mcfft_neon.h"
+
+#ifndef MC_SELECTOR
+#define MC_SELECTOR g
+#endif
+
+static void st_fft_multi_shuffle(const mc_fft_multi_t *context, float **re, float **im, uint32_t channels, uint32_t length) {
+    /** Scatter pipeline of mono FFT is the same permutation: gather is used for all pipelines.
+     *  Channel by channel with the same map: map stays in L1 cache, gathers of one channel do not compete with others */
+    const uint32_t isDif = (context->fft.pipeline & MC_FFT_PIPELINE_DIF);
+    const uint16_t *map = (const uint16_t*)&context->fft.digitRev[isDif ? (length>>1u) : 0];
+    for (uint32_t ch = 0; ch < channels; ++ch) {
+        MC_FUNC_CALL(shuffle_mono, MC_SELECTOR)(re[ch], im[ch], context->fft.buffer, map, length);
+    }
+}
+
+void mc_fft_multi(const mc_fft_multi_t *context, float **re, float **im, uint32_t channels, uint32_t length) {
+    MC_NULLPTR_ASSERT(context);
+    MC_NULLPTR_ASSERT(context->fft.digitRev);
+    MC_NULLPTR_ASSERT(context->fft.twiddle);
+    MC_NULLPTR_ASSERT(context->fft.buffer);
+    MC_NULLPTR_ASSERT(re);
+    MC_NULLPTR_ASSERT(im);
+    MC_2D_NULLPTR_ASSERT(re, channels);
+    MC_2D_NULLPTR_ASSERT(im, channels);
+    MC_ASSERT((1U<<context->fft.pow2) == length);
+    MC_ASSERT(context->fft.bufLength >= (2u*length));
+    MC_ASSERT(context->group >= 1u);
+    MC_ASSERT(MC_MAX_FFT_LENGTH >= length);
+    MC_ASSERT(length >= MC_MIN_FFT_LENGTH);
+    for (uint32_t first = 0; first < channels; first += context->group) {
+        const uint32_t count = ((channels - first) < context->group) ? (channels - first) : context->group;
+        if (context->fft.pipeline & MC_FFT_PIPELINE_DIF) {
+            MC_FUNC_CALL(fft_dif_multi_core, MC_SELECTOR)(&re[first], &im[first], count, context->fft.twiddle, context->fft.pow2);
+            st_fft_multi_shuffle(context, &re[first], &im[first], count, length);
+        } else {
+            st_fft_multi_shuffle(context, &re[first], &im[first], count, length);
+            MC_FUNC_CALL(fft_dit_multi_core, MC_SELECTOR)(&re[first], &im[first], count, context->fft.twiddle, context->fft.pow2);
+        }
+    }
+}
+
+void mc_ifft_multi(const mc_fft_multi_t *context, float **re, float **im, uint32_t channels, uint32_t length) {
+    MC_NULLPTR_ASSERT(context);
+    MC_NULLPTR_ASSERT(context->fft.digitRev);
+    MC_NULLPTR_ASSERT(context->fft.twiddle);
+    MC_NULLPTR_ASSERT(context->fft.buffer);
+    MC_NULLPTR_ASSERT(re);
+    MC_NULLPTR_ASSERT(im);
+    MC_2D_NULLPTR_ASSERT(re, channels);
+    MC_2D_NULLPTR_ASSERT(im, channels);
+    MC_ASSERT((1U<<context->fft.pow2) == length);
+    MC_ASSERT(context->fft.bufLength >= (2u*length));
+    MC_ASSERT(context->group >= 1u);
+    MC_ASSERT(MC_MAX_FFT_LENGTH >= length);
+    MC_ASSERT(length >= MC_MIN_FFT_LENGTH);
+    for (uint32_t first = 0; first < channels; first += context->group) {
+        const uint32_t count = ((channels - first) < context->group) ? (channels - first) : context->group;
+        if (context->fft.pipeline & MC_FFT_PIPELINE_DIF) {
+            MC_FUNC_CALL(ifft_dif_multi_core, MC_SELECTOR)(&re[first], &im[first], count, context->fft.twiddle, context->fft.pow2);
+            st_fft_multi_shuffle(context, &re[first], &im[first], count, length);
+        } else {
+            st_fft_multi_shuffle(context, &re[first], &im[first], count, length);
+            MC_FUNC_CALL(ifft_dit_multi_core, MC_SELECTOR)(&re[first], &im[first], count, context->fft.twiddle, context->fft.pow2);
+        }
+    }
+}
+
+void mc_fft_multi_create_object(mc_fft_multi_object_t *obj, uint32_t power2, void *memory, size_t memSize) {
+    MC_NULLPTR_ASSERT(obj);
+    MC_NULLPTR_ASSERT(memory);
+    MC_ASSERT(MC_MAX_FFT_LENGTH >= (1u<<power2));
+    MC_ASSERT((1u<<power2) >= MC_MIN_FFT_LENGTH);
+    MC_ASSERT(memSize >= MC_FFT_MULTI_GET_OBJECT_SIZE(power2));
+    uintptr_t memory_addr;
+    memset(&obj->context, 0, sizeof(obj->context));
+    obj->memory = memory;
+    obj->context.group = MC_FFT_MULTI_GROUP(power2);
+    obj->context.fft.pow2 = power2;
+    memory_addr = MC_GET_ALIGNED_PTR(obj->memory);
+    obj->context.fft.buffer = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*MC_BUFFER_LENGTH(power2));
+    obj->context.fft.bufLength = MC_BUFFER_LENGTH(power2);
+    obj->context.fft.digitRev = (uint32_t*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(uint32_t)*MC_DIGIT_LENGTH(power2));
+    obj->context.fft.twiddle = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*MC_TWIDDLE_LENGTH(power2));
+    MC_ASSERT(memory_addr <= (uintptr_t)obj->memory+memSize);
+    mc_fft_get_digitRev(obj->context.fft.digitRev, MC_DIGIT_LENGTH(power2), power2);
+    mc_fft_get_twiddle(obj->context.fft.twiddle, MC_TWIDDLE_LENGTH(power2), power2);
+    mc_fft_plan(&obj->context.fft, MC_FFT_PLAN_ESTIMATE, NULL, NULL, (1u<<power2));
+}
+
+#ifndef MC_EXCLUDE_MALLOC
+void mc_fft_multi_allocate(mc_fft_multi_object_t *obj, uint32_t power2) {
+    MC_NULLPTR_ASSERT(obj);
+    MC_ASSERT(MC_MAX_FFT_LENGTH >= (1u<<power2));
+    MC_ASSERT((1u<<power2) >= MC_MIN_FFT_LENGTH);
+    size_t memory_size = MC_FFT_MULTI_GET_OBJECT_SIZE(power2);
+    mc_fft_multi_create_object(obj, power2, malloc(memory_size), memory_size);
+}
+
+void mc_fft_multi_free(mc_fft_multi_object_t *obj) {
+    MC_NULLPTR_ASSERT(obj);
+    free(obj->memory);
+}
+#endif // EXCLUDE_MALLOC
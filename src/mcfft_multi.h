@@ -0,0 +1,109 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MC_FFT_MULTI_H
+#define MC_FFT_MULTI_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "mcfft.h"
+
+/** Multichannel FFT (stereo, microphone arrays): channels of the same length are transformed together
+ *  - Channels are processed in groups stage by stage: twiddle factors of a stage are fetched into L1 cache once
+ *    and reused by all channels of group, digit reverse map is shared by channels
+ *  - Group is limited by working set (see MC_FFT_MULTI_GROUP()): group of channels stays in cache between stages
+ *  - Results are bit-identical to mc_fft_mono()/mc_ifft_mono() of every channel (same stage kernels in the same order)
+ */
+
+/** Working set of group of channels in bytes (L2 cache by default) */
+#ifndef MC_FFT_MULTI_CACHE_SIZE
+#define MC_FFT_MULTI_CACHE_SIZE (256u*1024u)
+#endif
+/** Max number of channels processed together */
+#define MC_FFT_MULTI_MAX_GROUP (8u)
+/** Number of channels processed together for FFT of 2^power2 points */
+#define MC_FFT_MULTI_GROUP(power2) ((MC_FFT_MULTI_CACHE_SIZE >= (MC_FFT_MULTI_MAX_GROUP*sizeof(float)*MC_BUFFER_LENGTH(power2))) \
+                                    ? MC_FFT_MULTI_MAX_GROUP \
+                                    : ((MC_FFT_MULTI_CACHE_SIZE >= (2u*sizeof(float)*MC_BUFFER_LENGTH(power2))) \
+                                       ? (uint32_t)(MC_FFT_MULTI_CACHE_SIZE/(sizeof(float)*MC_BUFFER_LENGTH(power2))) : 1u))
+
+/** Multichannel FFT context */
+typedef struct mc_fft_multi_t {
+    /** NOTE: All arrays in structure better to align by 64 bytes.
+     *        Use mc_fft_multi_allocate()/mc_fft_multi_create_object() if possible */
+    mc_fft_t fft;           /* FFT plan of one channel (twiddle factors, digit reverse map, buffer) */
+    uint32_t group;         /* number of channels processed together */
+} mc_fft_multi_t;
+
+/** Get multichannel FFT object size in bytes if static/non-malloc allocation is required */
+#define MC_FFT_MULTI_GET_OBJECT_SIZE(power2) MC_FFT_GET_OBJECT_SIZE(power2)
+
+/** Forward FFT of all channels in place (natural order, see mc_fft_mono())
+ * 
+ * @param context Pointer to multichannel FFT context
+ * @param re Array of pointers to real part of channels
+ * @param im Array of pointers to imag part of channels
+ * @param channels Number of channels (any, processed by groups)
+ * @param length Length of every channel (must be == 2^power2 of context)
+ */
+void mc_fft_multi(const mc_fft_multi_t *context, float **re, float **im, uint32_t channels, uint32_t length);
+
+/** Inverse FFT of all channels in place without normalisation (natural order, see mc_ifft_mono())
+ * 
+ * @param context Pointer to multichannel FFT context
+ * @param re Array of pointers to real part of channels
+ * @param im Array of pointers to imag part of channels
+ * @param channels Number of channels (any, processed by groups)
+ * @param length Length of every channel (must be == 2^power2 of context)
+ */
+void mc_ifft_multi(const mc_fft_multi_t *context, float **re, float **im, uint32_t channels, uint32_t length);
+
+/** Multichannel FFT object to control memory alignment and simplify allocation of memory (see mc_fft_multi_t) */
+typedef struct mc_fft_multi_object_t {
+    mc_fft_multi_t context;
+    void *memory;
+} mc_fft_multi_object_t;
+
+/** Create multichannel FFT object based on allocated memory (non-malloc API)
+ * 
+ * @param obj Pointer to user's structure where object will be created
+ * @param power2 Power of 2 which reflects length of every channel
+ * @param memory Pointer to user's memory which used to create object
+ * @param memSize User's memory size in bytes (see MC_FFT_MULTI_GET_OBJECT_SIZE(power2))
+ */
+void mc_fft_multi_create_object(mc_fft_multi_object_t *obj, uint32_t power2, void *memory, size_t memSize);
+
+/** Allocate multichannel FFT object via malloc/free API (can be excluded by defining EXCLUDE_MALLOC macro) */
+void mc_fft_multi_allocate(mc_fft_multi_object_t *obj, uint32_t power2);
+
+/** Release multichannel FFT object via malloc/free API (can be excluded by defining EXCLUDE_MALLOC macro) */
+void mc_fft_multi_free(mc_fft_multi_object_t *obj);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MC_FFT_MULTI_H */
@@ -0,0 +1,214 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "mcfft_parallel.h"
+#include "generic/mcfft_generic.h"
+#include "x86/mcfft_avx.h"
+#include "aarch64/mcfft_neon.h"
+#include <math.h>
+
+#ifndef MC_SELECTOR
+#define MC_SELECTOR g
+#endif
+
+/** Split of power of 2 to sub-FFTs: N1 = 2^(power2/2), N2 = N/N1 */
+#define MC_FFT_PARALLEL_FIRST_POW2(power2) ((power2)>>1u)
+#define MC_FFT_PARALLEL_SECOND_POW2(power2) ((power2) - ((power2)>>1u))
+/** Four-step decomposition is used if both sub-FFTs are supported */
+#define MC_FFT_PARALLEL_IS_SPLIT(power2) (MC_FFT_PARALLEL_FIRST_POW2(power2) >= 5u)
+/** Single-threaded FFT is available */
+#define MC_FFT_PARALLEL_IS_MONO(power2) ((power2) <= MC_MAX_FFT_POW2)
+
+typedef struct mc_fft_parallel_job_t {
+    const mc_fft_parallel_t *context;
+    float *re;
+    float *im;
+} mc_fft_parallel_job_t;
+
+static void st_fft_parallel_first(void *arg, uint32_t index, uint32_t thread) {
+    const mc_fft_parallel_job_t *job = (const mc_fft_parallel_job_t*)arg;
+    const mc_fft_parallel_t *context = job->context;
+    const uint32_t firstLength = 1u<<context->first.pow2;
+    const uint32_t secondLength = 1u<<context->second.pow2;
+    const uint32_t fftLength = firstLength*secondLength;
+    const uint32_t col = index*MC_FFT_PARALLEL_TILE;
+    const uint16_t *dif_map = (const uint16_t*)&context->first.digitRev[firstLength>>1u];
+    float *buffer = &context->scratch[thread*context->scratchLength];
+    float *wRe = &context->work[col*firstLength];
+    float *wIm = &context->work[fftLength + col*firstLength];
+    /** Columns x[N2*n1 + n2] are rows of intermediate matrix */
+    MC_FUNC_CALL(transpose_tile, MC_SELECTOR)(wRe, &job->re[col], secondLength, firstLength, firstLength);
+    MC_FUNC_CALL(transpose_tile, MC_SELECTOR)(wIm, &job->im[col], secondLength, firstLength, firstLength);
+    /** Twiddle factors are applied in digit-reversed order of DIF core */
+    for (uint32_t c = 0; c < MC_FFT_PARALLEL_TILE; ++c) {
+        const uint32_t offset = (col + c)*firstLength;
+        float *rowRe = &wRe[c*firstLength];
+        float *rowIm = &wIm[c*firstLength];
+        MC_FUNC_CALL(fft_dif_mono_core, MC_SELECTOR)(rowRe, rowIm, context->first.twiddle, context->first.pow2);
+        MC_FUNC_CALL(spectrum_mul, MC_SELECTOR)(rowRe, rowIm, &context->twiddle[offset], &context->twiddle[fftLength + offset], 
+                                                firstLength);
+        MC_FUNC_CALL(shuffle_mono, MC_SELECTOR)(rowRe, rowIm, buffer, dif_map, firstLength);
+    }
+}
+
+static void st_fft_parallel_second(void *arg, uint32_t index, uint32_t thread) {
+    const mc_fft_parallel_job_t *job = (const mc_fft_parallel_job_t*)arg;
+    const mc_fft_parallel_t *context = job->context;
+    const uint32_t firstLength = 1u<<context->first.pow2;
+    const uint32_t secondLength = 1u<<context->second.pow2;
+    const uint32_t fftLength = firstLength*secondLength;
+    const uint32_t col = index*MC_FFT_PARALLEL_TILE;
+    const uint16_t *dif_map = (const uint16_t*)&context->second.digitRev[secondLength>>1u];
+    float *tRe = &context->scratch[thread*context->scratchLength];
+    float *tIm = &tRe[MC_FFT_PARALLEL_TILE*secondLength];
+    float *buffer = &tIm[MC_FFT_PARALLEL_TILE*secondLength];
+    MC_FUNC_CALL(transpose_tile, MC_SELECTOR)(tRe, &context->work[col], firstLength, secondLength, secondLength);
+    MC_FUNC_CALL(transpose_tile, MC_SELECTOR)(tIm, &context->work[fftLength + col], firstLength, secondLength, secondLength);
+    for (uint32_t c = 0; c < MC_FFT_PARALLEL_TILE; ++c) {
+        MC_FUNC_CALL(fft_dif_mono_core, MC_SELECTOR)(&tRe[c*secondLength], &tIm[c*secondLength], 
+                                                     context->second.twiddle, context->second.pow2);
+        MC_FUNC_CALL(shuffle_mono, MC_SELECTOR)(&tRe[c*secondLength], &tIm[c*secondLength], buffer, dif_map, secondLength);
+    }
+    /** X[k1 + N1*k2]: 8x8 blocks of tile back to columns of output */
+    for (uint32_t k2 = 0; k2 < secondLength; k2 += 8u) {
+        MC_FUNC_CALL(transpose_tile, MC_SELECTOR)(&job->re[k2*firstLength + col], &tRe[k2], secondLength, firstLength, 8u);
+        MC_FUNC_CALL(transpose_tile, MC_SELECTOR)(&job->im[k2*firstLength + col], &tIm[k2], secondLength, firstLength, 8u);
+    }
+}
+
+static void st_fft_parallel(const mc_fft_parallel_t *context, mc_thread_pool_t *pool, float *re, float *im, 
+                            uint32_t length, uint32_t isInverse) {
+    MC_NULLPTR_ASSERT(context);
+    MC_NULLPTR_ASSERT(re);
+    MC_NULLPTR_ASSERT(im);
+    MC_ASSERT((1u<<context->pow2) == length);
+    MC_ASSERT((NULL == pool) || (pool->threads <= context->threads));
+    const uint32_t threads = (NULL != pool) ? pool->threads : 1u;
+    if (MC_FFT_PARALLEL_IS_MONO(context->pow2) && 
+        ((1u == threads) || (context->pow2 < MC_FFT_PARALLEL_MIN_POW2) || !MC_FFT_PARALLEL_IS_SPLIT(context->pow2))) {
+        if (isInverse) {
+            mc_ifft_mono(&context->fft, re, im, length);
+        } else {
+            mc_fft_mono(&context->fft, re, im, length);
+        }
+        return;
+    }
+    /** Inverse FFT is FFT with swapped Re/Im of input and output */
+    mc_fft_parallel_job_t job = {context, isInverse ? im : re, isInverse ? re : im};
+    const uint32_t firstTasks = (1u<<context->second.pow2)/MC_FFT_PARALLEL_TILE;
+    const uint32_t secondTasks = (1u<<context->first.pow2)/MC_FFT_PARALLEL_TILE;
+    mc_thread_run(pool, st_fft_parallel_first, &job, firstTasks);
+    mc_thread_run(pool, st_fft_parallel_second, &job, secondTasks);
+}
+
+void mc_fft_parallel(const mc_fft_parallel_t *context, mc_thread_pool_t *pool, float *re, float *im, uint32_t length) {
+    st_fft_parallel(context, pool, re, im, length, 0);
+}
+
+void mc_ifft_parallel(const mc_fft_parallel_t *context, mc_thread_pool_t *pool, float *re, float *im, uint32_t length) {
+    st_fft_parallel(context, pool, re, im, length, 1u);
+}
+
+static uint32_t st_fft_parallel_scratch_length(uint32_t power2) {
+    /** Tile of columns of N2 points (Re then Im) and buffer of digit reverse */
+    const uint32_t secondPow2 = MC_FFT_PARALLEL_SECOND_POW2(power2);
+    return (uint32_t)(MC_GET_ALIGNED_SIZE(sizeof(float)*(2u*MC_FFT_PARALLEL_TILE*(1u<<secondPow2) + MC_BUFFER_LENGTH(secondPow2)))
+                      / sizeof(float));
+}
+
+size_t mc_fft_parallel_get_object_size(uint32_t power2, uint32_t threads) {
+    MC_ASSERT(MC_FFT_PARALLEL_MAX_POW2 >= power2);
+    MC_ASSERT((1u<<power2) >= MC_MIN_FFT_LENGTH);
+    MC_ASSERT((threads > 0) && (threads <= MC_THREAD_MAX));
+    const uint32_t firstPow2 = MC_FFT_PARALLEL_FIRST_POW2(power2);
+    const uint32_t secondPow2 = MC_FFT_PARALLEL_SECOND_POW2(power2);
+    size_t size = MC_MEM_ALIGNMENT;
+    if (MC_FFT_PARALLEL_IS_MONO(power2)) {
+        size += MC_FFT_GET_OBJECT_SIZE(power2);
+    }
+    if (MC_FFT_PARALLEL_IS_SPLIT(power2)) {
+        size += MC_FFT_GET_TABLES_SIZE(firstPow2) 
+                + MC_FFT_GET_TABLES_SIZE(secondPow2) 
+                + 2u*MC_GET_ALIGNED_SIZE(sizeof(float)*(2u<<power2))
+                + (size_t)threads*sizeof(float)*st_fft_parallel_scratch_length(power2);
+    }
+    return size;
+}
+
+void mc_fft_parallel_create_object(mc_fft_parallel_object_t *obj, uint32_t power2, uint32_t threads, void *memory, size_t memSize) {
+    MC_NULLPTR_ASSERT(obj);
+    MC_NULLPTR_ASSERT(memory);
+    MC_ASSERT(memSize >= mc_fft_parallel_get_object_size(power2, threads));
+    const uint32_t firstPow2 = MC_FFT_PARALLEL_FIRST_POW2(power2);
+    const uint32_t secondPow2 = MC_FFT_PARALLEL_SECOND_POW2(power2);
+    uintptr_t memory_addr = 0;
+    memset(&obj->context, 0, sizeof(obj->context));
+    obj->memory = memory;
+    obj->context.pow2 = power2;
+    obj->context.threads = threads;
+    memory_addr = MC_GET_ALIGNED_PTR(obj->memory);
+    if (MC_FFT_PARALLEL_IS_MONO(power2)) {
+        mc_fft_object_t fftObj;
+        mc_fft_create_object(&fftObj, power2, (void*)memory_addr, MC_FFT_GET_OBJECT_SIZE(power2));
+        obj->context.fft = fftObj.context;
+        memory_addr = MC_GET_ALIGNED_PTR(memory_addr+MC_FFT_GET_OBJECT_SIZE(power2));
+    }
+    if (MC_FFT_PARALLEL_IS_SPLIT(power2)) {
+        const uint32_t fftLength = 1u<<power2;
+        const uint32_t firstLength = 1u<<firstPow2;
+        const uint32_t secondLength = 1u<<secondPow2;
+        const double phi = -2. * (double)MC_PI / (double)fftLength;
+        memory_addr = mc_fft_create_tables(&obj->context.first, firstPow2, memory_addr);
+        memory_addr = mc_fft_create_tables(&obj->context.second, secondPow2, memory_addr);
+        obj->context.twiddle = (float*)memory_addr;
+        memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*2u*fftLength);
+        obj->context.work = (float*)memory_addr;
+        memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*2u*fftLength);
+        obj->context.scratchLength = st_fft_parallel_scratch_length(power2);
+        obj->context.scratch = (float*)memory_addr;
+        memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*threads*obj->context.scratchLength);
+        const uint16_t *dif_map = (const uint16_t*)&obj->context.first.digitRev[firstLength>>1u];
+        for (uint32_t n2 = 0; n2 < secondLength; ++n2) {
+            for (uint32_t k1 = 0; k1 < firstLength; ++k1) {
+                double angle = phi * (double)((n2*k1) & (fftLength - 1u));
+                obj->context.twiddle[n2*firstLength + dif_map[k1]] = (float)cos(angle);
+                obj->context.twiddle[fftLength + n2*firstLength + dif_map[k1]] = (float)sin(angle);
+            }
+        }
+    }
+    MC_ASSERT(memory_addr <= (uintptr_t)obj->memory+memSize);
+}
+
+#ifndef MC_EXCLUDE_MALLOC
+void mc_fft_parallel_allocate(mc_fft_parallel_object_t *obj, uint32_t power2, uint32_t threads) {
+    MC_NULLPTR_ASSERT(obj);
+    size_t memory_size = mc_fft_parallel_get_object_size(power2, threads);
+    mc_fft_parallel_create_object(obj, power2, threads, malloc(memory_size), memory_size);
+}
+
+void mc_fft_parallel_free(mc_fft_parallel_object_t *obj) {
+    MC_NULLPTR_ASSERT(obj);
+    free(obj->memory);
+}
+#endif // EXCLUDE_MALLOC
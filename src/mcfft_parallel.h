@@ -0,0 +1,114 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MC_FFT_PARALLEL_H
+#define MC_FFT_PARALLEL_H
+
+#include "mcfft.h"
+/** Outside of extern "C": C++ build includes <atomic> */
+#include "mcfft_thread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Multi-threaded FFT of one large signal (four-step decomposition N = N1*N2):
+ *  - N2 sub-FFTs of N1 points (columns of signal), multiplication by W_N^(n2*k1)
+ *  - N1 sub-FFTs of N2 points (columns of intermediate matrix)
+ *  - Columns are moved by 8x8 transposes in registers, twiddle factors are applied before digit reverse
+ *  - Sub-FFTs are split to tasks of MC_FFT_PARALLEL_TILE columns and executed by thread pool,
+ *    every thread has its own scratch
+ *  - Lengths up to 2^MC_FFT_PARALLEL_MAX_POW2 are supported (beyond MC_MAX_FFT_LENGTH of mc_fft_mono())
+ *  - Below 2^MC_FFT_PARALLEL_MIN_POW2 points or with one thread mc_fft_mono() is used 
+ *    (if length is supported by mc_fft_mono())
+ */
+
+/** Columns per task */
+#define MC_FFT_PARALLEL_TILE (8u)
+/** Threshold of parallel execution (synchronisation costs more than gain below) */
+#define MC_FFT_PARALLEL_MIN_POW2 (14u)
+/** Max length of parallel FFT (both sub-FFTs are supported by cores) */
+#define MC_FFT_PARALLEL_MAX_POW2 (2u*MC_MAX_FFT_POW2)
+
+/** Parallel FFT context with pre-calculated values and buffers required */
+typedef struct mc_fft_parallel_t {
+    /** NOTE: All arrays in structure better to align by 64 bytes.
+     *        Use mc_fft_parallel_allocate()/mc_fft_parallel_create_object() if possible */
+    mc_fft_t fft;           /* Single-threaded FFT (pow2 <= MC_MAX_FFT_POW2 only) */
+    mc_fft_t first;         /* Tables of sub-FFT of N1 points (buffer is per thread) */
+    mc_fft_t second;        /* Tables of sub-FFT of N2 points (buffer is per thread) */
+    float *twiddle;         /* W_N^(n2*k1), [n2][digit-reversed k1] (Re then Im) */
+    float *work;            /* Intermediate matrix [n2][k1] (Re then Im) */
+    float *scratch;         /* Per-thread scratch: tile of columns (Re then Im) and buffer of digit reverse */
+    uint32_t scratchLength; /* Number of scratch elements per thread */
+    uint32_t pow2;          /* length of FFT */
+    uint32_t threads;       /* max number of threads */
+} mc_fft_parallel_t;
+
+/** Forward FFT with thread pool
+ * 
+ * @param context Pointer to parallel FFT context
+ * @param pool Pointer to thread pool (NULL - caller's thread only), number of threads must be <= threads of context
+ * @param re Pointer to real part of signal
+ * @param im Pointer to imag part of signal
+ * @param length Length of Re/Im signal to be processed (must be power of 2 and match FFT context)
+ */
+void mc_fft_parallel(const mc_fft_parallel_t *context, mc_thread_pool_t *pool, float *re, float *im, uint32_t length);
+
+/** Inverse FFT with thread pool (see mc_fft_parallel())
+ * 
+ * NOTE: don't forget to call mc_fft_norm() function after
+ */
+void mc_ifft_parallel(const mc_fft_parallel_t *context, mc_thread_pool_t *pool, float *re, float *im, uint32_t length);
+
+/** Get parallel FFT object size in bytes (see mc_fft_parallel_create_object()) */
+size_t mc_fft_parallel_get_object_size(uint32_t power2, uint32_t threads);
+
+/** Parallel FFT object to control memory alignment and simplify allocation of memory (see mc_fft_parallel_t) */
+typedef struct mc_fft_parallel_object_t {
+    mc_fft_parallel_t context;
+    void *memory;
+} mc_fft_parallel_object_t;
+
+/** Create parallel FFT object based on allocated memory (non-malloc API)
+ * 
+ * @param obj Pointer to user's structure where object will be created
+ * @param power2 Power of 2 which reflects required length of FFT (up to MC_FFT_PARALLEL_MAX_POW2)
+ * @param threads Max number of threads (scratch is allocated per thread)
+ * @param memory Pointer to user's memory which used to create object
+ * @param memSize User's memory size in bytes (see mc_fft_parallel_get_object_size())
+ */
+void mc_fft_parallel_create_object(mc_fft_parallel_object_t *obj, uint32_t power2, uint32_t threads, void *memory, size_t memSize);
+
+/** Allocate parallel FFT object via malloc/free API (can be excluded by defining EXCLUDE_MALLOC macro) */
+void mc_fft_parallel_allocate(mc_fft_parallel_object_t *obj, uint32_t power2, uint32_t threads);
+
+/** Release parallel FFT object via malloc/free API (can be excluded by defining EXCLUDE_MALLOC macro) */
+void mc_fft_parallel_free(mc_fft_parallel_object_t *obj);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MC_FFT_PARALLEL_H */
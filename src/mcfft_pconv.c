@@ -0,0 +1,338 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "mcfft_pconv.h"
+#include "generic/mcfft_generic.h"
+#include "x86/mcfft_avx.h"
+#include "aarch64/mcfft_neon.h"
+
+#ifndef MC_SELECTOR
+#define MC_SELECTOR g
+#endif
+
+static uintptr_t st_pconv_init(mc_pconv_t *context, uint32_t power2, uint32_t partitions, 
+                               const float *twiddle, uintptr_t memory_addr) {
+    memset(context, 0, sizeof(*context));
+    context->twiddle = twiddle;
+    context->pow2 = power2;
+    context->partitions = partitions;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr);
+    context->spectra = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*partitions*MC_CONV_SPECTRUM_LENGTH(power2));
+    context->fdl = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*partitions*MC_CONV_SPECTRUM_LENGTH(power2));
+    context->work = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*MC_CONV_WORK_LENGTH(power2));
+    context->acc = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*MC_CONV_WORK_LENGTH(power2));
+    context->history = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*MC_CONV_HISTORY_LENGTH(power2));
+    context->mirror = (uint16_t*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(uint16_t)*MC_DIGIT_LENGTH(power2));
+
+    /** FDL memory is used as temporary storage of digit maps */
+    uint32_t *digitRev = (uint32_t*)context->fdl;
+    mc_fft_get_digitRev(digitRev, MC_DIGIT_LENGTH(power2), power2);
+    mc_fft_get_mirror(context->mirror, digitRev, power2);
+    mc_pconv_reset(context);
+    return memory_addr;
+}
+
+void mc_pconv_set_filter(mc_pconv_t *context, const float *filter, uint32_t filterLength) {
+    MC_NULLPTR_ASSERT(context);
+    MC_NULLPTR_ASSERT(filter);
+    MC_ASSERT(filterLength > 0);
+    MC_ASSERT(context->partitions >= MC_PCONV_PARTITIONS(context->pow2, filterLength));
+    const uint32_t fftLength = 1u<<context->pow2;
+    const uint32_t blockLength = MC_CONV_BLOCK_LENGTH(context->pow2);
+    const float norm_coeff = 1.f / (float)fftLength;
+    memset(context->spectra, 0, sizeof(float)*context->partitions*MC_CONV_SPECTRUM_LENGTH(context->pow2));
+    for (uint32_t p = 0; (p*blockLength) < filterLength; ++p) {
+        float *hRe = &context->spectra[p*MC_CONV_SPECTRUM_LENGTH(context->pow2)];
+        float *hIm = &hRe[fftLength];
+        for (uint32_t i = 0; (i < blockLength) && ((p*blockLength + i) < filterLength); ++i) {
+            hRe[i] = filter[p*blockLength + i] * norm_coeff;
+        }
+        MC_FUNC_CALL(fft_dif_mono_core, MC_SELECTOR)(hRe, hIm, context->twiddle, context->pow2);
+    }
+}
+
+void mc_pconv_reset(mc_pconv_t *context) {
+    MC_NULLPTR_ASSERT(context);
+    memset(context->fdl, 0, sizeof(float)*context->partitions*MC_CONV_SPECTRUM_LENGTH(context->pow2));
+    memset(context->history, 0, sizeof(float)*MC_CONV_HISTORY_LENGTH(context->pow2));
+    context->fdlIndex = 0;
+}
+
+/** acc = sum(FDL[newest - p] * H[p]) */
+static void st_pconv_accumulate(const mc_pconv_t *context, float * restrict accRe, float * restrict accIm) {
+    const uint32_t fftLength = 1u<<context->pow2;
+    const uint32_t slotLength = MC_CONV_SPECTRUM_LENGTH(context->pow2);
+    memset(accRe, 0, sizeof(float)*fftLength);
+    memset(accIm, 0, sizeof(float)*fftLength);
+    for (uint32_t p = 0; p < context->partitions; ++p) {
+        const float *x = &context->fdl[((context->fdlIndex + context->partitions - p) % context->partitions)*slotLength];
+        const float *h = &context->spectra[p*slotLength];
+        MC_FUNC_CALL(spectrum_mac, MC_SELECTOR)(accRe, accIm, x, &x[fftLength], h, &h[fftLength], fftLength);
+    }
+}
+
+void mc_pconv_process(mc_pconv_t *context, const float *in, float *out, uint32_t length) {
+    MC_NULLPTR_ASSERT(context);
+    MC_NULLPTR_ASSERT(in);
+    MC_NULLPTR_ASSERT(out);
+    const uint32_t fftLength = 1u<<context->pow2;
+    const uint32_t blockLength = MC_CONV_BLOCK_LENGTH(context->pow2);
+    const uint32_t slotLength = MC_CONV_SPECTRUM_LENGTH(context->pow2);
+    float * restrict re = context->work;
+    float * restrict im = &context->work[fftLength];
+    float * restrict accRe = context->acc;
+    float * restrict accIm = &context->acc[fftLength];
+    MC_ASSERT(0 == (length % blockLength));
+
+    while (length > 0) {
+        uint32_t isDual = (length >= 2u*blockLength);
+        memcpy(re, context->history, sizeof(float)*blockLength);
+        memcpy(&re[blockLength], in, sizeof(float)*blockLength);
+        if (isDual) {
+            /** Re: [history | block0], Im: [block0 | block1] */
+            memcpy(im, in, sizeof(float)*fftLength);
+            memcpy(context->history, &in[blockLength], sizeof(float)*blockLength);
+            MC_FUNC_CALL(fft_dif_mono_core, MC_SELECTOR)(re, im, context->twiddle, context->pow2);
+            /** Spectrum of block0 goes to FDL, spectrum of block1 is kept in accumulator until Y0 is ready */
+            context->fdlIndex = (context->fdlIndex + 1u) % context->partitions;
+            float *x0 = &context->fdl[context->fdlIndex*slotLength];
+            mc_spectrum_split_dual_g(x0, &x0[fftLength], accRe, accIm, re, im, context->mirror, fftLength);
+            st_pconv_accumulate(context, re, im);
+            context->fdlIndex = (context->fdlIndex + 1u) % context->partitions;
+            memcpy(&context->fdl[context->fdlIndex*slotLength], accRe, sizeof(float)*slotLength);
+            st_pconv_accumulate(context, accRe, accIm);
+            /** Outputs are real: Y0 + jY1 gives y0 in Re and y1 in Im after inverse FFT */
+            for (uint32_t i = 0; i < fftLength; ++i) {
+                re[i] -= accIm[i];
+                im[i] += accRe[i];
+            }
+        } else {
+            memset(im, 0, sizeof(float)*fftLength);
+            memcpy(context->history, in, sizeof(float)*blockLength);
+            MC_FUNC_CALL(fft_dif_mono_core, MC_SELECTOR)(re, im, context->twiddle, context->pow2);
+            context->fdlIndex = (context->fdlIndex + 1u) % context->partitions;
+            memcpy(&context->fdl[context->fdlIndex*slotLength], context->work, sizeof(float)*slotLength);
+            st_pconv_accumulate(context, re, im);
+        }
+        MC_FUNC_CALL(ifft_dit_mono_core, MC_SELECTOR)(re, im, context->twiddle, context->pow2);
+        memcpy(out, &re[blockLength], sizeof(float)*blockLength);
+        if (isDual) {
+            memcpy(&out[blockLength], &im[blockLength], sizeof(float)*blockLength);
+        }
+        in += (isDual ? fftLength : blockLength);
+        out += (isDual ? fftLength : blockLength);
+        length -= (isDual ? fftLength : blockLength);
+    }
+}
+
+void mc_pconv_create_object(mc_pconv_object_t *obj, uint32_t power2, const float *filter, uint32_t filterLength, 
+                            void *memory, size_t memSize) {
+    MC_NULLPTR_ASSERT(obj);
+    MC_NULLPTR_ASSERT(memory);
+    MC_ASSERT(MC_MAX_FFT_LENGTH >= (1u<<power2));
+    MC_ASSERT((1u<<power2) >= MC_MIN_FFT_LENGTH);
+    MC_ASSERT(filterLength > 0);
+    MC_ASSERT(memSize >= MC_PCONV_GET_OBJECT_SIZE(power2, filterLength));
+    uintptr_t memory_addr = MC_GET_ALIGNED_PTR(memory);
+    float *twiddle = (float*)memory_addr;
+    obj->memory = memory;
+    mc_fft_get_twiddle(twiddle, MC_TWIDDLE_LENGTH(power2), power2);
+    memory_addr += sizeof(float)*MC_TWIDDLE_LENGTH(power2);
+    memory_addr = st_pconv_init(&obj->context, power2, MC_PCONV_PARTITIONS(power2, filterLength), twiddle, memory_addr);
+    MC_ASSERT(memory_addr <= (uintptr_t)obj->memory+memSize);
+    mc_pconv_set_filter(&obj->context, filter, filterLength);
+}
+
+/** Stages of non-uniform convolver: FFT length grows by 4 (the same parity of power of 2 => shared twiddle table) */
+static uint32_t st_npconv_layout(uint32_t power2, uint32_t filterLength, 
+                                 uint32_t *stagePow2, uint32_t *partitions, uint32_t *offsets) {
+    uint32_t stageCount = 0;
+    uint32_t offset = 0;
+    while ((offset < filterLength) && (MC_NPCONV_MAX_STAGES > stageCount)) {
+        const uint32_t blockLength = MC_CONV_BLOCK_LENGTH(power2);
+        uint32_t isLast = ((MC_NPCONV_MAX_STAGES - 1u) == stageCount) || ((power2 + 2u) > MC_MAX_FFT_POW2);
+        uint32_t stageParts = MC_PCONV_PARTITIONS(power2, filterLength - offset);
+        if ((!isLast) && (stageParts > MC_NPCONV_STAGE_PARTITIONS)) {
+            stageParts = MC_NPCONV_STAGE_PARTITIONS;
+        }
+        stagePow2[stageCount] = power2;
+        partitions[stageCount] = stageParts;
+        offsets[stageCount] = offset;
+        offset += stageParts*blockLength;
+        power2 += 2u;
+        ++stageCount;
+    }
+    return stageCount;
+}
+
+static uint32_t st_npconv_ring_length(uint32_t power2, const uint32_t *offsets, uint32_t stageCount) {
+    /** Ring keeps output from the current block up to the end of the last stage's block */
+    uint32_t ringLength = 1u;
+    while (ringLength < (offsets[stageCount-1u] + MC_CONV_BLOCK_LENGTH(power2))) {
+        ringLength <<= 1u;
+    }
+    return ringLength;
+}
+
+size_t mc_npconv_get_object_size(uint32_t power2, uint32_t filterLength) {
+    uint32_t stagePow2[MC_NPCONV_MAX_STAGES];
+    uint32_t partitions[MC_NPCONV_MAX_STAGES];
+    uint32_t offsets[MC_NPCONV_MAX_STAGES];
+    MC_ASSERT(MC_MAX_FFT_LENGTH >= (1u<<power2));
+    MC_ASSERT((1u<<power2) >= MC_MIN_FFT_LENGTH);
+    MC_ASSERT(filterLength > 0);
+    uint32_t stageCount = st_npconv_layout(power2, filterLength, stagePow2, partitions, offsets);
+    size_t size = MC_GET_ALIGNED_SIZE(sizeof(float)*MC_TWIDDLE_LENGTH(stagePow2[stageCount-1u]))
+                  + MC_GET_ALIGNED_SIZE(sizeof(float)*st_npconv_ring_length(power2, offsets, stageCount))
+                  + MC_MEM_ALIGNMENT;
+    for (uint32_t s = 0; s < stageCount; ++s) {
+        size += MC_PCONV_ARRAYS_SIZE(stagePow2[s], partitions[s]);
+        size += (s > 0) ? MC_GET_ALIGNED_SIZE(sizeof(float)*MC_CONV_BLOCK_LENGTH(stagePow2[s])) : 0u;
+    }
+    return size;
+}
+
+void mc_npconv_set_filter(mc_npconv_t *context, const float *filter, uint32_t filterLength) {
+    MC_NULLPTR_ASSERT(context);
+    MC_NULLPTR_ASSERT(filter);
+    MC_ASSERT(filterLength > 0);
+    for (uint32_t s = 0; s < context->stageCount; ++s) {
+        mc_pconv_t *stage = &context->stages[s];
+        const uint32_t stageLength = stage->partitions*MC_CONV_BLOCK_LENGTH(stage->pow2);
+        if (context->offsets[s] < filterLength) {
+            uint32_t length = filterLength - context->offsets[s];
+            mc_pconv_set_filter(stage, &filter[context->offsets[s]], (length < stageLength) ? length : stageLength);
+        } else {
+            memset(stage->spectra, 0, sizeof(float)*stage->partitions*MC_CONV_SPECTRUM_LENGTH(stage->pow2));
+        }
+    }
+    MC_ASSERT((context->offsets[context->stageCount-1u] + context->stages[context->stageCount-1u].partitions
+              *MC_CONV_BLOCK_LENGTH(context->stages[context->stageCount-1u].pow2)) >= filterLength);
+}
+
+void mc_npconv_reset(mc_npconv_t *context) {
+    MC_NULLPTR_ASSERT(context);
+    for (uint32_t s = 0; s < context->stageCount; ++s) {
+        mc_pconv_reset(&context->stages[s]);
+    }
+    memset(context->ring, 0, sizeof(float)*context->ringLength);
+    context->time = 0;
+}
+
+void mc_npconv_process(mc_npconv_t *context, const float *in, float *out, uint32_t length) {
+    MC_NULLPTR_ASSERT(context);
+    MC_NULLPTR_ASSERT(in);
+    MC_NULLPTR_ASSERT(out);
+    const uint32_t blockLength = MC_CONV_BLOCK_LENGTH(context->stages[0].pow2);
+    const uint32_t ringMask = context->ringLength - 1u;
+    MC_ASSERT(0 == (length % blockLength));
+
+    for (uint32_t b = 0; b < length; b += blockLength) {
+        /** Bigger stages are processed first: input must be taken before stage 0 overwrites it (in-place) */
+        for (uint32_t s = 1u; s < context->stageCount; ++s) {
+            const uint32_t stageBlock = MC_CONV_BLOCK_LENGTH(context->stages[s].pow2);
+            const uint32_t fill = context->time & (stageBlock - 1u);
+            memcpy(&context->staging[s][fill], &in[b], sizeof(float)*blockLength);
+            if ((fill + blockLength) == stageBlock) {
+                /** Output of block [time+B-B_s, time+B) is delayed by filter offset of stage */
+                const uint32_t position = context->time + blockLength - stageBlock + context->offsets[s];
+                mc_pconv_process(&context->stages[s], context->staging[s], context->staging[s], stageBlock);
+                for (uint32_t i = 0; i < stageBlock; ++i) {
+                    context->ring[(position + i) & ringMask] += context->staging[s][i];
+                }
+            }
+        }
+        mc_pconv_process(&context->stages[0], &in[b], &out[b], blockLength);
+        for (uint32_t i = 0; i < blockLength; ++i) {
+            const uint32_t position = (context->time + i) & ringMask;
+            out[b+i] += context->ring[position];
+            context->ring[position] = 0.f;
+        }
+        context->time += blockLength;
+    }
+}
+
+void mc_npconv_create_object(mc_npconv_object_t *obj, uint32_t power2, const float *filter, uint32_t filterLength, 
+                             void *memory, size_t memSize) {
+    uint32_t stagePow2[MC_NPCONV_MAX_STAGES];
+    uint32_t partitions[MC_NPCONV_MAX_STAGES];
+    MC_NULLPTR_ASSERT(obj);
+    MC_NULLPTR_ASSERT(memory);
+    MC_ASSERT(memSize >= mc_npconv_get_object_size(power2, filterLength));
+    mc_npconv_t *context = &obj->context;
+    uintptr_t memory_addr = MC_GET_ALIGNED_PTR(memory);
+    memset(context, 0, sizeof(*context));
+    obj->memory = memory;
+    context->stageCount = st_npconv_layout(power2, filterLength, stagePow2, partitions, context->offsets);
+    context->ringLength = st_npconv_ring_length(power2, context->offsets, context->stageCount);
+    const uint32_t maxPow2 = stagePow2[context->stageCount-1u];
+    context->twiddle = (float*)memory_addr;
+    mc_fft_get_twiddle(context->twiddle, MC_TWIDDLE_LENGTH(maxPow2), maxPow2);
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*MC_TWIDDLE_LENGTH(maxPow2));
+    context->ring = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*context->ringLength);
+    for (uint32_t s = 0; s < context->stageCount; ++s) {
+        const float *twiddle = &context->twiddle[MC_TWIDDLE_LENGTH(maxPow2) - MC_TWIDDLE_LENGTH(stagePow2[s])];
+        memory_addr = st_pconv_init(&context->stages[s], stagePow2[s], partitions[s], twiddle, memory_addr);
+        if (s > 0) {
+            context->staging[s] = (float*)memory_addr;
+            memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*MC_CONV_BLOCK_LENGTH(stagePow2[s]));
+        }
+    }
+    MC_ASSERT(memory_addr <= (uintptr_t)obj->memory+memSize);
+    mc_npconv_set_filter(context, filter, filterLength);
+    mc_npconv_reset(context);
+}
+
+#ifndef MC_EXCLUDE_MALLOC
+void mc_pconv_allocate(mc_pconv_object_t *obj, uint32_t power2, const float *filter, uint32_t filterLength) {
+    MC_NULLPTR_ASSERT(obj);
+    MC_ASSERT(MC_MAX_FFT_LENGTH >= (1u<<power2));
+    MC_ASSERT((1u<<power2) >= MC_MIN_FFT_LENGTH);
+    size_t memory_size = MC_PCONV_GET_OBJECT_SIZE(power2, filterLength);
+    mc_pconv_create_object(obj, power2, filter, filterLength, malloc(memory_size), memory_size);
+}
+
+void mc_pconv_free(mc_pconv_object_t *obj) {
+    MC_NULLPTR_ASSERT(obj);
+    free(obj->memory);
+}
+
+void mc_npconv_allocate(mc_npconv_object_t *obj, uint32_t power2, const float *filter, uint32_t filterLength) {
+    MC_NULLPTR_ASSERT(obj);
+    size_t memory_size = mc_npconv_get_object_size(power2, filterLength);
+    mc_npconv_create_object(obj, power2, filter, filterLength, malloc(memory_size), memory_size);
+}
+
+void mc_npconv_free(mc_npconv_object_t *obj) {
+    MC_NULLPTR_ASSERT(obj);
+    free(obj->memory);
+}
+#endif // EXCLUDE_MALLOC
@@ -0,0 +1,186 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MC_FFT_PCONV_H
+#define MC_FFT_PCONV_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "mcfft_conv.h"
+
+/** Uniformly partitioned convolver (UPOLS) of real signal with long real filter:
+ *  - Filter is split into partitions of block length B = 2^(power2-1), latency is one block
+ *  - Spectra of the last input blocks are kept in frequency-domain delay line (FDL),
+ *    output spectrum is multiply-accumulate of FDL with partition spectra (SIMD)
+ *  - As mc_conv_t: DIF forward/DIT inverse without shuffles, spectra are pre-scaled by 1/N
+ *  - Two real blocks per call share one forward FFT (spectra are split via mirror map)
+ *    and one inverse FFT
+ */
+
+/** Get the number of partitions for filter */
+#define MC_PCONV_PARTITIONS(power2, filterLength) (((filterLength) + MC_CONV_BLOCK_LENGTH(power2) - 1u) >> ((power2)-1u))
+
+/** Get memory size in bytes of convolver arrays (without twiddle factors) */
+#define MC_PCONV_ARRAYS_SIZE(power2, partitions) (2u*MC_GET_ALIGNED_SIZE(sizeof(float)*(partitions)*MC_CONV_SPECTRUM_LENGTH(power2)) \
+                                                  + 2u*MC_GET_ALIGNED_SIZE(sizeof(float)*MC_CONV_WORK_LENGTH(power2)) \
+                                                  + MC_GET_ALIGNED_SIZE(sizeof(float)*MC_CONV_HISTORY_LENGTH(power2)) \
+                                                  + MC_GET_ALIGNED_SIZE(sizeof(uint16_t)*MC_DIGIT_LENGTH(power2)))
+
+/** Uniformly partitioned convolver context */
+typedef struct mc_pconv_t {
+    /** NOTE: All arrays in structure better to align by 64 bytes.
+     *        Use mc_pconv_allocate()/mc_pconv_create_object() if possible */
+    const float *twiddle;   /* Number of twiddle elements must be == MC_TWIDDLE_LENGTH(power2) */
+    float *spectra;         /* Partition spectra: partitions x (Re then Im), digit-reversed order scaled by 1/N */
+    float *fdl;             /* Frequency-domain delay line: partitions x (Re then Im) */
+    float *work;            /* Work buffer (Re then Im) */
+    float *acc;             /* Second accumulator (Re then Im) */
+    float *history;         /* Tail of previous input block */
+    uint16_t *mirror;       /* Position of bin N-k for bin k in digit-reversed order */
+    uint32_t pow2;          /* length of FFT */
+    uint32_t partitions;    /* number of partitions */
+    uint32_t fdlIndex;      /* FDL slot of the newest input spectrum */
+} mc_pconv_t;
+
+/** Set (or replace) filter of convolver, history of input is kept
+ * 
+ * @param context Pointer to convolver context
+ * @param filter Pointer to filter coefficients
+ * @param filterLength Length of filter (must fit partitions of convolver)
+ */
+void mc_pconv_set_filter(mc_pconv_t *context, const float *filter, uint32_t filterLength);
+
+/** Reset input history of convolver (as if input was zero before) */
+void mc_pconv_reset(mc_pconv_t *context);
+
+/** Convolve next part of input stream with filter
+ * 
+ * @param context Pointer to convolver context
+ * @param in Pointer to input signal
+ * @param out Pointer to output signal (can be the same as in)
+ * @param length Length of signal (must be multiple of MC_CONV_BLOCK_LENGTH(power2))
+ */
+void mc_pconv_process(mc_pconv_t *context, const float *in, float *out, uint32_t length);
+
+/** Get uniformly partitioned convolver object size in bytes if static/non-malloc allocation is required */
+#define MC_PCONV_GET_OBJECT_SIZE(power2, filterLength) (MC_GET_ALIGNED_SIZE(sizeof(float)*MC_TWIDDLE_LENGTH(power2)) \
+                                                        + MC_PCONV_ARRAYS_SIZE(power2, MC_PCONV_PARTITIONS(power2, filterLength)) \
+                                                        + MC_MEM_ALIGNMENT)
+
+/** Uniformly partitioned convolver object (see mc_pconv_t) */
+typedef struct mc_pconv_object_t {
+    mc_pconv_t context;
+    void *memory;
+} mc_pconv_object_t;
+
+/** Create uniformly partitioned convolver object based on allocated memory (non-malloc API)
+ * 
+ * @param obj Pointer to user's structure where object will be created
+ * @param power2 Power of 2 which reflects required length of FFT (block length is half of it)
+ * @param filter Pointer to filter coefficients
+ * @param filterLength Length of filter
+ * @param memory Pointer to user's memory which used to create object
+ * @param memSize User's memory size in bytes (see MC_PCONV_GET_OBJECT_SIZE(power2, filterLength))
+ */
+void mc_pconv_create_object(mc_pconv_object_t *obj, uint32_t power2, const float *filter, uint32_t filterLength, 
+                            void *memory, size_t memSize);
+
+/** Allocate uniformly partitioned convolver object via malloc/free API (can be excluded by defining EXCLUDE_MALLOC macro) */
+void mc_pconv_allocate(mc_pconv_object_t *obj, uint32_t power2, const float *filter, uint32_t filterLength);
+
+/** Release uniformly partitioned convolver object via malloc/free API (can be excluded by defining EXCLUDE_MALLOC macro) */
+void mc_pconv_free(mc_pconv_object_t *obj);
+
+/** Max number of stages of non-uniformly partitioned convolver */
+#define MC_NPCONV_MAX_STAGES (4u)
+/** Number of partitions per stage (except the last one which takes the rest of filter) */
+#define MC_NPCONV_STAGE_PARTITIONS (4u)
+
+/** Non-uniformly partitioned convolver:
+ *  - Stage 0 is uniform convolver with block B (latency), each next stage has 4x bigger block
+ *    and covers the next part of filter (4 partitions), the last stage covers the rest of filter
+ *  - Stage s starts at filter offset >= B_s - B, so its output is ready in time (synchronous: stage
+ *    is processed in the call which completes its block, output is delayed via ring buffer)
+ *  - All stages share one twiddle table (table of smaller FFT is the tail of table of 4x bigger FFT)
+ */
+typedef struct mc_npconv_t {
+    mc_pconv_t stages[MC_NPCONV_MAX_STAGES];
+    float *twiddle;                             /* Twiddle table of the biggest stage */
+    float *staging[MC_NPCONV_MAX_STAGES];       /* Input/output block of stage (unused for stage 0) */
+    uint32_t offsets[MC_NPCONV_MAX_STAGES];     /* Filter offset of stage */
+    float *ring;                                /* Delayed output of stages */
+    uint32_t ringLength;                        /* Power of 2 */
+    uint32_t time;                              /* Number of processed samples */
+    uint32_t stageCount;
+} mc_npconv_t;
+
+/** Set (or replace) filter of convolver, filter length must be <= length used to create object */
+void mc_npconv_set_filter(mc_npconv_t *context, const float *filter, uint32_t filterLength);
+
+/** Reset input history of convolver (as if input was zero before) */
+void mc_npconv_reset(mc_npconv_t *context);
+
+/** Convolve next part of input stream with filter
+ * 
+ * @param context Pointer to convolver context
+ * @param in Pointer to input signal
+ * @param out Pointer to output signal (can be the same as in)
+ * @param length Length of signal (must be multiple of MC_CONV_BLOCK_LENGTH(power2))
+ */
+void mc_npconv_process(mc_npconv_t *context, const float *in, float *out, uint32_t length);
+
+/** Get non-uniformly partitioned convolver object size in bytes (see mc_npconv_create_object()) */
+size_t mc_npconv_get_object_size(uint32_t power2, uint32_t filterLength);
+
+/** Non-uniformly partitioned convolver object (see mc_npconv_t) */
+typedef struct mc_npconv_object_t {
+    mc_npconv_t context;
+    void *memory;
+} mc_npconv_object_t;
+
+/** Create non-uniformly partitioned convolver object based on allocated memory (non-malloc API)
+ * 
+ * @param obj Pointer to user's structure where object will be created
+ * @param power2 Power of 2 which reflects FFT length of the first stage (block length is half of it)
+ * @param filter Pointer to filter coefficients
+ * @param filterLength Length of filter
+ * @param memory Pointer to user's memory which used to create object
+ * @param memSize User's memory size in bytes (see mc_npconv_get_object_size())
+ */
+void mc_npconv_create_object(mc_npconv_object_t *obj, uint32_t power2, const float *filter, uint32_t filterLength, 
+                             void *memory, size_t memSize);
+
+/** Allocate non-uniformly partitioned convolver object via malloc/free API (can be excluded by defining EXCLUDE_MALLOC macro) */
+void mc_npconv_allocate(mc_npconv_object_t *obj, uint32_t power2, const float *filter, uint32_t filterLength);
+
+/** Release non-uniformly partitioned convolver object via malloc/free API (can be excluded by defining EXCLUDE_MALLOC macro) */
+void mc_npconv_free(mc_npconv_object_t *obj);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MC_FFT_PCONV_H */
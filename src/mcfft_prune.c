@@ -0,0 +1,264 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "mcfft_prune.h"
+#include "generic/mcfft_generic.h"
+#include "x86/mcfft_avx.h"
+#include "aarch64/mcfft_neon.h"
+#include <math.h>
+
+#ifndef MC_SELECTOR
+#define MC_SELECTOR g
+#endif
+
+/** Minimal block length (power of 2) supported by the last stages of DIF core (odd/even power of 2) */
+#define MC_FFT_PRUNE_MIN_POW2(power2) (((power2)%2u) ? 3u : 4u)
+/** Row length of modulation factors (multiple of vector length of spectrum kernels) */
+#define MC_FFT_PRUNE_ROW_LENGTH(length) (((length) + 7u) & ~7u)
+
+typedef struct mc_fft_prune_plan_t {
+    uint32_t inPow2;
+    uint32_t outPow2;
+    uint32_t modulationLength;
+    uint32_t kernelLength;
+} mc_fft_prune_plan_t;
+
+static uint32_t st_prune_kernel_width(uint32_t inPow2, uint32_t outPow2, uint32_t inLength) {
+    /** No stages between pruning of input and output: sums over non-zero samples only */
+    return (inPow2 == outPow2) ? inLength : (1u<<outPow2);
+}
+
+static mc_fft_prune_plan_t st_prune_get_plan(uint32_t power2, uint32_t inLength, uint32_t outLength) {
+    mc_fft_prune_plan_t plan = {power2, 0, 0, 0};
+    const uint64_t fftLength = 1u<<power2;
+    /** Cost model (in units of ~0.1ns per point, measured on AVX):
+     *  3 per point of radix-4 stage, 3 per complex multiply of modulation/sums, 
+     *  digit reverse 8 per point, scalar gather 12 per bin */
+    const uint64_t gatherCost = (outLength > (fftLength>>1u)) ? (8u*fftLength + 2u*outLength) : (12u*(uint64_t)outLength);
+    uint64_t bestCost = UINT64_MAX;
+    for (uint32_t inPow2 = power2; (inPow2 >= MC_FFT_PRUNE_MIN_POW2(power2)) && (inLength <= (1u<<inPow2)); inPow2 -= 2u) {
+        const uint64_t blocks = fftLength>>inPow2;
+        const uint64_t spreadCost = fftLength + ((blocks > 1u) ? 3u*blocks*inLength : 0);
+        /** Complete DIF core after input pruning */
+        uint64_t cost = spreadCost + ((3u*fftLength*inPow2)>>1u) + gatherCost;
+        if (cost < bestCost) {
+            bestCost = cost;
+            plan.inPow2 = inPow2;
+            plan.outPow2 = 0;
+        }
+        /** Early stop of DIF core with sums for requested bins only */
+        for (uint32_t outPow2 = inPow2; outPow2 >= MC_FFT_PRUNE_MIN_POW2(power2); outPow2 -= 2u) {
+            const uint64_t width = st_prune_kernel_width(inPow2, outPow2, inLength);
+            cost = spreadCost + ((3u*fftLength*(inPow2 - outPow2))>>1u) + 3u*outLength*width;
+            if (cost < bestCost) {
+                bestCost = cost;
+                plan.inPow2 = inPow2;
+                plan.outPow2 = outPow2;
+            }
+        }
+    }
+    plan.modulationLength = (plan.inPow2 < power2) ? 2u*MC_FFT_PRUNE_ROW_LENGTH(inLength)*(1u<<(power2 - plan.inPow2)) : 0;
+    plan.kernelLength = (0 != plan.outPow2) ? 2u*outLength*st_prune_kernel_width(plan.inPow2, plan.outPow2, inLength) : 0;
+    return plan;
+}
+
+static uint32_t st_prune_reverse(uint32_t value, uint32_t digits) {
+    /** Block b after radix-4 DIF stages holds bins with residue digit_reverse4(b) mod P and vice versa */
+    uint32_t result = 0;
+    for (uint32_t i = 0; i < digits; ++i) {
+        result = (result<<2u) | (value & 3u);
+        value >>= 2u;
+    }
+    return result;
+}
+
+static void st_prune_spread(mc_fft_prune_t *context, const float *inRe, const float *inIm) {
+    const uint32_t fftLength = 1u<<context->pow2;
+    const uint32_t blockLength = 1u<<context->inPow2;
+    const uint32_t blocks = fftLength>>context->inPow2;
+    const uint32_t inLength = context->inLength;
+    float * restrict re = context->work;
+    float * restrict im = &context->work[fftLength];
+
+    if (1u == blocks) {
+        memcpy(re, inRe, sizeof(float)*inLength);
+        memset(&re[inLength], 0, sizeof(float)*(fftLength - inLength));
+        if (NULL != inIm) {
+            memcpy(im, inIm, sizeof(float)*inLength);
+            memset(&im[inLength], 0, sizeof(float)*(fftLength - inLength));
+        } else {
+            memset(im, 0, sizeof(float)*fftLength);
+        }
+        return;
+    }
+    /** The first radix-4 stages on zeros: block b = x[n]*W^(n*r(b)), rows of modulation are padded by zeros */
+    const uint32_t width = MC_FFT_PRUNE_ROW_LENGTH(inLength);
+    const float *tRe = context->modulation;
+    const float *tIm = &context->modulation[blocks*width];
+    for (uint32_t b = 0; b < blocks; ++b) {
+        float *bRe = &re[b*blockLength];
+        float *bIm = &im[b*blockLength];
+        memcpy(bRe, inRe, sizeof(float)*inLength);
+        memset(&bRe[inLength], 0, sizeof(float)*(blockLength - inLength));
+        if (NULL != inIm) {
+            memcpy(bIm, inIm, sizeof(float)*inLength);
+            memset(&bIm[inLength], 0, sizeof(float)*(blockLength - inLength));
+        } else {
+            memset(bIm, 0, sizeof(float)*blockLength);
+        }
+        MC_FUNC_CALL(spectrum_mul, MC_SELECTOR)(bRe, bIm, &tRe[b*width], &tIm[b*width], width);
+    }
+}
+
+void mc_fft_prune(mc_fft_prune_t *context, const float *inRe, const float *inIm, float *outRe, float *outIm) {
+    MC_NULLPTR_ASSERT(context);
+    MC_NULLPTR_ASSERT(inRe);
+    MC_NULLPTR_ASSERT(outRe);
+    MC_NULLPTR_ASSERT(outIm);
+    const uint32_t fftLength = 1u<<context->pow2;
+    const uint32_t outLength = context->outLength;
+    float * restrict re = context->work;
+    float * restrict im = &context->work[fftLength];
+
+    st_prune_spread(context, inRe, inIm);
+    /** All stages of DIF core between pruned input and pruned output on the whole buffer */
+    MC_FUNC_CALL(fft_dif_mono_range, MC_SELECTOR)(re, im, context->twiddle, context->pow2, 
+                                                   1u<<context->inPow2, (0 != context->outPow2) ? (1u<<context->outPow2) : 0);
+    if (0 == context->outPow2) {
+        /** Output is the same as full DIF core: gather requested bins only (digit reverse of all if most are required) */
+        const uint16_t *dif_map = (const uint16_t*)&context->digitRev[fftLength>>1u];
+        if (outLength > (fftLength>>1u)) {
+            MC_FUNC_CALL(shuffle_mono, MC_SELECTOR)(re, im, context->buffer, dif_map, fftLength);
+            memcpy(outRe, &re[context->outStart], sizeof(float)*outLength);
+            memcpy(outIm, &im[context->outStart], sizeof(float)*outLength);
+        } else {
+            for (uint32_t k = 0; k < outLength; ++k) {
+                const uint32_t idx = dif_map[context->outStart + k];
+                outRe[k] = re[idx];
+                outIm[k] = im[idx];
+            }
+        }
+    } else {
+        /** The last radix-4 stages for requested bins only: X[r + P*q] = sum(y_b[m] * W_M^(m*q)), b = reverse(r) */
+        const uint32_t blockPow2 = context->outPow2;
+        const uint32_t digits = (context->pow2 - blockPow2)>>1u;
+        const uint32_t width = st_prune_kernel_width(context->inPow2, blockPow2, context->inLength);
+        const float *kRe = context->kernel;
+        const float *kIm = &context->kernel[outLength*width];
+        for (uint32_t k = 0; k < outLength; ++k) {
+            const uint32_t bin = context->outStart + k;
+            const uint32_t offset = st_prune_reverse(bin & ((1u<<(digits<<1u)) - 1u), digits)<<blockPow2;
+            MC_FUNC_CALL(spectrum_dot, MC_SELECTOR)(&outRe[k], &outIm[k], &re[offset], &im[offset], 
+                                                    &kRe[k*width], &kIm[k*width], width);
+        }
+    }
+}
+
+size_t mc_fft_prune_get_object_size(uint32_t power2, uint32_t inLength, uint32_t outStart, uint32_t outLength) {
+    MC_ASSERT(MC_MAX_FFT_LENGTH >= (1u<<power2));
+    MC_ASSERT((1u<<power2) >= MC_MIN_FFT_LENGTH);
+    MC_ASSERT((inLength > 0) && (inLength <= (1u<<power2)));
+    MC_ASSERT((outLength > 0) && ((outStart + outLength) <= (1u<<power2)));
+    (void)outStart;
+    mc_fft_prune_plan_t plan = st_prune_get_plan(power2, inLength, outLength);
+    return MC_GET_ALIGNED_SIZE(sizeof(float)*MC_TWIDDLE_LENGTH(power2)) 
+           + MC_GET_ALIGNED_SIZE(sizeof(uint32_t)*MC_DIGIT_LENGTH(power2)) 
+           + 2u*MC_GET_ALIGNED_SIZE(sizeof(float)*(2u<<power2))
+           + MC_GET_ALIGNED_SIZE(sizeof(float)*plan.modulationLength)
+           + MC_GET_ALIGNED_SIZE(sizeof(float)*plan.kernelLength)
+           + MC_MEM_ALIGNMENT;
+}
+
+void mc_fft_prune_create_object(mc_fft_prune_object_t *obj, uint32_t power2, uint32_t inLength, 
+                                uint32_t outStart, uint32_t outLength, void *memory, size_t memSize) {
+    MC_NULLPTR_ASSERT(obj);
+    MC_NULLPTR_ASSERT(memory);
+    MC_ASSERT(memSize >= mc_fft_prune_get_object_size(power2, inLength, outStart, outLength));
+    const uint32_t fftLength = 1u<<power2;
+    mc_fft_prune_plan_t plan = st_prune_get_plan(power2, inLength, outLength);
+    const double phi = -2. * (double)MC_PI / (double)fftLength;
+    uintptr_t memory_addr = 0;
+    memset(&obj->context, 0, sizeof(obj->context));
+    obj->memory = memory;
+    obj->context.pow2 = power2;
+    obj->context.inPow2 = plan.inPow2;
+    obj->context.outPow2 = plan.outPow2;
+    obj->context.inLength = inLength;
+    obj->context.outStart = outStart;
+    obj->context.outLength = outLength;
+    memory_addr = MC_GET_ALIGNED_PTR(obj->memory);
+    obj->context.twiddle = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*MC_TWIDDLE_LENGTH(power2));
+    obj->context.digitRev = (uint32_t*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(uint32_t)*MC_DIGIT_LENGTH(power2));
+    obj->context.work = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*2u*fftLength);
+    obj->context.buffer = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*2u*fftLength);
+    obj->context.modulation = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*plan.modulationLength);
+    obj->context.kernel = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*plan.kernelLength);
+    MC_ASSERT(memory_addr <= (uintptr_t)obj->memory+memSize);
+    mc_fft_get_twiddle(obj->context.twiddle, MC_TWIDDLE_LENGTH(power2), power2);
+    mc_fft_get_digitRev(obj->context.digitRev, MC_DIGIT_LENGTH(power2), power2);
+
+    /** Modulation is [block][n]: W_N^(n*r(b)), Re then Im */
+    const uint32_t blocks = fftLength>>plan.inPow2;
+    const uint32_t width = MC_FFT_PRUNE_ROW_LENGTH(inLength);
+    for (uint32_t b = 0; (0 != plan.modulationLength) && (b < blocks); ++b) {
+        const uint64_t residue = st_prune_reverse(b, (power2 - plan.inPow2)>>1u);
+        for (uint32_t n = 0; n < width; ++n) {
+            double angle = phi * (double)((residue * n) & (fftLength - 1u));
+            obj->context.modulation[b*width + n] = (n < inLength) ? (float)cos(angle) : 0.f;
+            obj->context.modulation[(blocks + b)*width + n] = (n < inLength) ? (float)sin(angle) : 0.f;
+        }
+    }
+    /** Sums are [bin][m]: W_N^(m*q*P) = W_M^(m*q), q = bin / P, Re then Im */
+    if (0 != plan.kernelLength) {
+        const uint32_t kernelWidth = st_prune_kernel_width(plan.inPow2, plan.outPow2, inLength);
+        const uint32_t blockPow2 = plan.outPow2;
+        for (uint32_t k = 0; k < outLength; ++k) {
+            const uint64_t q = ((outStart + k)>>(power2 - blockPow2))<<(power2 - blockPow2);
+            for (uint32_t m = 0; m < kernelWidth; ++m) {
+                double angle = phi * (double)((q * m) & (fftLength - 1u));
+                obj->context.kernel[k*kernelWidth + m] = (float)cos(angle);
+                obj->context.kernel[(outLength + k)*kernelWidth + m] = (float)sin(angle);
+            }
+        }
+    }
+}
+
+#ifndef MC_EXCLUDE_MALLOC
+void mc_fft_prune_allocate(mc_fft_prune_object_t *obj, uint32_t power2, uint32_t inLength, 
+                           uint32_t outStart, uint32_t outLength) {
+    MC_NULLPTR_ASSERT(obj);
+    size_t memory_size = mc_fft_prune_get_object_size(power2, inLength, outStart, outLength);
+    mc_fft_prune_create_object(obj, power2, inLength, outStart, outLength, malloc(memory_size), memory_size);
+}
+
+void mc_fft_prune_free(mc_fft_prune_object_t *obj) {
+    MC_NULLPTR_ASSERT(obj);
+    free(obj->memory);
+}
+#endif // EXCLUDE_MALLOC
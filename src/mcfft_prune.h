@@ -0,0 +1,104 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MC_FFT_PRUNE_H
+#define MC_FFT_PRUNE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "mcfft.h"
+
+/** Pruned forward FFT: only the first inLength input samples are non-zero and/or 
+ *  only outLength bins starting from outStart are required (natural order)
+ *  - Input pruning: the first radix-4 DIF stages on zeros collapse to modulation of the non-zero part 
+ *    to P blocks of 2^inPow2 points (butterflies on zeros are skipped)
+ *  - Output pruning: the last radix-4 DIF stages are replaced by 2^outPow2-point sums for requested bins only
+ *  - Remaining stages run on the DIF core with the same twiddle table
+ *  - The cheapest combination is chosen by plan (see mc_fft_prune_create_object())
+ */
+
+/** Pruned FFT context with pre-calculated values and buffers required */
+typedef struct mc_fft_prune_t {
+    /** NOTE: All arrays in structure better to align by 64 bytes.
+     *        Use mc_fft_prune_allocate()/mc_fft_prune_create_object() if possible */
+    float *twiddle;         /* Number of twiddle elements must be == MC_TWIDDLE_LENGTH(power2) */
+    uint32_t *digitRev;     /* Number of digit elements must be == MC_DIGIT_LENGTH(power2) */
+    float *work;            /* Work buffer (Re then Im) */
+    float *buffer;          /* Buffer of digit reverse (Re then Im) */
+    float *modulation;      /* Modulation factors of input pruning [block][n] (Re then Im) */
+    float *kernel;          /* Sum factors of output pruning [bin][m] (Re then Im) */
+    uint32_t pow2;          /* length of FFT */
+    uint32_t inPow2;        /* length of blocks after input pruning (== pow2 if input is not pruned) */
+    uint32_t outPow2;       /* length of blocks replaced by sums (0 if output is not pruned) */
+    uint32_t inLength;      /* number of non-zero input samples */
+    uint32_t outStart;      /* the first requested bin */
+    uint32_t outLength;     /* number of requested bins */
+} mc_fft_prune_t;
+
+/** Pruned forward FFT
+ * 
+ * @param context Pointer to pruned FFT context
+ * @param inRe Pointer to real part of signal (inLength samples, the rest is zero)
+ * @param inIm Pointer to imag part of signal (inLength samples, can be NULL for real signal)
+ * @param outRe Pointer to real part of requested bins (outLength bins from outStart)
+ * @param outIm Pointer to imag part of requested bins (outLength bins from outStart)
+ */
+void mc_fft_prune(mc_fft_prune_t *context, const float *inRe, const float *inIm, float *outRe, float *outIm);
+
+/** Get pruned FFT object size in bytes (see mc_fft_prune_create_object()) */
+size_t mc_fft_prune_get_object_size(uint32_t power2, uint32_t inLength, uint32_t outStart, uint32_t outLength);
+
+/** Pruned FFT object to control memory alignment and simplify allocation of memory (see mc_fft_prune_t) */
+typedef struct mc_fft_prune_object_t {
+    mc_fft_prune_t context;
+    void *memory;
+} mc_fft_prune_object_t;
+
+/** Create pruned FFT object (plan) based on allocated memory (non-malloc API)
+ * 
+ * @param obj Pointer to user's structure where object will be created
+ * @param power2 Power of 2 which reflects required length of FFT
+ * @param inLength Number of non-zero input samples (1..2^power2)
+ * @param outStart The first requested bin
+ * @param outLength Number of requested bins (outStart + outLength <= 2^power2)
+ * @param memory Pointer to user's memory which used to create object
+ * @param memSize User's memory size in bytes (see mc_fft_prune_get_object_size())
+ */
+void mc_fft_prune_create_object(mc_fft_prune_object_t *obj, uint32_t power2, uint32_t inLength, 
+                                uint32_t outStart, uint32_t outLength, void *memory, size_t memSize);
+
+/** Allocate pruned FFT object via malloc/free API (can be excluded by defining EXCLUDE_MALLOC macro) */
+void mc_fft_prune_allocate(mc_fft_prune_object_t *obj, uint32_t power2, uint32_t inLength, 
+                           uint32_t outStart, uint32_t outLength);
+
+/** Release pruned FFT object via malloc/free API (can be excluded by defining EXCLUDE_MALLOC macro) */
+void mc_fft_prune_free(mc_fft_prune_object_t *obj);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MC_FFT_PRUNE_H */
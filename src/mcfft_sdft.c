@@ -0,0 +1,177 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "mcfft_sdft.h"
+#include "generic/mcfft_generic.h"
+#include "x86/mcfft_avx.h"
+#include "aarch64/mcfft_neon.h"
+#include <math.h>
+
+#ifndef MC_SELECTOR
+#define MC_SELECTOR g
+#endif
+
+void mc_sdft_resync(mc_sdft_t *context) {
+    MC_NULLPTR_ASSERT(context);
+    const uint32_t fftLength = 1u<<context->fft.pow2;
+    const uint32_t binCount = context->binCount;
+    float *re = context->work;
+    float *im = &context->work[fftLength];
+    /** Ring is indexed by n mod N, so its FFT is modulated spectrum S[k] = sum(x[n] * W^(k*(n mod N))) */
+    memcpy(re, context->ring, sizeof(float)*fftLength);
+    memset(im, 0, sizeof(float)*fftLength);
+    mc_fft_mono(&context->fft, re, im, fftLength);
+    if (MC_SDFT_MODULATED == context->variant) {
+        memcpy(context->state, &re[context->binStart], sizeof(float)*binCount);
+        memcpy(&context->state[binCount], &im[context->binStart], sizeof(float)*binCount);
+    } else {
+        MC_FUNC_CALL(spectrum_sdft_demodulate, MC_SELECTOR)(context->state, &context->state[binCount], 
+                                                            &re[context->binStart], &im[context->binStart], 
+                                                            context->phasor, &context->phasor[fftLength], 
+                                                            (context->ringPos*context->binStart) & (fftLength - 1u), 
+                                                            context->ringPos, fftLength - 1u, binCount);
+    }
+    context->pending = context->resync;
+}
+
+void mc_sdft_init(mc_sdft_t *context, const float *frame) {
+    MC_NULLPTR_ASSERT(context);
+    const uint32_t fftLength = 1u<<context->fft.pow2;
+    if (NULL != frame) {
+        memcpy(context->ring, frame, sizeof(float)*fftLength);
+    } else {
+        memset(context->ring, 0, sizeof(float)*fftLength);
+    }
+    context->ringPos = 0;
+    mc_sdft_resync(context);
+}
+
+void mc_sdft_process(mc_sdft_t *context, const float *in, uint32_t length) {
+    MC_NULLPTR_ASSERT(context);
+    MC_NULLPTR_ASSERT(in);
+    const uint32_t fftLength = 1u<<context->fft.pow2;
+    const uint32_t mask = fftLength - 1u;
+    const uint32_t binCount = context->binCount;
+    float *sRe = context->state;
+    float *sIm = &context->state[binCount];
+    const float *wRe = context->phasor;
+    const float *wIm = &context->phasor[fftLength];
+
+    for (uint32_t i = 0; i < length; ++i) {
+        const uint32_t pos = context->ringPos;
+        const float delta = in[i] - context->ring[pos];
+        context->ring[pos] = in[i];
+        context->ringPos = (pos + 1u) & mask;
+        if (MC_SDFT_MODULATED == context->variant) {
+            MC_FUNC_CALL(spectrum_sdft_modulate, MC_SELECTOR)(sRe, sIm, wRe, wIm, delta, 
+                                                              (pos*context->binStart) & mask, pos, mask, binCount);
+        } else {
+            MC_FUNC_CALL(spectrum_sdft_rotate, MC_SELECTOR)(sRe, sIm, &wRe[context->binStart], &wIm[context->binStart], 
+                                                            delta, binCount);
+        }
+        if ((0 != context->resync) && (0 == --context->pending)) {
+            mc_sdft_resync(context);
+        }
+    }
+}
+
+void mc_sdft_get_spectrum(const mc_sdft_t *context, float *outRe, float *outIm) {
+    MC_NULLPTR_ASSERT(context);
+    MC_NULLPTR_ASSERT(outRe);
+    MC_NULLPTR_ASSERT(outIm);
+    const uint32_t fftLength = 1u<<context->fft.pow2;
+    const uint32_t binCount = context->binCount;
+    if (MC_SDFT_MODULATED == context->variant) {
+        /** Window starts at sample n+1-N, i.e. at index ringPos of ring buffer */
+        MC_FUNC_CALL(spectrum_sdft_demodulate, MC_SELECTOR)(outRe, outIm, context->state, &context->state[binCount], 
+                                                            context->phasor, &context->phasor[fftLength], 
+                                                            (context->ringPos*context->binStart) & (fftLength - 1u), 
+                                                            context->ringPos, fftLength - 1u, binCount);
+    } else {
+        memcpy(outRe, context->state, sizeof(float)*binCount);
+        memcpy(outIm, &context->state[binCount], sizeof(float)*binCount);
+    }
+}
+
+void mc_sdft_create_object(mc_sdft_object_t *obj, uint32_t power2, uint32_t variant, uint32_t binStart, uint32_t binCount, 
+                           uint32_t resync, void *memory, size_t memSize) {
+    MC_NULLPTR_ASSERT(obj);
+    MC_NULLPTR_ASSERT(memory);
+    MC_ASSERT(MC_MAX_FFT_LENGTH >= (1u<<power2));
+    MC_ASSERT((1u<<power2) >= MC_MIN_FFT_LENGTH);
+    MC_ASSERT((MC_SDFT_CLASSIC == variant) || (MC_SDFT_MODULATED == variant));
+    MC_ASSERT((binCount > 0) && ((binStart + binCount) <= (1u<<power2)));
+    MC_ASSERT(memSize >= MC_SDFT_GET_OBJECT_SIZE(power2));
+    const uint32_t fftLength = 1u<<power2;
+    const double phi = -2. * (double)MC_PI / (double)fftLength;
+    uintptr_t memory_addr = 0;
+    memset(&obj->context, 0, sizeof(obj->context));
+    obj->memory = memory;
+    obj->context.variant = variant;
+    obj->context.binStart = binStart;
+    obj->context.binCount = binCount;
+    obj->context.resync = resync;
+    obj->context.fft.pow2 = power2;
+    memory_addr = MC_GET_ALIGNED_PTR(obj->memory);
+    obj->context.fft.buffer = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*MC_BUFFER_LENGTH(power2));
+    obj->context.fft.bufLength = MC_BUFFER_LENGTH(power2);
+    obj->context.fft.digitRev = (uint32_t*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(uint32_t)*MC_DIGIT_LENGTH(power2));
+    obj->context.fft.twiddle = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*MC_TWIDDLE_LENGTH(power2));
+    obj->context.phasor = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*2u*fftLength);
+    obj->context.state = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*2u*fftLength);
+    obj->context.work = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*2u*fftLength);
+    obj->context.ring = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*fftLength);
+    MC_ASSERT(memory_addr <= (uintptr_t)obj->memory+memSize);
+    mc_fft_get_digitRev(obj->context.fft.digitRev, MC_DIGIT_LENGTH(power2), power2);
+    mc_fft_get_twiddle(obj->context.fft.twiddle, MC_TWIDDLE_LENGTH(power2), power2);
+    mc_fft_plan(&obj->context.fft, MC_FFT_PLAN_ESTIMATE, NULL, NULL, fftLength);
+    for (uint32_t j = 0; j < fftLength; ++j) {
+        obj->context.phasor[j] = (float)cos(phi * (double)j);
+        obj->context.phasor[fftLength + j] = (float)sin(phi * (double)j);
+    }
+    mc_sdft_init(&obj->context, NULL);
+}
+
+#ifndef MC_EXCLUDE_MALLOC
+void mc_sdft_allocate(mc_sdft_object_t *obj, uint32_t power2, uint32_t variant, uint32_t binStart, uint32_t binCount, 
+                      uint32_t resync) {
+    MC_NULLPTR_ASSERT(obj);
+    MC_ASSERT(MC_MAX_FFT_LENGTH >= (1u<<power2));
+    MC_ASSERT((1u<<power2) >= MC_MIN_FFT_LENGTH);
+    size_t memory_size = MC_SDFT_GET_OBJECT_SIZE(power2);
+    mc_sdft_create_object(obj, power2, variant, binStart, binCount, resync, malloc(memory_size), memory_size);
+}
+
+void mc_sdft_free(mc_sdft_object_t *obj) {
+    MC_NULLPTR_ASSERT(obj);
+    free(obj->memory);
+}
+#endif // EXCLUDE_MALLOC
@@ -0,0 +1,126 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MC_FFT_SDFT_H
+#define MC_FFT_SDFT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "mcfft.h"
+
+/** Sliding DFT of real signal: spectrum of the last N = 2^power2 samples is updated per sample
+ *  for selected bins only (binCount bins from binStart), O(binCount) per sample
+ *  - MC_SDFT_CLASSIC: X[k] = (X[k] + x[n] - x[n-N]) * W^-k (one complex multiply per bin,
+ *    rounding of twiddles accumulates over time, resync is recommended)
+ *  - MC_SDFT_MODULATED: S[k] = S[k] + (x[n] - x[n-N]) * W^(k*(n mod N)), X[k] = S[k] * W^(-k*(n+1)) on read
+ *    (no feedback of twiddles, stable, error grows slowly)
+ *  - State is recalculated by mc_fft_mono() of input history every resync samples (0 - never)
+ */
+
+/** Sliding DFT variants */
+#define MC_SDFT_CLASSIC   (0u)
+#define MC_SDFT_MODULATED (1u)
+
+/** Sliding DFT context with pre-calculated values and buffers required */
+typedef struct mc_sdft_t {
+    /** NOTE: All arrays in structure better to align by 64 bytes.
+     *        Use mc_sdft_allocate()/mc_sdft_create_object() if possible */
+    mc_fft_t fft;           /* FFT context used to initialise and resync state */
+    float *phasor;          /* W^j = exp(-2*pi*j/N), N values (Re then Im) */
+    float *ring;            /* The last N input samples, sample x[n] is at index n mod N */
+    float *state;           /* Spectrum (classic) or modulated spectrum (modulated) of selected bins (Re then Im) */
+    float *work;            /* Work buffer (Re then Im) */
+    uint32_t variant;       /* MC_SDFT_* */
+    uint32_t binStart;      /* the first selected bin */
+    uint32_t binCount;      /* number of selected bins */
+    uint32_t resync;        /* resync period in samples (0 - never) */
+    uint32_t ringPos;       /* index of the next sample in ring buffer (n+1 mod N) */
+    uint32_t pending;       /* number of samples till the next resync */
+} mc_sdft_t;
+
+/** Get sliding DFT object size in bytes if static/non-malloc allocation is required */
+#define MC_SDFT_GET_OBJECT_SIZE(power2) (MC_FFT_GET_OBJECT_SIZE(power2) \
+                                         + 3u*MC_GET_ALIGNED_SIZE(sizeof(float)*(2u<<(power2))) \
+                                         + MC_GET_ALIGNED_SIZE(sizeof(float)*(1u<<(power2))))
+
+/** Initialise state from N samples by full FFT
+ * 
+ * @param context Pointer to sliding DFT context
+ * @param frame Pointer to the last N samples (oldest first), NULL - zeros
+ */
+void mc_sdft_init(mc_sdft_t *context, const float *frame);
+
+/** Slide the window by input samples (state is updated per sample)
+ * 
+ * @param context Pointer to sliding DFT context
+ * @param in Pointer to input signal
+ * @param length Length of input signal (any)
+ */
+void mc_sdft_process(mc_sdft_t *context, const float *in, uint32_t length);
+
+/** Get spectrum of the last N samples for selected bins
+ * 
+ * @param context Pointer to sliding DFT context
+ * @param outRe Pointer to real part of spectrum (binCount bins)
+ * @param outIm Pointer to imag part of spectrum (binCount bins)
+ */
+void mc_sdft_get_spectrum(const mc_sdft_t *context, float *outRe, float *outIm);
+
+/** Recalculate state by full FFT of input history (called by mc_sdft_process() every resync samples) */
+void mc_sdft_resync(mc_sdft_t *context);
+
+/** Sliding DFT object to control memory alignment and simplify allocation of memory (see mc_sdft_t) */
+typedef struct mc_sdft_object_t {
+    mc_sdft_t context;
+    void *memory;
+} mc_sdft_object_t;
+
+/** Create sliding DFT object based on allocated memory (non-malloc API), state is initialised by zeros
+ * 
+ * @param obj Pointer to user's structure where object will be created
+ * @param power2 Power of 2 which reflects length of sliding window
+ * @param variant Sliding DFT variant (MC_SDFT_*)
+ * @param binStart The first selected bin
+ * @param binCount Number of selected bins (binStart + binCount <= 2^power2)
+ * @param resync Resync period in samples (0 - never)
+ * @param memory Pointer to user's memory which used to create object
+ * @param memSize User's memory size in bytes (see MC_SDFT_GET_OBJECT_SIZE(power2))
+ */
+void mc_sdft_create_object(mc_sdft_object_t *obj, uint32_t power2, uint32_t variant, uint32_t binStart, uint32_t binCount, 
+                           uint32_t resync, void *memory, size_t memSize);
+
+/** Allocate sliding DFT object via malloc/free API (can be excluded by defining EXCLUDE_MALLOC macro) */
+void mc_sdft_allocate(mc_sdft_object_t *obj, uint32_t power2, uint32_t variant, uint32_t binStart, uint32_t binCount, 
+                      uint32_t resync);
+
+/** Release sliding DFT object via malloc/free API (can be excluded by defining EXCLUDE_MALLOC macro) */
+void mc_sdft_free(mc_sdft_object_t *obj);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MC_FFT_SDFT_H */
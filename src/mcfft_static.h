@@ -0,0 +1,83 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MC_FFT_STATIC_H
+#define MC_FFT_STATIC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "mcfft.h"
+
+/** Static (compile-time) FFT context for the FFT length known at build time:
+ *  - Twiddle & digit reverse tables are placed to read-only memory (.rodata), no startup cost
+ *  - Only buffer of context is writable memory
+ *
+ * Tables must be generated by mcfft_static_gen (see mc_fft_generate_static_tables() in CMake)
+ * and generated header must be included before usage of MC_FFT_STATIC_DEFINE(), for instance:
+ *
+ *     #include "mcfft_static.h"
+ *     #include "mcfft_static_tables.h"
+ *     MC_FFT_STATIC_DEFINE(fft256, 8)
+ *     ...
+ *     fft256_fft(re, im);  // the same as mc_fft_mono(&fft256, re, im, 256)
+ *
+ * NOTE: Power of 2 must be integer literal (used to concatenate name of generated table)
+ * NOTE: Context is not thread-safe as mc_fft_t (buffer is shared), define one context per thread
+ * NOTE: C11 only, see mcfft_static.hpp for C++17 version (tables are calculated via constexpr)
+ */
+
+#define MC_FFT_STATIC_TWIDDLE_(power2) MC_FFT_STATIC_TWIDDLE_##power2
+#define MC_FFT_STATIC_TWIDDLE(power2) MC_FFT_STATIC_TWIDDLE_(power2)
+#define MC_FFT_STATIC_DIGIT_(power2) MC_FFT_STATIC_DIGIT_##power2
+#define MC_FFT_STATIC_DIGIT(power2) MC_FFT_STATIC_DIGIT_(power2)
+
+/** Define static FFT context with name `name` (mc_fft_t) and entry points with length baked in:
+ *  name##_fft(re, im), name##_ifft(re, im)
+ */
+#define MC_FFT_STATIC_DEFINE(name, power2) \
+    MC_STATIC_ASSERT(MC_FFT_STATIC_COMPACT_TWIDDLE == MC_COMPACT_TWIDDLE); /**< Tables must match twiddle layout */ \
+    static _Alignas(MC_MEM_ALIGNMENT) const float name##_twiddle[MC_TWIDDLE_LENGTH(power2)] = MC_FFT_STATIC_TWIDDLE(power2); \
+    static _Alignas(MC_MEM_ALIGNMENT) const uint16_t name##_digitRev[2u*MC_DIGIT_LENGTH(power2)] = MC_FFT_STATIC_DIGIT(power2); \
+    static _Alignas(MC_MEM_ALIGNMENT) float name##_buffer[MC_BUFFER_LENGTH(power2)]; \
+    static const mc_fft_t name = { \
+        .twiddle = (float*)name##_twiddle, \
+        .digitRev = (uint32_t*)name##_digitRev, \
+        .buffer = name##_buffer, \
+        .bufLength = MC_BUFFER_LENGTH(power2), \
+        .pow2 = (power2) \
+    }; \
+    static inline void name##_fft(float * restrict re, float * restrict im) { \
+        mc_fft_mono(&name, re, im, (1u<<(power2))); \
+    } \
+    static inline void name##_ifft(float * restrict re, float * restrict im) { \
+        mc_ifft_mono(&name, re, im, (1u<<(power2))); \
+    }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MC_FFT_STATIC_H */
@@ -0,0 +1,217 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MC_FFT_STATIC_HPP
+#define MC_FFT_STATIC_HPP
+
+#include <array>
+#include <cstdint>
+#include "mcfft.h"
+
+/** Static (compile-time) FFT for the FFT length known at build time (C++17)
+ *
+ * Twiddle & digit reverse tables are calculated via constexpr and placed to read-only memory (.rodata),
+ * so there is no startup cost and tables are shared by all instances, for instance:
+ *
+ *     mc::static_fft<8u> fft256;
+ *     fft256.forward(re, im);  // the same as mc_fft_mono(&context, re, im, 256)
+ *
+ * NOTE: Only buffer is stored per instance (see mc_fft_t), use one instance per thread
+ */
+
+namespace mc {
+namespace detail {
+
+/** Constexpr cos/sin (Taylor series after reduction to [-pi/4, pi/4]), accurate enough for float tables */
+constexpr double static_pi = 3.14159265358979323846;
+
+constexpr double static_taylor_sin(double x) {
+    double x2 = x*x;
+    double term = x;
+    double sum = x;
+    for (int k = 1; k < 12; ++k) {
+        term *= -x2/(double)((2*k)*(2*k+1));
+        sum += term;
+    }
+    return sum;
+}
+
+constexpr double static_taylor_cos(double x) {
+    double x2 = x*x;
+    double term = 1.0;
+    double sum = 1.0;
+    for (int k = 1; k < 12; ++k) {
+        term *= -x2/(double)((2*k-1)*(2*k));
+        sum += term;
+    }
+    return sum;
+}
+
+constexpr double static_cos(double x) {
+    /** Reduce to [0, 2*pi) and then to octant */
+    double turns = x/(2.0*static_pi);
+    long long n = (long long)turns - ((turns < 0.0) ? 1 : 0);
+    x -= (double)n*2.0*static_pi;
+    int quadrant = (int)((x + static_pi/4.0)/(static_pi/2.0));
+    double r = x - (double)quadrant*(static_pi/2.0);
+    switch (quadrant & 3) {
+        case 0: return static_taylor_cos(r);
+        case 1: return -static_taylor_sin(r);
+        case 2: return -static_taylor_cos(r);
+        default: return static_taylor_sin(r);
+    }
+}
+
+constexpr double static_sin(double x) {
+    return static_cos(x - static_pi/2.0);
+}
+
+/** The same layout as mc_fft_rad4_get_twiddle_stage_g() */
+constexpr uint32_t static_twiddle_stage(float *out, uint32_t step) {
+    /** NOTE: The same constant as runtime version: digit reverse is identical, twiddle factors
+     *        may differ from libm cos()/sin() by 1 ULP (constexpr series) */
+    const double phi = -6.28318530718/((double)step);
+    uint32_t res = 0;
+    if (8u == step) {
+        out[res++] = (float)static_cos(phi);
+        out[res++] = (float)static_sin(phi);
+        out[res++] = (float)static_cos(2.0*phi);
+        out[res++] = (float)static_sin(2.0*phi);
+        out[res++] = (float)static_cos(3.0*phi);
+        out[res++] = (float)static_sin(3.0*phi);
+    } else if (16u == step) {
+        for (uint32_t m = 1u; m <= 3u; ++m) {
+            for (uint32_t k = 0; k < 4u; ++k) {
+                out[res++] = (float)static_cos((double)m*phi*(double)k);
+            }
+            for (uint32_t k = 0; k < 4u; ++k) {
+                out[res++] = (float)static_sin((double)m*phi*(double)k);
+            }
+        }
+    } else {
+#if MC_COMPACT_TWIDDLE
+        const uint32_t angles = 1u;
+#else
+        const uint32_t angles = 3u;
+#endif
+        for (uint32_t i = 0; i < (step>>2u); i += 8u) {
+            for (uint32_t m = 1u; m <= angles; ++m) {
+                for (uint32_t k = 0; k < 8u; ++k) {
+                    out[res++] = (float)static_cos((double)m*phi*(double)(i+k));
+                }
+                for (uint32_t k = 0; k < 8u; ++k) {
+                    out[res++] = (float)static_sin((double)m*phi*(double)(i+k));
+                }
+            }
+        }
+    }
+    return res;
+}
+
+/** The same layout as mc_fft_get_twiddle(), values within 1 ULP (see static_twiddle_stage()) */
+template <uint32_t power2>
+constexpr std::array<float, MC_TWIDDLE_LENGTH(power2)> static_twiddle() {
+    std::array<float, MC_TWIDDLE_LENGTH(power2)> out{};
+    uint32_t step = (1u<<power2);
+    uint32_t totalElements = 0;
+    do {
+        totalElements += static_twiddle_stage(&out[totalElements], step);
+        step >>= 2u;
+    } while (step >= 8u);
+    return out;
+}
+
+/** The same as mc_fft_get_digitRev(): DIT map followed by DIF map (uint16_t) */
+template <uint32_t power2>
+constexpr std::array<uint16_t, 2u*MC_DIGIT_LENGTH(power2)> static_digitRev() {
+    std::array<uint16_t, 2u*MC_DIGIT_LENGTH(power2)> out{};
+    const uint32_t fftLength = 1u<<power2;
+    const uint32_t base = (power2 % 2u) ? 2u : 4u;
+    for (uint32_t i = 0; i < fftLength; ++i) {
+        uint32_t k = i;
+        uint32_t Nx = base;
+        do {
+            uint32_t Ny = 4u;
+            uint32_t Ni = Ny * Nx;
+            k = (k * Ny) % Ni + (k / Nx) % Ny + Ni * (k / Ni);
+            Nx = Ni;
+        } while (Nx != fftLength);
+        out[i] = (uint16_t)k;
+    }
+    for (uint32_t i = 0; i < fftLength; ++i) {
+        out[fftLength + out[i]] = (uint16_t)i;
+    }
+    return out;
+}
+
+} // namespace detail
+
+/** Read-only tables for specific power of 2 */
+template <uint32_t power2>
+struct static_tables {
+    static_assert((1u<<power2) >= MC_MIN_FFT_LENGTH, "FFT length is less than MC_MIN_FFT_LENGTH");
+    static_assert((1u<<power2) <= MC_MAX_FFT_LENGTH, "FFT length is greater than MC_MAX_FFT_LENGTH");
+    alignas(MC_MEM_ALIGNMENT) static constexpr std::array<float, MC_TWIDDLE_LENGTH(power2)> twiddle = detail::static_twiddle<power2>();
+    alignas(MC_MEM_ALIGNMENT) static constexpr std::array<uint16_t, 2u*MC_DIGIT_LENGTH(power2)> digitRev = detail::static_digitRev<power2>();
+};
+
+/** FFT with length baked in (only buffer is allocated per instance) */
+template <uint32_t power2>
+class static_fft {
+public:
+    static constexpr uint32_t length = 1u<<power2;
+
+    static_fft() noexcept {
+        m_context.twiddle = const_cast<float*>(static_tables<power2>::twiddle.data());
+        m_context.digitRev = reinterpret_cast<uint32_t*>(const_cast<uint16_t*>(static_tables<power2>::digitRev.data()));
+        m_context.buffer = m_buffer;
+        m_context.bufLength = MC_BUFFER_LENGTH(power2);
+        m_context.pow2 = power2;
+    }
+    static_fft(const static_fft&) = delete;
+    static_fft& operator=(const static_fft&) = delete;
+
+    /** Forward FFT (see mc_fft_mono()) */
+    void forward(float * restrict re, float * restrict im) noexcept {
+        mc_fft_mono(&m_context, re, im, length);
+    }
+
+    /** Inverse FFT (see mc_ifft_mono()), NOTE: don't forget to call mc_fft_norm() function after */
+    void inverse(float * restrict re, float * restrict im) noexcept {
+        mc_ifft_mono(&m_context, re, im, length);
+    }
+
+    /** Context to use with C API */
+    const mc_fft_t *context() const noexcept {
+        return &m_context;
+    }
+
+private:
+    alignas(MC_MEM_ALIGNMENT) float m_buffer[MC_BUFFER_LENGTH(power2)];
+    mc_fft_t m_context{};
+};
+
+} // namespace mc
+
+#endif /* MC_FFT_STATIC_HPP */
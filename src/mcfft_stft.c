@@ -0,0 +1,265 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "mcfft_stft.h"
+#include "generic/mcfft_generic.h"
+#include "x86/mcfft_avx.h"
+#include "aarch64/mcfft_neon.h"
+#include <math.h>
+
+#ifndef MC_SELECTOR
+#define MC_SELECTOR g
+#endif
+
+void mc_stft_get_window(float *out, uint32_t length, uint32_t windowType) {
+    /** Periodic windows: w[n] = a0 - a1*cos(2*pi*n/N) + a2*cos(4*pi*n/N) */
+    MC_NULLPTR_ASSERT(out);
+    double a0 = 1., a1 = 0., a2 = 0.;
+    switch (windowType) {
+        case MC_STFT_WINDOW_HANN: a0 = 0.5; a1 = 0.5; break;
+        case MC_STFT_WINDOW_HAMMING: a0 = 0.54; a1 = 0.46; break;
+        case MC_STFT_WINDOW_BLACKMAN: a0 = 0.42; a1 = 0.5; a2 = 0.08; break;
+        default: MC_ASSERT(MC_STFT_WINDOW_RECT == windowType); break;
+    }
+    for (uint32_t i = 0; i < length; ++i) {
+        double phase = 2. * (double)MC_PI * (double)i / (double)length;
+        out[i] = (float)(a0 - a1*cos(phase) + a2*cos(2.*phase));
+    }
+}
+
+void mc_stft_set_window(mc_stft_t *context, const float *window) {
+    MC_NULLPTR_ASSERT(context);
+    MC_NULLPTR_ASSERT(window);
+    const uint32_t fftLength = 1u<<context->pow2;
+    const uint32_t hop = context->hop;
+    if (window != context->window) {
+        memcpy(context->window, window, sizeof(float)*fftLength);
+    }
+    /** WOLA: sum of analysis*synthesis over all frames overlapping sample must be 1 */
+    for (uint32_t i = 0; i < hop; ++i) {
+        double norm = 0.;
+        for (uint32_t j = i; j < fftLength; j += hop) {
+            norm += (double)window[j]*(double)window[j];
+        }
+        for (uint32_t j = i; j < fftLength; j += hop) {
+            context->synthesis[j] = (norm > 0.) ? (float)((double)window[j] / (norm * (double)fftLength)) : 0.f;
+        }
+    }
+}
+
+void mc_stft_reset(mc_stft_t *context) {
+    MC_NULLPTR_ASSERT(context);
+    memset(context->ring, 0, sizeof(float)*MC_STFT_RING_LENGTH(context->pow2));
+    memset(context->ola, 0, sizeof(float)*(1u<<context->pow2));
+    context->ringPos = 0;
+    context->pending = 0;
+}
+
+uint32_t mc_stft_get_frame_count(const mc_stft_t *context, uint32_t length) {
+    MC_NULLPTR_ASSERT(context);
+    return (context->pending + length) / context->hop;
+}
+
+static void st_stft_frames(mc_stft_t *context, uint32_t offsetA, uint32_t offsetB, uint32_t isDual, 
+                           float *outRe, float *outIm) {
+    const uint32_t fftLength = 1u<<context->pow2;
+    const uint32_t bins = MC_STFT_BINS(context->pow2);
+    const uint16_t *dit_map = (const uint16_t*)context->digitRev;
+    float * restrict re = context->work;
+    float * restrict im = &context->work[fftLength];
+    /** Windowing is fused into digit reverse gather from ring buffer */
+    MC_FUNC_CALL(shuffle_window, MC_SELECTOR)(re, context->ring, context->window, dit_map, offsetA, 
+                                              MC_STFT_RING_LENGTH(context->pow2) - 1u, fftLength);
+    if (isDual) {
+        MC_FUNC_CALL(shuffle_window, MC_SELECTOR)(im, context->ring, context->window, dit_map, offsetB, 
+                                                  MC_STFT_RING_LENGTH(context->pow2) - 1u, fftLength);
+    } else {
+        memset(im, 0, sizeof(float)*fftLength);
+    }
+    MC_FUNC_CALL(fft_dit_mono_core, MC_SELECTOR)(re, im, context->twiddle, context->pow2);
+    if (isDual) {
+        /** Z = A + jB for real frames a/b: A[k] = (Z[k] + conj(Z[N-k]))/2, B[k] = (Z[k] - conj(Z[N-k]))/2j */
+        float *bRe = &outRe[bins];
+        float *bIm = &outIm[bins];
+        for (uint32_t k = 0; k < bins; ++k) {
+            const uint32_t m = (fftLength - k) & (fftLength - 1u);
+            const float zRe = re[k], zIm = im[k], mRe = re[m], mIm = im[m];
+            outRe[k] = 0.5f*(zRe + mRe);
+            outIm[k] = 0.5f*(zIm - mIm);
+            bRe[k] = 0.5f*(zIm + mIm);
+            bIm[k] = 0.5f*(mRe - zRe);
+        }
+    } else {
+        memcpy(outRe, re, sizeof(float)*bins);
+        memcpy(outIm, im, sizeof(float)*bins);
+    }
+}
+
+uint32_t mc_stft_process(mc_stft_t *context, const float *in, uint32_t length, float *outRe, float *outIm) {
+    MC_NULLPTR_ASSERT(context);
+    MC_NULLPTR_ASSERT(in);
+    MC_NULLPTR_ASSERT(outRe);
+    MC_NULLPTR_ASSERT(outIm);
+    const uint32_t fftLength = 1u<<context->pow2;
+    const uint32_t ringLength = MC_STFT_RING_LENGTH(context->pow2);
+    const uint32_t bins = MC_STFT_BINS(context->pow2);
+    uint32_t frames = 0, isPending = 0, pendingOffset = 0;
+
+    while (length > 0) {
+        uint32_t count = context->hop - context->pending;
+        count = (count > length) ? length : count;
+        uint32_t first = ringLength - context->ringPos;
+        first = (first > count) ? count : first;
+        memcpy(&context->ring[context->ringPos], in, sizeof(float)*first);
+        memcpy(context->ring, &in[first], sizeof(float)*(count - first));
+        context->ringPos = (context->ringPos + count) & (ringLength - 1u);
+        context->pending += count;
+        in += count;
+        length -= count;
+        if (context->hop == context->pending) {
+            /** Ring keeps 2 frames: previous frame is still there (hop <= N) */
+            uint32_t offset = (context->ringPos - fftLength) & (ringLength - 1u);
+            context->pending = 0;
+            if (isPending) {
+                st_stft_frames(context, pendingOffset, offset, 1u, &outRe[frames*bins], &outIm[frames*bins]);
+                frames += 2u;
+                isPending = 0;
+            } else {
+                pendingOffset = offset;
+                isPending = 1u;
+            }
+        }
+    }
+    if (isPending) {
+        st_stft_frames(context, pendingOffset, 0, 0, &outRe[frames*bins], &outIm[frames*bins]);
+        frames += 1u;
+    }
+    return frames;
+}
+
+static void st_istft_overlap_add(mc_stft_t *context, const float *frame, float *out) {
+    const uint32_t fftLength = 1u<<context->pow2;
+    const uint32_t hop = context->hop;
+    float * restrict ola = context->ola;
+    const float * restrict synthesis = context->synthesis;
+    for (uint32_t i = 0; i < fftLength; ++i) {
+        ola[i] += synthesis[i]*frame[i];
+    }
+    memcpy(out, ola, sizeof(float)*hop);
+    memmove(ola, &ola[hop], sizeof(float)*(fftLength - hop));
+    memset(&ola[fftLength - hop], 0, sizeof(float)*hop);
+}
+
+void mc_istft_process(mc_stft_t *context, const float *inRe, const float *inIm, uint32_t frames, float *out) {
+    MC_NULLPTR_ASSERT(context);
+    MC_NULLPTR_ASSERT(inRe);
+    MC_NULLPTR_ASSERT(inIm);
+    MC_NULLPTR_ASSERT(out);
+    const uint32_t fftLength = 1u<<context->pow2;
+    const uint32_t half = fftLength>>1u;
+    const uint32_t bins = MC_STFT_BINS(context->pow2);
+    float * restrict re = context->work;
+    float * restrict im = &context->work[fftLength];
+
+    for (uint32_t f = 0; f < frames; f += 2u) {
+        /** Two real frames by one complex IFFT: Z = A + jB, A/B are conjugate symmetric */
+        const uint32_t isDual = ((f + 1u) < frames);
+        const float *aRe = &inRe[f*bins];
+        const float *aIm = &inIm[f*bins];
+        for (uint32_t k = 1u; k < half; ++k) {
+            float bRe = isDual ? aRe[k + bins] : 0.f;
+            float bIm = isDual ? aIm[k + bins] : 0.f;
+            re[k] = aRe[k] - bIm;
+            im[k] = aIm[k] + bRe;
+            re[fftLength - k] = aRe[k] + bIm;
+            im[fftLength - k] = bRe - aIm[k];
+        }
+        re[0] = aRe[0];
+        im[0] = isDual ? aRe[bins] : 0.f;
+        re[half] = aRe[half];
+        im[half] = isDual ? aRe[bins + half] : 0.f;
+        MC_FUNC_CALL(shuffle_mono, MC_SELECTOR)(re, im, context->buffer, (const uint16_t*)context->digitRev, fftLength);
+        MC_FUNC_CALL(ifft_dit_mono_core, MC_SELECTOR)(re, im, context->twiddle, context->pow2);
+        st_istft_overlap_add(context, re, out);
+        out += context->hop;
+        if (isDual) {
+            st_istft_overlap_add(context, im, out);
+            out += context->hop;
+        }
+    }
+}
+
+void mc_stft_create_object(mc_stft_object_t *obj, uint32_t power2, uint32_t hop, uint32_t windowType, 
+                           void *memory, size_t memSize) {
+    MC_NULLPTR_ASSERT(obj);
+    MC_NULLPTR_ASSERT(memory);
+    MC_ASSERT(MC_MAX_FFT_LENGTH >= (1u<<power2));
+    MC_ASSERT((1u<<power2) >= MC_MIN_FFT_LENGTH);
+    MC_ASSERT((hop > 0) && (hop <= (1u<<power2)));
+    MC_ASSERT(memSize >= MC_STFT_GET_OBJECT_SIZE(power2));
+    const uint32_t fftLength = 1u<<power2;
+    uintptr_t memory_addr = 0;
+    memset(&obj->context, 0, sizeof(obj->context));
+    obj->memory = memory;
+    obj->context.pow2 = power2;
+    obj->context.hop = hop;
+    memory_addr = MC_GET_ALIGNED_PTR(obj->memory);
+    obj->context.twiddle = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*MC_TWIDDLE_LENGTH(power2));
+    obj->context.digitRev = (uint32_t*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(uint32_t)*MC_DIGIT_LENGTH(power2));
+    obj->context.window = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*fftLength);
+    obj->context.synthesis = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*fftLength);
+    obj->context.ola = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*fftLength);
+    obj->context.ring = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*MC_STFT_RING_LENGTH(power2));
+    obj->context.work = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*2u*fftLength);
+    obj->context.buffer = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*2u*fftLength);
+    MC_ASSERT(memory_addr <= (uintptr_t)obj->memory+memSize);
+    mc_fft_get_twiddle(obj->context.twiddle, MC_TWIDDLE_LENGTH(power2), power2);
+    mc_fft_get_digitRev(obj->context.digitRev, MC_DIGIT_LENGTH(power2), power2);
+    mc_stft_get_window(obj->context.window, fftLength, windowType);
+    mc_stft_set_window(&obj->context, obj->context.window);
+    mc_stft_reset(&obj->context);
+}
+
+#ifndef MC_EXCLUDE_MALLOC
+void mc_stft_allocate(mc_stft_object_t *obj, uint32_t power2, uint32_t hop, uint32_t windowType) {
+    MC_NULLPTR_ASSERT(obj);
+    MC_ASSERT(MC_MAX_FFT_LENGTH >= (1u<<power2));
+    MC_ASSERT((1u<<power2) >= MC_MIN_FFT_LENGTH);
+    size_t memory_size = MC_STFT_GET_OBJECT_SIZE(power2);
+    mc_stft_create_object(obj, power2, hop, windowType, malloc(memory_size), memory_size);
+}
+
+void mc_stft_free(mc_stft_object_t *obj) {
+    MC_NULLPTR_ASSERT(obj);
+    free(obj->memory);
+}
+#endif // EXCLUDE_MALLOC
@@ -0,0 +1,163 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MC_FFT_STFT_H
+#define MC_FFT_STFT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "mcfft.h"
+
+/** Short-time Fourier transform of real signal (analysis) and its inverse (overlap-add synthesis):
+ *  - Frame length is FFT length 2^power2, hop is any value in [1, 2^power2]
+ *  - Input is kept in ring buffer, windowing is fused into digit reverse gather (no frame copy, no window pass)
+ *  - Two frames are packed to one complex FFT (Re/Im), spectra are split by conjugate symmetry
+ *  - Synthesis window is COLA/WOLA-normalised: analysis + synthesis of any window gives the input back
+ *    delayed by (2^power2 - hop) samples (if overlapping squared windows are non-zero)
+ */
+
+/** Window types of STFT (periodic windows, see mc_stft_set_window() for custom one) */
+#define MC_STFT_WINDOW_RECT (0u)
+#define MC_STFT_WINDOW_HANN (1u)
+#define MC_STFT_WINDOW_HAMMING (2u)
+#define MC_STFT_WINDOW_BLACKMAN (3u)
+
+/** Get the number of spectrum bins per frame (DC..Nyquist) */
+#define MC_STFT_BINS(power2) ((1u<<((power2)-1u)) + 1u)
+/** Get the number of elements required for input ring buffer (see mc_stft_t) */
+#define MC_STFT_RING_LENGTH(power2) ((1u<<((power2)+1u)))
+
+/** STFT context with pre-calculated values and buffers required */
+typedef struct mc_stft_t {
+    /** NOTE: All arrays in structure better to align by 64 bytes.
+     *        Use mc_stft_allocate()/mc_stft_create_object() if possible */
+    float *twiddle;         /* Number of twiddle elements must be == MC_TWIDDLE_LENGTH(power2) */
+    uint32_t *digitRev;     /* Number of digit elements must be == MC_DIGIT_LENGTH(power2) */
+    float *window;          /* Analysis window */
+    float *synthesis;       /* Synthesis window (normalised, includes 1/N of inverse FFT) */
+    float *ring;            /* Input ring buffer (2 frames) */
+    float *ola;             /* Overlap-add buffer of synthesis (1 frame) */
+    float *work;            /* Work buffer (Re then Im) */
+    float *buffer;          /* Buffer of digit reverse (Re then Im) */
+    uint32_t pow2;          /* length of FFT */
+    uint32_t hop;           /* hop size */
+    uint32_t ringPos;       /* write position of ring buffer */
+    uint32_t pending;       /* number of samples since the last frame */
+} mc_stft_t;
+
+/** Get periodic window
+ * 
+ * @param out Pointer to user's buffer to store window
+ * @param length Length of window
+ * @param windowType Window type (see MC_STFT_WINDOW_*)
+ */
+void mc_stft_get_window(float *out, uint32_t length, uint32_t windowType);
+
+/** Set window of STFT (synthesis window is re-calculated)
+ * 
+ * @param context Pointer to STFT context
+ * @param window Pointer to window (length is 2^power2)
+ */
+void mc_stft_set_window(mc_stft_t *context, const float *window);
+
+/** Reset input ring buffer and overlap-add buffer (as if signal was zero before) */
+void mc_stft_reset(mc_stft_t *context);
+
+/** Get the number of frames which mc_stft_process() produces for next part of input
+ * 
+ * @param context Pointer to STFT context
+ * @param length Length of next part of input
+ * @return Number of frames
+ */
+uint32_t mc_stft_get_frame_count(const mc_stft_t *context, uint32_t length);
+
+/** STFT of next part of input stream: one frame every hop samples (all frames of the call are batched)
+ * 
+ * @param context Pointer to STFT context
+ * @param in Pointer to input signal
+ * @param length Length of input signal (any)
+ * @param outRe Pointer to real part of spectra: frame f is &outRe[f*MC_STFT_BINS(power2)]
+ * @param outIm Pointer to imag part of spectra: frame f is &outIm[f*MC_STFT_BINS(power2)]
+ * @return Number of frames (see mc_stft_get_frame_count())
+ */
+uint32_t mc_stft_process(mc_stft_t *context, const float *in, uint32_t length, float *outRe, float *outIm);
+
+/** ISTFT (overlap-add synthesis) of next frames: hop samples per frame
+ * 
+ * @param context Pointer to STFT context
+ * @param inRe Pointer to real part of spectra (the same layout as mc_stft_process() output)
+ * @param inIm Pointer to imag part of spectra (Im of DC and Nyquist bins is ignored)
+ * @param frames Number of frames
+ * @param out Pointer to output signal (length is frames*hop)
+ */
+void mc_istft_process(mc_stft_t *context, const float *inRe, const float *inIm, uint32_t frames, float *out);
+
+/** Get STFT object size in bytes if static/non-malloc allocation is required */
+#define MC_STFT_GET_OBJECT_SIZE(power2) (MC_GET_ALIGNED_SIZE(sizeof(float)*MC_TWIDDLE_LENGTH(power2)) \
+                                         + MC_GET_ALIGNED_SIZE(sizeof(uint32_t)*MC_DIGIT_LENGTH(power2)) \
+                                         + 3u*MC_GET_ALIGNED_SIZE(sizeof(float)*(1u<<(power2))) \
+                                         + MC_GET_ALIGNED_SIZE(sizeof(float)*MC_STFT_RING_LENGTH(power2)) \
+                                         + 2u*MC_GET_ALIGNED_SIZE(sizeof(float)*(2u<<(power2))) \
+                                         + MC_MEM_ALIGNMENT)
+
+/** STFT object to control memory alignment and simplify allocation of memory (see mc_stft_t) */
+typedef struct mc_stft_object_t {
+    mc_stft_t context;
+    void *memory;
+} mc_stft_object_t;
+
+/** Create STFT object based on allocated memory (non-malloc API)
+ * 
+ * @param obj Pointer to user's structure where object will be created
+ * @param power2 Power of 2 which reflects required length of FFT (frame)
+ * @param hop Hop size (must be in [1, 2^power2])
+ * @param windowType Window type (see MC_STFT_WINDOW_*)
+ * @param memory Pointer to user's memory which used to create object
+ * @param memSize User's memory size in bytes (see MC_STFT_GET_OBJECT_SIZE(power2))
+ */
+void mc_stft_create_object(mc_stft_object_t *obj, uint32_t power2, uint32_t hop, uint32_t windowType, 
+                           void *memory, size_t memSize);
+
+/** Allocate STFT object via malloc/free API (can be excluded by defining EXCLUDE_MALLOC macro)
+ * 
+ * @param obj Pointer to user's structure where object will be created
+ * @param power2 Power of 2 which reflects required length of FFT (frame)
+ * @param hop Hop size (must be in [1, 2^power2])
+ * @param windowType Window type (see MC_STFT_WINDOW_*)
+ */
+void mc_stft_allocate(mc_stft_object_t *obj, uint32_t power2, uint32_t hop, uint32_t windowType);
+
+/** Release STFT object via malloc/free API (can be excluded by defining EXCLUDE_MALLOC macro)
+ * 
+ * @param obj Pointer to user's structure where object is created by mc_stft_allocate() function
+ */
+void mc_stft_free(mc_stft_object_t *obj);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MC_FFT_STFT_H */
@@ -0,0 +1,162 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "mcfft_thread.h"
+
+#ifndef MC_EXCLUDE_THREADS
+#include <sched.h>
+#endif // MC_EXCLUDE_THREADS
+
+#ifndef MC_EXCLUDE_THREADS
+typedef struct mc_thread_worker_arg_t {
+    mc_thread_pool_t *pool;
+    uint32_t thread;
+} mc_thread_worker_arg_t;
+
+static void st_thread_pool_work(mc_thread_pool_t *pool, uint32_t thread) {
+    uint32_t index = 0;
+    while ((index = atomic_fetch_add(&pool->next, 1u)) < pool->tasks) {
+        pool->task(pool->arg, index, thread);
+    }
+}
+
+static void *st_thread_pool_worker(void *arg) {
+    mc_thread_pool_t *pool = ((mc_thread_worker_arg_t*)arg)->pool;
+    const uint32_t thread = ((mc_thread_worker_arg_t*)arg)->thread;
+    uint32_t generation = 0;
+    free(arg);
+    while (1) {
+        /** Poll first: no syscalls for back-to-back jobs */
+        for (uint32_t i = 0; (i < MC_THREAD_SPIN_COUNT) && (generation == atomic_load(&pool->generation)); ++i) {
+            if (atomic_load(&pool->stop)) {
+                break;
+            }
+        }
+        if (generation == atomic_load(&pool->generation)) {
+            pthread_mutex_lock(&pool->lock);
+            atomic_fetch_add(&pool->sleeping, 1u);
+            while ((generation == atomic_load(&pool->generation)) && !atomic_load(&pool->stop)) {
+                pthread_cond_wait(&pool->wake, &pool->lock);
+            }
+            atomic_fetch_sub(&pool->sleeping, 1u);
+            pthread_mutex_unlock(&pool->lock);
+        }
+        if (atomic_load(&pool->stop)) {
+            break;
+        }
+        generation = atomic_load(&pool->generation);
+        st_thread_pool_work(pool, thread);
+        atomic_fetch_add(&pool->finished, 1u);
+    }
+    return NULL;
+}
+#endif // MC_EXCLUDE_THREADS
+
+void mc_thread_pool_create(mc_thread_pool_t *pool, uint32_t threads) {
+    MC_NULLPTR_ASSERT(pool);
+    MC_ASSERT((threads > 0) && (threads <= MC_THREAD_MAX));
+    memset(pool, 0, sizeof(*pool));
+#ifndef MC_EXCLUDE_THREADS
+    pool->threads = threads;
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->wake, NULL);
+    atomic_init(&pool->generation, 0);
+    atomic_init(&pool->next, 0);
+    atomic_init(&pool->finished, 0);
+    atomic_init(&pool->sleeping, 0);
+    atomic_init(&pool->stop, 0);
+    for (uint32_t i = 1u; i < threads; ++i) {
+        mc_thread_worker_arg_t *arg = (mc_thread_worker_arg_t*)malloc(sizeof(mc_thread_worker_arg_t));
+        MC_NULLPTR_ASSERT(arg);
+        arg->pool = pool;
+        arg->thread = i;
+        if (0 != pthread_create(&pool->workers[i - 1u], NULL, st_thread_pool_worker, arg)) {
+            /** Continue with threads started so far */
+            free(arg);
+            pool->threads = i;
+            break;
+        }
+    }
+#else
+    (void)threads;
+    pool->threads = 1u;
+#endif // MC_EXCLUDE_THREADS
+}
+
+void mc_thread_pool_destroy(mc_thread_pool_t *pool) {
+    MC_NULLPTR_ASSERT(pool);
+#ifndef MC_EXCLUDE_THREADS
+    pthread_mutex_lock(&pool->lock);
+    atomic_store(&pool->stop, 1u);
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+    for (uint32_t i = 1u; i < pool->threads; ++i) {
+        pthread_join(pool->workers[i - 1u], NULL);
+    }
+    pthread_cond_destroy(&pool->wake);
+    pthread_mutex_destroy(&pool->lock);
+#endif // MC_EXCLUDE_THREADS
+    pool->threads = 0;
+}
+
+void mc_thread_pool_run(mc_thread_pool_t *pool, mc_thread_task_t task, void *arg, uint32_t tasks) {
+    MC_NULLPTR_ASSERT(pool);
+    MC_NULLPTR_ASSERT(task);
+#ifndef MC_EXCLUDE_THREADS
+    if ((pool->threads > 1u) && (tasks > 1u)) {
+        const uint32_t workers = pool->threads - 1u;
+        pool->task = task;
+        pool->arg = arg;
+        pool->tasks = tasks;
+        atomic_store(&pool->next, 0);
+        atomic_store(&pool->finished, 0);
+        atomic_fetch_add(&pool->generation, 1u);
+        if (atomic_load(&pool->sleeping) > 0) {
+            pthread_mutex_lock(&pool->lock);
+            pthread_cond_broadcast(&pool->wake);
+            pthread_mutex_unlock(&pool->lock);
+        }
+        st_thread_pool_work(pool, 0);
+        /** Every worker must leave the job before the next one overwrites it */
+        while (atomic_load(&pool->finished) < workers) {
+            sched_yield();
+        }
+        return;
+    }
+#endif // MC_EXCLUDE_THREADS
+    for (uint32_t i = 0; i < tasks; ++i) {
+        task(arg, i, 0);
+    }
+}
+
+void mc_thread_run(mc_thread_pool_t *pool, mc_thread_task_t task, void *arg, uint32_t tasks) {
+    MC_NULLPTR_ASSERT(task);
+    if (NULL != pool) {
+        mc_thread_pool_run(pool, task, arg, tasks);
+    } else {
+        for (uint32_t i = 0; i < tasks; ++i) {
+            task(arg, i, 0);
+        }
+    }
+}
@@ -0,0 +1,120 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MC_FFT_THREAD_H
+#define MC_FFT_THREAD_H
+
+/** Threads are not supported by MSVC builds (pthreads) */
+#if defined(_MSC_VER) && !defined(MC_EXCLUDE_THREADS)
+#define MC_EXCLUDE_THREADS
+#endif
+
+#ifndef MC_EXCLUDE_THREADS
+#include <pthread.h>
+#ifndef __cplusplus
+#include <stdatomic.h>
+#define MC_ATOMIC_UINT atomic_uint
+#define MC_ATOMIC_ULLONG atomic_ullong
+#else
+#include <atomic>
+#define MC_ATOMIC_UINT std::atomic_uint
+#define MC_ATOMIC_ULLONG std::atomic_ullong
+#endif
+#else
+/** Single thread: plain integers */
+#define MC_ATOMIC_UINT uint32_t
+#define MC_ATOMIC_ULLONG uint64_t
+#endif // MC_EXCLUDE_THREADS
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "utils.h"
+
+/** Max number of threads of pool (including caller's thread) */
+#define MC_THREAD_MAX (64u)
+/** Number of polling iterations of idle worker before sleep (wake up without syscall for back-to-back jobs) */
+#define MC_THREAD_SPIN_COUNT (1u<<16u)
+
+/** Task of parallel job
+ * 
+ * @param arg User's argument of job
+ * @param index Index of task (0..tasks-1)
+ * @param thread Index of thread executing task (0 - caller's thread, 0..threads-1), use it for per-thread scratch
+ */
+typedef void (*mc_thread_task_t)(void *arg, uint32_t index, uint32_t thread);
+
+/** Small fork-join thread pool: caller's thread and workers execute tasks of one job (parallel for) */
+typedef struct mc_thread_pool_t {
+    uint32_t threads;               /* number of threads including caller's thread */
+#ifndef MC_EXCLUDE_THREADS
+    pthread_t workers[MC_THREAD_MAX];
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    mc_thread_task_t task;          /* current job */
+    void *arg;
+    uint32_t tasks;
+    MC_ATOMIC_UINT generation;      /* incremented per job */
+    MC_ATOMIC_UINT next;            /* next task index */
+    MC_ATOMIC_UINT finished;        /* number of workers finished current job */
+    MC_ATOMIC_UINT sleeping;        /* number of workers waiting on condition */
+    MC_ATOMIC_UINT stop;
+#endif // MC_EXCLUDE_THREADS
+} mc_thread_pool_t;
+
+/** Create thread pool (threads-1 workers are started, 1 thread if threads are excluded)
+ * 
+ * @param pool Pointer to pool
+ * @param threads Number of threads including caller's thread (1..MC_THREAD_MAX)
+ */
+void mc_thread_pool_create(mc_thread_pool_t *pool, uint32_t threads);
+
+/** Stop and join workers of pool */
+void mc_thread_pool_destroy(mc_thread_pool_t *pool);
+
+/** Execute job: task(arg, index, thread) for every index 0..tasks-1, returns when all tasks are done
+ *  NOTE: must not be called concurrently for the same pool
+ * 
+ * @param pool Pointer to pool
+ * @param task Task function
+ * @param arg User's argument of task
+ * @param tasks Number of tasks
+ */
+void mc_thread_pool_run(mc_thread_pool_t *pool, mc_thread_task_t task, void *arg, uint32_t tasks);
+
+/** Execute job on pool or on caller's thread (pool is NULL), see mc_thread_pool_run()
+ * 
+ * @param pool Pointer to pool (NULL - tasks are executed by caller as thread 0)
+ * @param task Task function
+ * @param arg User's argument of task
+ * @param tasks Number of tasks
+ */
+void mc_thread_run(mc_thread_pool_t *pool, mc_thread_task_t task, void *arg, uint32_t tasks);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MC_FFT_THREAD_H */
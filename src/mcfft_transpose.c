@@ -0,0 +1,104 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "mcfft_transpose.h"
+#include "generic/mcfft_generic.h"
+#include "x86/mcfft_avx.h"
+#include "aarch64/mcfft_neon.h"
+
+#ifndef MC_SELECTOR
+#define MC_SELECTOR g
+#endif
+
+static void st_transpose(float * restrict out, const float * restrict in, uint32_t rows, uint32_t columns) {
+    const uint32_t vRows = rows & ~7u;
+    const uint32_t vColumns = columns & ~7u;
+    for (uint32_t r0 = 0; r0 < vRows; r0 += MC_TRANSPOSE_BLOCK) {
+        const uint32_t blockRows = ((r0 + MC_TRANSPOSE_BLOCK) <= vRows) ? MC_TRANSPOSE_BLOCK : (vRows - r0);
+        for (uint32_t c0 = 0; c0 < vColumns; c0 += MC_TRANSPOSE_BLOCK) {
+            const uint32_t cEnd = ((c0 + MC_TRANSPOSE_BLOCK) <= vColumns) ? (c0 + MC_TRANSPOSE_BLOCK) : vColumns;
+            for (uint32_t c = c0; c < cEnd; c += 8u) {
+                MC_FUNC_CALL(transpose_tile, MC_SELECTOR)(&out[c*rows + r0], &in[r0*columns + c], columns, rows, blockRows);
+            }
+        }
+    }
+    /** Edges: last columns of vector rows, then last rows */
+    for (uint32_t r = 0; r < vRows; ++r) {
+        for (uint32_t c = vColumns; c < columns; ++c) {
+            out[c*rows + r] = in[r*columns + c];
+        }
+    }
+    for (uint32_t r = vRows; r < rows; ++r) {
+        for (uint32_t c = 0; c < columns; ++c) {
+            out[c*rows + r] = in[r*columns + c];
+        }
+    }
+}
+
+static void st_transpose_square(float *matrix, uint32_t length) {
+    float tile[64];
+    const uint32_t vLength = length & ~7u;
+    for (uint32_t i = 0; i < vLength; i += 8u) {
+        /** Diagonal tile: via stack buffer */
+        MC_FUNC_CALL(transpose_tile, MC_SELECTOR)(tile, &matrix[i*length + i], length, 8u, 8u);
+        for (uint32_t r = 0; r < 8u; ++r) {
+            memcpy(&matrix[(i + r)*length + i], &tile[r*8u], sizeof(float)*8u);
+        }
+        /** Swap of tile (i, j) and tile (j, i) */
+        for (uint32_t j = i + 8u; j < vLength; j += 8u) {
+            MC_FUNC_CALL(transpose_tile, MC_SELECTOR)(tile, &matrix[i*length + j], length, 8u, 8u);
+            MC_FUNC_CALL(transpose_tile, MC_SELECTOR)(&matrix[i*length + j], &matrix[j*length + i], length, length, 8u);
+            for (uint32_t r = 0; r < 8u; ++r) {
+                memcpy(&matrix[(j + r)*length + i], &tile[r*8u], sizeof(float)*8u);
+            }
+        }
+    }
+    /** Edges: pairs with last rows/columns */
+    for (uint32_t i = 0; i < length; ++i) {
+        for (uint32_t j = ((i + 1u) > vLength) ? (i + 1u) : vLength; j < length; ++j) {
+            const float tmp = matrix[i*length + j];
+            matrix[i*length + j] = matrix[j*length + i];
+            matrix[j*length + i] = tmp;
+        }
+    }
+}
+
+void mc_transpose(float * restrict outRe, float * restrict outIm, const float * restrict inRe, 
+                  const float * restrict inIm, uint32_t rows, uint32_t columns) {
+    MC_NULLPTR_ASSERT(outRe);
+    MC_NULLPTR_ASSERT(inRe);
+    MC_ASSERT((NULL == outIm) == (NULL == inIm));
+    st_transpose(outRe, inRe, rows, columns);
+    if (NULL != inIm) {
+        st_transpose(outIm, inIm, rows, columns);
+    }
+}
+
+void mc_transpose_square(float *re, float *im, uint32_t length) {
+    MC_NULLPTR_ASSERT(re);
+    st_transpose_square(re, length);
+    if (NULL != im) {
+        st_transpose_square(im, length);
+    }
+}
@@ -0,0 +1,68 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MC_FFT_TRANSPOSE_H
+#define MC_FFT_TRANSPOSE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "utils.h"
+
+/** Transpose of split complex (or real) float matrices:
+ *  - Blocks of MC_TRANSPOSE_BLOCK x MC_TRANSPOSE_BLOCK are transposed at once (both blocks stay in L1),
+ *    8x8 tiles of block are transposed in registers (AVX 8x8, NEON 4x4, see mc_transpose_tile_*())
+ *  - Edges of matrices which are not multiple of 8 are transposed by scalar loop
+ *  - Square matrices can be transposed in place: pairs of 8x8 tiles are swapped via 8x8 stack buffer
+ */
+
+/** Size of cache block (multiple of 8) */
+#define MC_TRANSPOSE_BLOCK (32u)
+
+/** Out-of-place transpose: out[c][r] = in[r][c]
+ * 
+ * @param outRe Pointer to real part of output matrix [columns][rows] (can't be the same as input)
+ * @param outIm Pointer to imag part of output matrix [columns][rows] (NULL for real matrix)
+ * @param inRe Pointer to real part of input matrix [rows][columns]
+ * @param inIm Pointer to imag part of input matrix [rows][columns] (NULL for real matrix)
+ * @param rows Number of rows of input matrix
+ * @param columns Number of columns of input matrix
+ */
+void mc_transpose(float * restrict outRe, float * restrict outIm, const float * restrict inRe, 
+                  const float * restrict inIm, uint32_t rows, uint32_t columns);
+
+/** In-place transpose of square matrix
+ * 
+ * @param re Pointer to real part of matrix [length][length]
+ * @param im Pointer to imag part of matrix [length][length] (NULL for real matrix)
+ * @param length Number of rows/columns of matrix
+ */
+void mc_transpose_square(float *re, float *im, uint32_t length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MC_FFT_TRANSPOSE_H */
@@ -0,0 +1,186 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "mcfft_welch.h"
+#include "generic/mcfft_generic.h"
+#include "x86/mcfft_avx.h"
+#include "aarch64/mcfft_neon.h"
+
+#ifndef MC_SELECTOR
+#define MC_SELECTOR g
+#endif
+
+void mc_welch_reset(mc_welch_t *context) {
+    MC_NULLPTR_ASSERT(context);
+    memset(context->ring, 0, sizeof(float)*MC_STFT_RING_LENGTH(context->pow2));
+    memset(context->acc, 0, sizeof(float)*(1u<<context->pow2));
+    context->ringPos = 0;
+    context->pending = 1u<<context->pow2;
+    context->isPending = 0;
+    context->pendingOffset = 0;
+    context->segments = 0;
+}
+
+static void st_welch_window(const mc_welch_t *context, float * restrict out, uint32_t offset) {
+    const uint32_t fftLength = 1u<<context->pow2;
+    const uint32_t ringLength = MC_STFT_RING_LENGTH(context->pow2);
+    const float * restrict window = context->window;
+    const float * restrict ring = &context->ring[offset];
+    /** Segment wraps around ring at most once */
+    uint32_t first = ringLength - offset;
+    first = (first > fftLength) ? fftLength : first;
+    for (uint32_t i = 0; i < first; ++i) {
+        out[i] = ring[i]*window[i];
+    }
+    for (uint32_t i = first; i < fftLength; ++i) {
+        out[i] = context->ring[i - first]*window[i];
+    }
+}
+
+static void st_welch_segments(mc_welch_t *context, uint32_t offsetA, uint32_t offsetB, uint32_t isDual) {
+    const uint32_t fftLength = 1u<<context->pow2;
+    float * restrict re = context->work;
+    float * restrict im = &context->work[fftLength];
+    st_welch_window(context, re, offsetA);
+    if (isDual) {
+        st_welch_window(context, im, offsetB);
+    } else {
+        memset(im, 0, sizeof(float)*fftLength);
+    }
+    MC_FUNC_CALL(fft_dif_mono_core, MC_SELECTOR)(re, im, context->twiddle, context->pow2);
+    MC_FUNC_CALL(spectrum_power_acc, MC_SELECTOR)(context->acc, re, im, fftLength);
+}
+
+void mc_welch_process(mc_welch_t *context, const float *in, uint32_t length) {
+    MC_NULLPTR_ASSERT(context);
+    MC_NULLPTR_ASSERT(in);
+    const uint32_t fftLength = 1u<<context->pow2;
+    const uint32_t ringLength = MC_STFT_RING_LENGTH(context->pow2);
+
+    while (length > 0) {
+        uint32_t count = (context->pending > length) ? length : context->pending;
+        uint32_t first = ringLength - context->ringPos;
+        first = (first > count) ? count : first;
+        memcpy(&context->ring[context->ringPos], in, sizeof(float)*first);
+        memcpy(context->ring, &in[first], sizeof(float)*(count - first));
+        context->ringPos = (context->ringPos + count) & (ringLength - 1u);
+        context->pending -= count;
+        in += count;
+        length -= count;
+        if (0 == context->pending) {
+            /** Ring keeps 2 segments: waiting segment is still there (hop <= N) */
+            uint32_t offset = (context->ringPos - fftLength) & (ringLength - 1u);
+            context->pending = context->hop;
+            context->segments += 1u;
+            if (context->isPending) {
+                st_welch_segments(context, context->pendingOffset, offset, 1u);
+                context->isPending = 0;
+            } else {
+                context->pendingOffset = offset;
+                context->isPending = 1u;
+            }
+        }
+    }
+}
+
+uint32_t mc_welch_get_segment_count(const mc_welch_t *context) {
+    MC_NULLPTR_ASSERT(context);
+    return context->segments;
+}
+
+void mc_welch_get_psd(mc_welch_t *context, float *out, float fs) {
+    MC_NULLPTR_ASSERT(context);
+    MC_NULLPTR_ASSERT(out);
+    MC_ASSERT(fs > 0.f);
+    const uint32_t fftLength = 1u<<context->pow2;
+    const uint32_t bins = MC_STFT_BINS(context->pow2);
+    const uint16_t *dif_map = (const uint16_t*)&context->digitRev[fftLength>>1u];
+    if (context->isPending) {
+        st_welch_segments(context, context->pendingOffset, 0, 0);
+        context->isPending = 0;
+    }
+    /** Folding gives 2*sum(|X[k]|^2), i.e. one-sided doubling (DC and Nyquist are halved back) */
+    const float scale = (context->segments > 0) ? 
+                        (1.f / (fs * context->windowPower * (float)context->segments)) : 0.f;
+    for (uint32_t k = 0; k < bins; ++k) {
+        const uint32_t m = (fftLength - k) & (fftLength - 1u);
+        out[k] = (context->acc[dif_map[k]] + context->acc[dif_map[m]]) * scale;
+    }
+    out[0] *= 0.5f;
+    out[bins - 1u] *= 0.5f;
+}
+
+void mc_welch_create_object(mc_welch_object_t *obj, uint32_t power2, uint32_t hop, uint32_t windowType, 
+                            void *memory, size_t memSize) {
+    MC_NULLPTR_ASSERT(obj);
+    MC_NULLPTR_ASSERT(memory);
+    MC_ASSERT(MC_MAX_FFT_LENGTH >= (1u<<power2));
+    MC_ASSERT((1u<<power2) >= MC_MIN_FFT_LENGTH);
+    MC_ASSERT((hop > 0) && (hop <= (1u<<power2)));
+    MC_ASSERT(memSize >= MC_WELCH_GET_OBJECT_SIZE(power2));
+    const uint32_t fftLength = 1u<<power2;
+    uintptr_t memory_addr = 0;
+    memset(&obj->context, 0, sizeof(obj->context));
+    obj->memory = memory;
+    obj->context.pow2 = power2;
+    obj->context.hop = hop;
+    memory_addr = MC_GET_ALIGNED_PTR(obj->memory);
+    obj->context.twiddle = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*MC_TWIDDLE_LENGTH(power2));
+    obj->context.digitRev = (uint32_t*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(uint32_t)*MC_DIGIT_LENGTH(power2));
+    obj->context.window = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*fftLength);
+    obj->context.acc = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*fftLength);
+    obj->context.ring = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*MC_STFT_RING_LENGTH(power2));
+    obj->context.work = (float*)memory_addr;
+    memory_addr = MC_GET_ALIGNED_PTR(memory_addr+sizeof(float)*2u*fftLength);
+    MC_ASSERT(memory_addr <= (uintptr_t)obj->memory+memSize);
+    mc_fft_get_twiddle(obj->context.twiddle, MC_TWIDDLE_LENGTH(power2), power2);
+    mc_fft_get_digitRev(obj->context.digitRev, MC_DIGIT_LENGTH(power2), power2);
+    mc_stft_get_window(obj->context.window, fftLength, windowType);
+    double windowPower = 0.;
+    for (uint32_t i = 0; i < fftLength; ++i) {
+        windowPower += (double)obj->context.window[i]*(double)obj->context.window[i];
+    }
+    obj->context.windowPower = (float)windowPower;
+    mc_welch_reset(&obj->context);
+}
+
+#ifndef MC_EXCLUDE_MALLOC
+void mc_welch_allocate(mc_welch_object_t *obj, uint32_t power2, uint32_t hop, uint32_t windowType) {
+    MC_NULLPTR_ASSERT(obj);
+    MC_ASSERT(MC_MAX_FFT_LENGTH >= (1u<<power2));
+    MC_ASSERT((1u<<power2) >= MC_MIN_FFT_LENGTH);
+    size_t memory_size = MC_WELCH_GET_OBJECT_SIZE(power2);
+    mc_welch_create_object(obj, power2, hop, windowType, malloc(memory_size), memory_size);
+}
+
+void mc_welch_free(mc_welch_object_t *obj) {
+    MC_NULLPTR_ASSERT(obj);
+    free(obj->memory);
+}
+#endif // EXCLUDE_MALLOC
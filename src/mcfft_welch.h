@@ -0,0 +1,129 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MC_FFT_WELCH_H
+#define MC_FFT_WELCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "mcfft.h"
+#include "mcfft_stft.h"
+
+/** Welch PSD estimator of real signal (average of windowed periodograms):
+ *  - Segment length is FFT length 2^power2, segments start every hop samples of stream
+ *  - Two segments are packed to one complex FFT (Re/Im) with DIF core: |A[k]|^2 + |B[k]|^2 = (|Z[k]|^2 + |Z[N-k]|^2)/2,
+ *    so power is accumulated in place in digit-reversed order, neither split nor digit reverse per segment
+ *  - The accumulator is folded to natural order once in mc_welch_get_psd()
+ */
+
+/** Welch estimator context with pre-calculated values and buffers required */
+typedef struct mc_welch_t {
+    /** NOTE: All arrays in structure better to align by 64 bytes.
+     *        Use mc_welch_allocate()/mc_welch_create_object() if possible */
+    float *twiddle;         /* Number of twiddle elements must be == MC_TWIDDLE_LENGTH(power2) */
+    uint32_t *digitRev;     /* Number of digit elements must be == MC_DIGIT_LENGTH(power2) */
+    float *window;          /* Segment window */
+    float *ring;            /* Input ring buffer (2 segments) */
+    float *work;            /* Work buffer (Re then Im) */
+    float *acc;             /* Accumulated power in digit-reversed order */
+    float windowPower;      /* Sum of squared window */
+    uint32_t pow2;          /* length of FFT */
+    uint32_t hop;           /* hop size */
+    uint32_t ringPos;       /* write position of ring buffer */
+    uint32_t pending;       /* number of samples till the end of next segment */
+    uint32_t isPending;     /* segment is waiting for pair */
+    uint32_t pendingOffset; /* offset of waiting segment in ring buffer */
+    uint32_t segments;      /* number of accumulated segments */
+} mc_welch_t;
+
+/** Reset estimator: accumulated power and input history are dropped */
+void mc_welch_reset(mc_welch_t *context);
+
+/** Accumulate power of segments of next part of input stream
+ * 
+ * @param context Pointer to estimator context
+ * @param in Pointer to input signal
+ * @param length Length of input signal (any)
+ */
+void mc_welch_process(mc_welch_t *context, const float *in, uint32_t length);
+
+/** Get the number of segments accumulated so far (including the one waiting for pair) */
+uint32_t mc_welch_get_segment_count(const mc_welch_t *context);
+
+/** Get one-sided PSD: 2*mean(|X[k]|^2)/(fs*sum(w^2)) (DC and Nyquist are not doubled)
+ * 
+ * @param context Pointer to estimator context
+ * @param out Pointer to output PSD (length is MC_STFT_BINS(power2))
+ * @param fs Sample rate (1 gives PSD per normalised frequency)
+ */
+void mc_welch_get_psd(mc_welch_t *context, float *out, float fs);
+
+/** Get Welch estimator object size in bytes if static/non-malloc allocation is required */
+#define MC_WELCH_GET_OBJECT_SIZE(power2) (MC_GET_ALIGNED_SIZE(sizeof(float)*MC_TWIDDLE_LENGTH(power2)) \
+                                          + MC_GET_ALIGNED_SIZE(sizeof(uint32_t)*MC_DIGIT_LENGTH(power2)) \
+                                          + 2u*MC_GET_ALIGNED_SIZE(sizeof(float)*(1u<<(power2))) \
+                                          + MC_GET_ALIGNED_SIZE(sizeof(float)*MC_STFT_RING_LENGTH(power2)) \
+                                          + MC_GET_ALIGNED_SIZE(sizeof(float)*(2u<<(power2))) \
+                                          + MC_MEM_ALIGNMENT)
+
+/** Welch estimator object to control memory alignment and simplify allocation of memory (see mc_welch_t) */
+typedef struct mc_welch_object_t {
+    mc_welch_t context;
+    void *memory;
+} mc_welch_object_t;
+
+/** Create Welch estimator object based on allocated memory (non-malloc API)
+ * 
+ * @param obj Pointer to user's structure where object will be created
+ * @param power2 Power of 2 which reflects required length of FFT (segment)
+ * @param hop Hop size between segments (must be in [1, 2^power2])
+ * @param windowType Window type (see MC_STFT_WINDOW_*)
+ * @param memory Pointer to user's memory which used to create object
+ * @param memSize User's memory size in bytes (see MC_WELCH_GET_OBJECT_SIZE(power2))
+ */
+void mc_welch_create_object(mc_welch_object_t *obj, uint32_t power2, uint32_t hop, uint32_t windowType, 
+                            void *memory, size_t memSize);
+
+/** Allocate Welch estimator object via malloc/free API (can be excluded by defining EXCLUDE_MALLOC macro)
+ * 
+ * @param obj Pointer to user's structure where object will be created
+ * @param power2 Power of 2 which reflects required length of FFT (segment)
+ * @param hop Hop size between segments (must be in [1, 2^power2])
+ * @param windowType Window type (see MC_STFT_WINDOW_*)
+ */
+void mc_welch_allocate(mc_welch_object_t *obj, uint32_t power2, uint32_t hop, uint32_t windowType);
+
+/** Release Welch estimator object via malloc/free API (can be excluded by defining EXCLUDE_MALLOC macro)
+ * 
+ * @param obj Pointer to user's structure where object is created by mc_welch_allocate() function
+ */
+void mc_welch_free(mc_welch_object_t *obj);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MC_FFT_WELCH_H */
@@ -0,0 +1,147 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "mcfft_wisdom.h"
+#include "generic/mcfft_generic.h"
+#include "x86/mcfft_avx.h"
+#include "aarch64/mcfft_neon.h"
+
+#ifndef MC_SELECTOR
+#define MC_SELECTOR g
+#endif
+
+/** Pipeline+1 for each power of 2 (0 - no wisdom) */
+static uint8_t st_wisdom[MC_MAX_FFT_POW2+1u];
+
+void mc_fft_get_cpu_id(char *out, uint32_t length) {
+    MC_NULLPTR_ASSERT(out);
+    MC_ASSERT(length > 0);
+    memset(out, 0, length);
+    MC_FUNC_CALL(get_cpu_id, MC_SELECTOR)(out, length);
+    out[length-1u] = '\0';
+}
+
+uint32_t mc_fft_get_wisdom(uint32_t power2, uint32_t *pipeline) {
+    MC_NULLPTR_ASSERT(pipeline);
+    if ((power2 > MC_MAX_FFT_POW2) || (0 == st_wisdom[power2])) {
+        return 0;
+    }
+    *pipeline = st_wisdom[power2] - 1u;
+    return 1u;
+}
+
+void mc_fft_set_wisdom(uint32_t power2, uint32_t pipeline) {
+    MC_ASSERT(MC_MAX_FFT_POW2 >= power2);
+    MC_ASSERT(MC_FFT_PIPELINE_COUNT > pipeline);
+    st_wisdom[power2] = (uint8_t)(pipeline + 1u);
+}
+
+void mc_fft_forget_wisdom(void) {
+    memset(st_wisdom, 0, sizeof(st_wisdom));
+}
+
+static void st_fill_header(mc_fft_wisdom_header_t *header, uint32_t count) {
+    memset(header, 0, sizeof(*header));
+    header->magic = MC_FFT_WISDOM_MAGIC;
+    header->version = MC_FFT_WISDOM_VERSION;
+    header->libVersion = MC_FFT_VERSION;
+    header->compactTwiddle = MC_COMPACT_TWIDDLE;
+    mc_fft_get_cpu_id(header->cpuId, MC_FFT_CPU_ID_LENGTH);
+    header->count = count;
+}
+
+size_t mc_fft_export_wisdom(void *memory, size_t memSize) {
+    uint32_t count = 0;
+    for (uint32_t i = 0; i <= MC_MAX_FFT_POW2; ++i) {
+        count += (0 != st_wisdom[i]) ? 1u : 0u;
+    }
+    size_t size = sizeof(mc_fft_wisdom_header_t) + count*sizeof(mc_fft_wisdom_entry_t);
+    if (NULL == memory) {
+        return size;
+    }
+    MC_ASSERT(memSize >= size);
+    /** NOTE: memcpy is used as user's memory may be not aligned */
+    mc_fft_wisdom_header_t header;
+    uint8_t *out = (uint8_t*)memory + sizeof(header);
+    st_fill_header(&header, count);
+    memcpy(memory, &header, sizeof(header));
+    for (uint32_t i = 0; i <= MC_MAX_FFT_POW2; ++i) {
+        if (0 != st_wisdom[i]) {
+            mc_fft_wisdom_entry_t entry = {(uint16_t)i, (uint16_t)(st_wisdom[i] - 1u)};
+            memcpy(out, &entry, sizeof(entry));
+            out += sizeof(entry);
+        }
+    }
+    return size;
+}
+
+uint32_t mc_fft_import_wisdom(const void *memory, size_t memSize) {
+    mc_fft_wisdom_header_t header;
+    mc_fft_wisdom_header_t expected;
+    const uint8_t *in = (const uint8_t*)memory + sizeof(header);
+    uint32_t imported = 0;
+    MC_NULLPTR_ASSERT(memory);
+    if (memSize < sizeof(header)) {
+        return 0;
+    }
+    memcpy(&header, memory, sizeof(header));
+    st_fill_header(&expected, header.count);
+    if ((header.magic != expected.magic) || (header.version != expected.version) || 
+        (header.libVersion != expected.libVersion) || (header.compactTwiddle != expected.compactTwiddle) || 
+        (0 != memcmp(header.cpuId, expected.cpuId, MC_FFT_CPU_ID_LENGTH)) || (header.count > (MC_MAX_FFT_POW2+1u)) || 
+        (memSize < (sizeof(header) + header.count*sizeof(mc_fft_wisdom_entry_t)))) {
+        return 0;
+    }
+    for (uint32_t i = 0; i < header.count; ++i) {
+        mc_fft_wisdom_entry_t entry;
+        memcpy(&entry, in, sizeof(entry));
+        in += sizeof(entry);
+        if ((MC_MAX_FFT_POW2 >= entry.pow2) && (MC_FFT_PIPELINE_COUNT > entry.pipeline)) {
+            mc_fft_set_wisdom(entry.pow2, entry.pipeline);
+            ++imported;
+        }
+    }
+    return imported;
+}
+
+#ifndef MC_EXCLUDE_FILE_IO
+uint32_t mc_fft_export_wisdom_to_file(const char *path) {
+    uint8_t blob[MC_FFT_WISDOM_MAX_SIZE];
+    MC_NULLPTR_ASSERT(path);
+    size_t size = mc_fft_export_wisdom(blob, sizeof(blob));
+    return mc_file_write(path, blob, size);
+}
+
+uint32_t mc_fft_import_wisdom_from_file(const char *path) {
+    size_t size = 0;
+    uint32_t imported = 0;
+    MC_NULLPTR_ASSERT(path);
+    const void *blob = mc_file_map(path, &size);
+    if (NULL != blob) {
+        imported = mc_fft_import_wisdom(blob, size);
+        mc_file_unmap(blob, size);
+    }
+    return imported;
+}
+#endif // MC_EXCLUDE_FILE_IO
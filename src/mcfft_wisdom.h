@@ -0,0 +1,127 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MC_FFT_WISDOM_H
+#define MC_FFT_WISDOM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "mcfft.h"
+
+/** Wisdom keeps pipelines chosen by planner (see mc_fft_plan()) for each power of 2:
+ *  - MC_FFT_PLAN_MEASURE stores the measured pipeline to wisdom
+ *  - MC_FFT_PLAN_ESTIMATE (mc_fft_create_object()) uses wisdom if it exists instead of heuristic
+ * 
+ * Wisdom can be exported to a compact binary blob/file and imported at startup (file is mmapped),
+ * so measurement is done once per machine. Blob is rejected if it was created by another CPU model, 
+ * SIMD selector, twiddle layout or library version (pipelines would not be optimal/valid).
+ * NOTE: Wisdom is global and not thread-safe: import/forget it before planning in other threads
+ * NOTE: Blob uses native byte order (it is bound to CPU anyway)
+ */
+
+/** Wisdom blob magic: 'MCFW' */
+#define MC_FFT_WISDOM_MAGIC (0x5746434Du)
+/** Wisdom blob format version */
+#define MC_FFT_WISDOM_VERSION (1u)
+/** Max length of CPU identification string (including '\0') */
+#define MC_FFT_CPU_ID_LENGTH (64u)
+
+/** Wisdom blob header */
+typedef struct mc_fft_wisdom_header_t {
+    uint32_t magic;                     /* MC_FFT_WISDOM_MAGIC */
+    uint32_t version;                   /* MC_FFT_WISDOM_VERSION */
+    uint32_t libVersion;                /* MC_FFT_VERSION */
+    uint32_t compactTwiddle;            /* MC_COMPACT_TWIDDLE */
+    char cpuId[MC_FFT_CPU_ID_LENGTH];   /* See mc_fft_get_cpu_id() */
+    uint32_t count;                     /* Number of entries after header */
+    uint32_t reserved;
+} mc_fft_wisdom_header_t;
+
+/** Wisdom blob entry */
+typedef struct mc_fft_wisdom_entry_t {
+    uint16_t pow2;
+    uint16_t pipeline;  /* MC_FFT_PIPELINE_* flags */
+} mc_fft_wisdom_entry_t;
+
+/** Max size of wisdom blob in bytes */
+#define MC_FFT_WISDOM_MAX_SIZE (sizeof(mc_fft_wisdom_header_t) + (MC_MAX_FFT_POW2+1u)*sizeof(mc_fft_wisdom_entry_t))
+
+/** Get identification of CPU model & SIMD selector (key of wisdom)
+ * 
+ * @param out Pointer to user's buffer to store '\0'-terminated string
+ * @param length Length of user's buffer (see MC_FFT_CPU_ID_LENGTH)
+ */
+void mc_fft_get_cpu_id(char *out, uint32_t length);
+
+/** Get pipeline from wisdom
+ * 
+ * @param power2 Power of 2 which reflects required length of FFT
+ * @param pipeline Pointer to store MC_FFT_PIPELINE_* flags
+ * @return 1 if wisdom exists for power2, 0 otherwise
+ */
+uint32_t mc_fft_get_wisdom(uint32_t power2, uint32_t *pipeline);
+
+/** Store pipeline to wisdom (called by mc_fft_plan() in MC_FFT_PLAN_MEASURE mode) */
+void mc_fft_set_wisdom(uint32_t power2, uint32_t pipeline);
+
+/** Remove all wisdom */
+void mc_fft_forget_wisdom(void);
+
+/** Export wisdom to user's memory
+ * 
+ * @param memory Pointer to user's memory (can be NULL to get required size)
+ * @param memSize Size of user's memory in bytes (see MC_FFT_WISDOM_MAX_SIZE)
+ * @return Number of bytes written (required if memory is NULL)
+ */
+size_t mc_fft_export_wisdom(void *memory, size_t memSize);
+
+/** Import wisdom from memory (existing wisdom is kept for power2 not present in blob)
+ * 
+ * @param memory Pointer to wisdom blob (see mc_fft_export_wisdom())
+ * @param memSize Size of wisdom blob in bytes
+ * @return Number of imported entries (0 if blob is invalid or created for another CPU/library)
+ */
+uint32_t mc_fft_import_wisdom(const void *memory, size_t memSize);
+
+#ifndef MC_EXCLUDE_FILE_IO
+/** Export wisdom to file
+ * 
+ * @return 1 if file is written, 0 otherwise
+ */
+uint32_t mc_fft_export_wisdom_to_file(const char *path);
+
+/** Import wisdom from file (file is mmapped if supported)
+ * 
+ * @return Number of imported entries (0 if file is absent/invalid or created for another CPU/library)
+ */
+uint32_t mc_fft_import_wisdom_from_file(const char *path);
+#endif // MC_EXCLUDE_FILE_IO
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MC_FFT_WISDOM_H */
@@ -22,6 +22,10 @@
  * SOFTWARE.
  */
 
+#if !defined(_MSC_VER) && !defined(_POSIX_C_SOURCE)
+/** clock_gettime()/CLOCK_MONOTONIC with strict -std=c11 */
+#define _POSIX_C_SOURCE 200809L
+#endif
 #include "utils.h"
 
 void mc_fftr_unpack_dual_to_perm(float * restrict perm0_re, float * restrict perm0_im,
@@ -62,7 +66,8 @@ void mc_fft_norm(float * restrict re, float * restrict im, uint32_t length)
 {
     MC_NULLPTR_ASSERT(re);
     MC_NULLPTR_ASSERT(im);
-    MC_ASSERT(MC_MAX_FFT_LENGTH >= length);
+    /** NOTE: any length, parallel FFT exceeds MC_MAX_FFT_LENGTH */
+    MC_ASSERT(length > 0);
 
     float norm_coeff = 1.f / (float)length;
 
@@ -72,6 +77,129 @@ void mc_fft_norm(float * restrict re, float * restrict im, uint32_t length)
     }
 }
 
+#if defined(_MSC_VER)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+uint64_t mc_get_time_ns(void) {
+    /** Monotonic clock: wall clock may jump (NTP, admin) and mislead planner */
+#if defined(_MSC_VER)
+    LARGE_INTEGER counter, frequency;
+    (void)QueryPerformanceCounter(&counter);
+    (void)QueryPerformanceFrequency(&frequency);
+    return (uint64_t)((counter.QuadPart/frequency.QuadPart)*1000000000ull
+                      + ((counter.QuadPart%frequency.QuadPart)*1000000000ull)/frequency.QuadPart);
+#else
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec*1000000000ull + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+#ifndef MC_EXCLUDE_FILE_IO
+#include <stdio.h>
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#define MC_USE_MMAP
+#endif
+
+#ifndef MC_EXCLUDE_MALLOC
+const void *mc_file_read(const char *path, size_t *size) {
+    MC_NULLPTR_ASSERT(path);
+    MC_NULLPTR_ASSERT(size);
+    void *memory = NULL;
+    uintptr_t data = 0;
+    long fileSize = 0;
+    *size = 0;
+    FILE *file = fopen(path, "rb");
+    if (NULL == file) {
+        return NULL;
+    }
+    if ((0 == fseek(file, 0, SEEK_END)) && ((fileSize = ftell(file)) > 0) && (0 == fseek(file, 0, SEEK_SET))) {
+        /** malloc() guarantees 16 bytes only: aligned data, pointer to allocated memory right before data */
+        memory = malloc((size_t)fileSize + MC_MEM_ALIGNMENT + sizeof(void*));
+        if (NULL != memory) {
+            data = MC_GET_ALIGNED_PTR((uintptr_t)memory + sizeof(void*));
+            ((void**)data)[-1] = memory;
+            if (1u != fread((void*)data, (size_t)fileSize, 1u, file)) {
+                free(memory);
+                data = 0;
+            }
+        }
+    }
+    fclose(file);
+    *size = (0 != data) ? (size_t)fileSize : 0u;
+    return (const void*)data;
+}
+
+void mc_file_release(const void *memory) {
+    if (NULL != memory) {
+        free(((void* const*)memory)[-1]);
+    }
+}
+#endif // MC_EXCLUDE_MALLOC
+
+const void *mc_file_map(const char *path, size_t *size) {
+    MC_NULLPTR_ASSERT(path);
+    MC_NULLPTR_ASSERT(size);
+    *size = 0;
+#ifdef MC_USE_MMAP
+    void *memory = NULL;
+    struct stat st;
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return NULL;
+    }
+    if ((0 == fstat(fd, &st)) && (st.st_size > 0)) {
+        memory = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        if (MAP_FAILED == memory) {
+            memory = NULL;
+        } else {
+            *size = (size_t)st.st_size;
+        }
+    }
+    /** NOTE: mapping stays valid after close() */
+    close(fd);
+    return memory;
+#elif !defined(MC_EXCLUDE_MALLOC)
+    return mc_file_read(path, size);
+#else
+    return NULL;
+#endif
+}
+
+void mc_file_unmap(const void *memory, size_t size) {
+    if (NULL == memory) {
+        return;
+    }
+#ifdef MC_USE_MMAP
+    munmap((void*)memory, size);
+#elif !defined(MC_EXCLUDE_MALLOC)
+    (void)size;
+    mc_file_release(memory);
+#else
+    (void)size;
+#endif
+}
+
+uint32_t mc_file_write(const char *path, const void *memory, size_t size) {
+    MC_NULLPTR_ASSERT(path);
+    MC_NULLPTR_ASSERT(memory);
+    uint32_t isWritten = 0;
+    FILE *file = fopen(path, "wb");
+    if (NULL != file) {
+        isWritten = (1u == fwrite(memory, size, 1u, file)) ? 1u : 0u;
+        isWritten = (0 == fclose(file)) ? isWritten : 0u;
+    }
+    return isWritten;
+}
+#endif // MC_EXCLUDE_FILE_IO
+
 #include <math.h>
 
 void mc_test_add_sinwave(float *output, uint32_t length, float gain, float freq, float fs) {
@@ -34,6 +34,11 @@ extern "C" {
 #include <string.h>
 #include <assert.h>
 
+/** C++ doesn't have restrict keyword (C99), use compiler's extension instead */
+#if defined(__cplusplus) && !defined(restrict)
+#define restrict __restrict
+#endif
+
 #define MC_ASSERT(x) assert((x))
 #define MC_NULLPTR_ASSERT(x) assert((NULL != (x)))
 #ifdef static_assert
@@ -66,9 +71,10 @@ extern "C" {
 
 #define MC_TO_STRING_(msg) #msg
 #define MC_MACRO_TO_STRING(line) MC_TO_STRING_(line)
-#define MC_WARNING(msg) (__FILE__ ":["MC_MACRO_TO_STRING(__LINE__)"]:" msg)
+#define MC_WARNING(msg) (__FILE__ ":[" MC_MACRO_TO_STRING(__LINE__) "]:" msg)
 
 #define MC_MAX_FFT_LENGTH (16384u)
+#define MC_MAX_FFT_POW2 (14u)
 #define MC_MIN_FFT_LENGTH (32u)
 
 #define MC_PI (3.141592653589793f)
@@ -90,6 +96,41 @@ void mc_fftr_unpack_dual_to_perm(float * restrict perm0_re, float * restrict per
                                  const float * restrict dualRe, const float * restrict dualIm, 
                                  uint32_t length);
 
+/** Get monotonic timestamp in nanoseconds (used by planner to measure pipelines) */
+uint64_t mc_get_time_ns(void);
+
+#ifndef MC_EXCLUDE_FILE_IO
+#ifndef MC_EXCLUDE_MALLOC
+/** Read whole file to allocated memory aligned by MC_MEM_ALIGNMENT (fallback of mc_file_map() without mmap)
+ * 
+ * @param path Path to file
+ * @param size Pointer to store size of file in bytes
+ * @return Pointer to file content or NULL if file can't be read (release by mc_file_release())
+ */
+const void *mc_file_read(const char *path, size_t *size);
+
+/** Release memory returned by mc_file_read() */
+void mc_file_release(const void *memory);
+#endif // MC_EXCLUDE_MALLOC
+
+/** Map whole file to read-only memory (mmap for POSIX, malloc/fread otherwise)
+ * 
+ * @param path Path to file
+ * @param size Pointer to store size of file in bytes
+ * @return Pointer to file content or NULL if file can't be read
+ */
+const void *mc_file_map(const char *path, size_t *size);
+
+/** Release memory returned by mc_file_map() */
+void mc_file_unmap(const void *memory, size_t size);
+
+/** Write memory to file (file is overwritten)
+ * 
+ * @return 1 if all bytes are written, 0 otherwise
+ */
+uint32_t mc_file_write(const char *path, const void *memory, size_t size);
+#endif // MC_EXCLUDE_FILE_IO
+
 void mc_test_add_sinwave(float *output, uint32_t length, float gain, float freq, float fs);
 
 float mc_test_mean_error(const float *v0, const float *v1, uint32_t length);
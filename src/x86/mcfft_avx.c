@@ -24,6 +24,12 @@
 
 #include "mcfft_avx.h"
 #include "generic/mcfft_generic.h"
+#include <stdio.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
 #define MC_FFT_DIRECTION fft
 #define MC_INVERSE_FFT (0)
 #include "mcfft_rad4_template_avx.c"
@@ -50,6 +56,302 @@ void mc_shuffle_mono_avx(float * restrict re, float * restrict im, float * restr
     memcpy(im, tmp_im, sizeof(im[0])*length);
 }
 
+void mc_transpose_tile_avx(float * restrict out, const float * restrict in, uint32_t inStride, uint32_t outStride, uint32_t rows) {
+    /** 8x8 blocks are transposed in registers */
+    for (uint32_t r = 0; r < rows; r += 8u) {
+        const float *src = &in[r*inStride];
+        __m256 r0 = _mm256_loadu_ps(src);
+        __m256 r1 = _mm256_loadu_ps(&src[inStride]);
+        __m256 r2 = _mm256_loadu_ps(&src[2u*inStride]);
+        __m256 r3 = _mm256_loadu_ps(&src[3u*inStride]);
+        __m256 r4 = _mm256_loadu_ps(&src[4u*inStride]);
+        __m256 r5 = _mm256_loadu_ps(&src[5u*inStride]);
+        __m256 r6 = _mm256_loadu_ps(&src[6u*inStride]);
+        __m256 r7 = _mm256_loadu_ps(&src[7u*inStride]);
+        __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+        __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+        __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+        __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+        __m256 t4 = _mm256_unpacklo_ps(r4, r5);
+        __m256 t5 = _mm256_unpackhi_ps(r4, r5);
+        __m256 t6 = _mm256_unpacklo_ps(r6, r7);
+        __m256 t7 = _mm256_unpackhi_ps(r6, r7);
+        r0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+        r1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+        r2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+        r3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+        r4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+        r5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+        r6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+        r7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+        _mm256_storeu_ps(&out[r], _mm256_permute2f128_ps(r0, r4, 0x20));
+        _mm256_storeu_ps(&out[outStride + r], _mm256_permute2f128_ps(r1, r5, 0x20));
+        _mm256_storeu_ps(&out[2u*outStride + r], _mm256_permute2f128_ps(r2, r6, 0x20));
+        _mm256_storeu_ps(&out[3u*outStride + r], _mm256_permute2f128_ps(r3, r7, 0x20));
+        _mm256_storeu_ps(&out[4u*outStride + r], _mm256_permute2f128_ps(r0, r4, 0x31));
+        _mm256_storeu_ps(&out[5u*outStride + r], _mm256_permute2f128_ps(r1, r5, 0x31));
+        _mm256_storeu_ps(&out[6u*outStride + r], _mm256_permute2f128_ps(r2, r6, 0x31));
+        _mm256_storeu_ps(&out[7u*outStride + r], _mm256_permute2f128_ps(r3, r7, 0x31));
+    }
+}
+
+void mc_fft_columns_avx(float * restrict re, float * restrict im, const float * restrict twiddle, 
+                        const uint16_t * restrict bitRev, uint32_t stride, uint32_t pow2, uint32_t columns) {
+    /** DIF over rows, 8 columns per vector (see mc_fft_columns_g()) */
+    const uint32_t length = 1u<<pow2;
+    const uint32_t vColumns = columns & ~7u;
+    const float *twIm = &twiddle[length];
+    uint32_t quarter = length>>2u;
+    for (uint32_t twStep = 1u; quarter > 0; quarter >>= 2u, twStep <<= 2u) {
+        for (uint32_t start = 0; start < length; start += 4u*quarter) {
+            for (uint32_t j = 0; j < quarter; ++j) {
+                const __m256 w1Re_v = _mm256_set1_ps(twiddle[j*twStep]);
+                const __m256 w1Im_v = _mm256_set1_ps(twIm[j*twStep]);
+                const __m256 w2Re_v = _mm256_set1_ps(twiddle[2u*j*twStep]);
+                const __m256 w2Im_v = _mm256_set1_ps(twIm[2u*j*twStep]);
+                const __m256 w3Re_v = _mm256_set1_ps(twiddle[3u*j*twStep]);
+                const __m256 w3Im_v = _mm256_set1_ps(twIm[3u*j*twStep]);
+                float *aRe = &re[(start + j)*stride];
+                float *aIm = &im[(start + j)*stride];
+                float *bRe = &re[(start + j + quarter)*stride];
+                float *bIm = &im[(start + j + quarter)*stride];
+                float *cRe = &re[(start + j + 2u*quarter)*stride];
+                float *cIm = &im[(start + j + 2u*quarter)*stride];
+                float *dRe = &re[(start + j + 3u*quarter)*stride];
+                float *dIm = &im[(start + j + 3u*quarter)*stride];
+                for (uint32_t c = 0; c < vColumns; c += 8u) {
+                    const __m256 aRe_v = _mm256_loadu_ps(&aRe[c]);
+                    const __m256 aIm_v = _mm256_loadu_ps(&aIm[c]);
+                    const __m256 bRe_v = _mm256_loadu_ps(&bRe[c]);
+                    const __m256 bIm_v = _mm256_loadu_ps(&bIm[c]);
+                    const __m256 cRe_v = _mm256_loadu_ps(&cRe[c]);
+                    const __m256 cIm_v = _mm256_loadu_ps(&cIm[c]);
+                    const __m256 dRe_v = _mm256_loadu_ps(&dRe[c]);
+                    const __m256 dIm_v = _mm256_loadu_ps(&dIm[c]);
+                    const __m256 s0Re_v = _mm256_add_ps(aRe_v, cRe_v);
+                    const __m256 s0Im_v = _mm256_add_ps(aIm_v, cIm_v);
+                    const __m256 d0Re_v = _mm256_sub_ps(aRe_v, cRe_v);
+                    const __m256 d0Im_v = _mm256_sub_ps(aIm_v, cIm_v);
+                    const __m256 s1Re_v = _mm256_add_ps(bRe_v, dRe_v);
+                    const __m256 s1Im_v = _mm256_add_ps(bIm_v, dIm_v);
+                    const __m256 d1Re_v = _mm256_sub_ps(bRe_v, dRe_v);
+                    const __m256 d1Im_v = _mm256_sub_ps(bIm_v, dIm_v);
+                    const __m256 y2Re_v = _mm256_sub_ps(s0Re_v, s1Re_v);
+                    const __m256 y2Im_v = _mm256_sub_ps(s0Im_v, s1Im_v);
+                    const __m256 y1Re_v = _mm256_add_ps(d0Re_v, d1Im_v);
+                    const __m256 y1Im_v = _mm256_sub_ps(d0Im_v, d1Re_v);
+                    const __m256 y3Re_v = _mm256_sub_ps(d0Re_v, d1Im_v);
+                    const __m256 y3Im_v = _mm256_add_ps(d0Im_v, d1Re_v);
+                    _mm256_storeu_ps(&aRe[c], _mm256_add_ps(s0Re_v, s1Re_v));
+                    _mm256_storeu_ps(&aIm[c], _mm256_add_ps(s0Im_v, s1Im_v));
+                    _mm256_storeu_ps(&bRe[c], _mm256_sub_ps(_mm256_mul_ps(y2Re_v, w2Re_v), _mm256_mul_ps(y2Im_v, w2Im_v)));
+                    _mm256_storeu_ps(&bIm[c], _mm256_add_ps(_mm256_mul_ps(y2Re_v, w2Im_v), _mm256_mul_ps(y2Im_v, w2Re_v)));
+                    _mm256_storeu_ps(&cRe[c], _mm256_sub_ps(_mm256_mul_ps(y1Re_v, w1Re_v), _mm256_mul_ps(y1Im_v, w1Im_v)));
+                    _mm256_storeu_ps(&cIm[c], _mm256_add_ps(_mm256_mul_ps(y1Re_v, w1Im_v), _mm256_mul_ps(y1Im_v, w1Re_v)));
+                    _mm256_storeu_ps(&dRe[c], _mm256_sub_ps(_mm256_mul_ps(y3Re_v, w3Re_v), _mm256_mul_ps(y3Im_v, w3Im_v)));
+                    _mm256_storeu_ps(&dIm[c], _mm256_add_ps(_mm256_mul_ps(y3Re_v, w3Im_v), _mm256_mul_ps(y3Im_v, w3Re_v)));
+                }
+            }
+        }
+    }
+    if (pow2 & 1u) {
+        for (uint32_t start = 0; start < length; start += 2u) {
+            float *aRe = &re[start*stride];
+            float *aIm = &im[start*stride];
+            float *bRe = &re[(start + 1u)*stride];
+            float *bIm = &im[(start + 1u)*stride];
+            for (uint32_t c = 0; c < vColumns; c += 8u) {
+                const __m256 aRe_v = _mm256_loadu_ps(&aRe[c]);
+                const __m256 aIm_v = _mm256_loadu_ps(&aIm[c]);
+                const __m256 bRe_v = _mm256_loadu_ps(&bRe[c]);
+                const __m256 bIm_v = _mm256_loadu_ps(&bIm[c]);
+                _mm256_storeu_ps(&aRe[c], _mm256_add_ps(aRe_v, bRe_v));
+                _mm256_storeu_ps(&aIm[c], _mm256_add_ps(aIm_v, bIm_v));
+                _mm256_storeu_ps(&bRe[c], _mm256_sub_ps(aRe_v, bRe_v));
+                _mm256_storeu_ps(&bIm[c], _mm256_sub_ps(aIm_v, bIm_v));
+            }
+        }
+    }
+    for (uint32_t i = 0; i < length; ++i) {
+        const uint32_t j = bitRev[i];
+        if (i < j) {
+            for (uint32_t c = 0; c < vColumns; c += 8u) {
+                const __m256 re_v = _mm256_loadu_ps(&re[i*stride + c]);
+                const __m256 im_v = _mm256_loadu_ps(&im[i*stride + c]);
+                _mm256_storeu_ps(&re[i*stride + c], _mm256_loadu_ps(&re[j*stride + c]));
+                _mm256_storeu_ps(&im[i*stride + c], _mm256_loadu_ps(&im[j*stride + c]));
+                _mm256_storeu_ps(&re[j*stride + c], re_v);
+                _mm256_storeu_ps(&im[j*stride + c], im_v);
+            }
+        }
+    }
+    if (vColumns < columns) {
+        mc_fft_columns_g(&re[vColumns], &im[vColumns], twiddle, bitRev, stride, pow2, columns - vColumns);
+    }
+}
+
+void mc_gather_signed_avx(float * restrict out, const float * restrict in, const uint16_t * restrict index, uint32_t length) {
+    const __m256i mask_v = _mm256_set1_epi32((int)(MC_GATHER_NEGATE - 1u));
+    for (uint32_t i = 0; i < length; i += 8u) {
+        __m256i index_v = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)&index[i]));
+        __m256 value_v = _mm256_i32gather_ps(in, _mm256_and_si256(index_v, mask_v), 4);
+        /** MSB of 16-bit index -> sign bit of float */
+        __m256 sign_v = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_andnot_si256(mask_v, index_v), 16));
+        _mm256_storeu_ps(&out[i], _mm256_xor_ps(value_v, sign_v));
+    }
+}
+
+static inline __m256 st_reverse_avx(__m256 v) {
+    return _mm256_permutevar8x32_ps(v, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+}
+
+static inline __m256 st_load_even_avx(const float *p) {
+    /** p[0], p[2], ..., p[14] */
+    __m256 v = _mm256_shuffle_ps(_mm256_loadu_ps(p), _mm256_loadu_ps(&p[8]), _MM_SHUFFLE(2, 0, 2, 0));
+    return _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(v), _MM_SHUFFLE(3, 1, 2, 0)));
+}
+
+static inline __m256 st_load_even_reversed_avx(const float *p) {
+    /** p[0], p[-2], ..., p[-14] (p[1] is not touched) */
+    __m256 v = _mm256_shuffle_ps(_mm256_loadu_ps(p - 15), _mm256_loadu_ps(p - 7), _MM_SHUFFLE(3, 1, 3, 1));
+    return st_reverse_avx(_mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(v), _MM_SHUFFLE(3, 1, 2, 0))));
+}
+
+void mc_mdct_fold_avx(float * restrict re, float * restrict im, const float * restrict in, const float * restrict coeff, 
+                      const uint32_t * restrict offset, uint32_t length) {
+    const float *rotRe = &coeff[4u*length];
+    const float *rotIm = &coeff[5u*length];
+    for (uint32_t m = 0; m < length; m += 8u) {
+        __m256 tRe_v = _mm256_mul_ps(_mm256_loadu_ps(&coeff[m]), st_load_even_avx(&in[offset[0] + 2u*m]));
+        __m256 tIm_v = _mm256_mul_ps(_mm256_loadu_ps(&coeff[2u*length + m]), st_load_even_avx(&in[offset[2] + 2u*m]));
+        tRe_v = _mm256_fmadd_ps(_mm256_loadu_ps(&coeff[length + m]), st_load_even_reversed_avx(&in[offset[1] - 2u*m]), tRe_v);
+        tIm_v = _mm256_fmadd_ps(_mm256_loadu_ps(&coeff[3u*length + m]), st_load_even_reversed_avx(&in[offset[3] - 2u*m]), tIm_v);
+        __m256 rotRe_v = _mm256_loadu_ps(&rotRe[m]);
+        __m256 rotIm_v = _mm256_loadu_ps(&rotIm[m]);
+        _mm256_storeu_ps(&re[m], _mm256_fmsub_ps(tRe_v, rotRe_v, _mm256_mul_ps(tIm_v, rotIm_v)));
+        _mm256_storeu_ps(&im[m], _mm256_fmadd_ps(tRe_v, rotIm_v, _mm256_mul_ps(tIm_v, rotRe_v)));
+    }
+}
+
+void mc_mdct_unfold_avx(float * restrict out, const float * restrict re, const float * restrict im, 
+                        const float * restrict rotation, uint32_t length) {
+    const float *rotIm = &rotation[length];
+    for (uint32_t k = 0; k < length; k += 8u) {
+        const uint32_t j = length - 8u - k;
+        __m256 yRe_v = _mm256_fmsub_ps(_mm256_loadu_ps(&re[k]), _mm256_loadu_ps(&rotation[k]), 
+                                       _mm256_mul_ps(_mm256_loadu_ps(&im[k]), _mm256_loadu_ps(&rotIm[k])));
+        __m256 yIm_v = _mm256_fmadd_ps(_mm256_loadu_ps(&re[j]), _mm256_loadu_ps(&rotIm[j]), 
+                                       _mm256_mul_ps(_mm256_loadu_ps(&im[j]), _mm256_loadu_ps(&rotation[j])));
+        yIm_v = st_reverse_avx(_mm256_sub_ps(_mm256_setzero_ps(), yIm_v));
+        __m256 lo_v = _mm256_unpacklo_ps(yRe_v, yIm_v);
+        __m256 hi_v = _mm256_unpackhi_ps(yRe_v, yIm_v);
+        _mm256_storeu_ps(&out[2u*k], _mm256_permute2f128_ps(lo_v, hi_v, 0x20));
+        _mm256_storeu_ps(&out[2u*k + 8u], _mm256_permute2f128_ps(lo_v, hi_v, 0x31));
+    }
+}
+
+void mc_mdct_overlap_avx(float * restrict out, float * restrict overlap, const float * restrict in, 
+                         const float * restrict window, uint32_t length) {
+    for (uint32_t i = 0; i < length; i += 8u) {
+        _mm256_storeu_ps(&out[i], _mm256_fmadd_ps(_mm256_loadu_ps(&window[i]), _mm256_loadu_ps(&in[i]), 
+                                                  _mm256_loadu_ps(&overlap[i])));
+        _mm256_storeu_ps(&overlap[i], _mm256_mul_ps(_mm256_loadu_ps(&window[length + i]), _mm256_loadu_ps(&in[length + i])));
+    }
+}
+
+void mc_polyphase_mac_avx(float * restrict outRe, float * restrict outIm, const float * restrict re, const float * restrict im, 
+                          const float * restrict coeff, uint32_t stride, uint32_t length, uint32_t taps) {
+    for (uint32_t k = 0; k < length; k += 8u) {
+        __m256 accRe_v = _mm256_setzero_ps();
+        __m256 accIm_v = _mm256_setzero_ps();
+        for (uint32_t p = 0; p < taps; ++p) {
+            __m256 coeff_v = _mm256_loadu_ps(&coeff[p*stride + k]);
+            accRe_v = _mm256_fmadd_ps(coeff_v, _mm256_loadu_ps(&re[p*stride + k]), accRe_v);
+            accIm_v = _mm256_fmadd_ps(coeff_v, _mm256_loadu_ps(&im[p*stride + k]), accIm_v);
+        }
+        _mm256_storeu_ps(&outRe[k], accRe_v);
+        _mm256_storeu_ps(&outIm[k], accIm_v);
+    }
+}
+
+void mc_goertzel_avx(float * restrict outRe, float * restrict outIm, const float * restrict in, 
+                     const float * restrict coeff, uint32_t length, uint32_t bins) {
+    /** Recursion is latency bound: 4 independent vectors (32 bins) per pass over input */
+    const float *sinW = &coeff[bins];
+    uint32_t b = 0;
+    for (; (b + 32u) <= bins; b += 32u) {
+        __m256 c0_v = _mm256_loadu_ps(&coeff[b]);
+        __m256 c1_v = _mm256_loadu_ps(&coeff[b + 8u]);
+        __m256 c2_v = _mm256_loadu_ps(&coeff[b + 16u]);
+        __m256 c3_v = _mm256_loadu_ps(&coeff[b + 24u]);
+        __m256 k0_v = _mm256_add_ps(c0_v, c0_v), k1_v = _mm256_add_ps(c1_v, c1_v);
+        __m256 k2_v = _mm256_add_ps(c2_v, c2_v), k3_v = _mm256_add_ps(c3_v, c3_v);
+        __m256 a0_v = _mm256_setzero_ps(), a1_v = a0_v, a2_v = a0_v, a3_v = a0_v;
+        __m256 p0_v = a0_v, p1_v = a0_v, p2_v = a0_v, p3_v = a0_v;
+        for (uint32_t n = 0; n < length; ++n) {
+            __m256 x_v = _mm256_broadcast_ss(&in[n]);
+            __m256 t0_v = _mm256_fmadd_ps(k0_v, a0_v, _mm256_sub_ps(x_v, p0_v));
+            __m256 t1_v = _mm256_fmadd_ps(k1_v, a1_v, _mm256_sub_ps(x_v, p1_v));
+            __m256 t2_v = _mm256_fmadd_ps(k2_v, a2_v, _mm256_sub_ps(x_v, p2_v));
+            __m256 t3_v = _mm256_fmadd_ps(k3_v, a3_v, _mm256_sub_ps(x_v, p3_v));
+            p0_v = a0_v, p1_v = a1_v, p2_v = a2_v, p3_v = a3_v;
+            a0_v = t0_v, a1_v = t1_v, a2_v = t2_v, a3_v = t3_v;
+        }
+        _mm256_storeu_ps(&outRe[b], _mm256_fmsub_ps(c0_v, a0_v, p0_v));
+        _mm256_storeu_ps(&outRe[b + 8u], _mm256_fmsub_ps(c1_v, a1_v, p1_v));
+        _mm256_storeu_ps(&outRe[b + 16u], _mm256_fmsub_ps(c2_v, a2_v, p2_v));
+        _mm256_storeu_ps(&outRe[b + 24u], _mm256_fmsub_ps(c3_v, a3_v, p3_v));
+        _mm256_storeu_ps(&outIm[b], _mm256_mul_ps(_mm256_loadu_ps(&sinW[b]), a0_v));
+        _mm256_storeu_ps(&outIm[b + 8u], _mm256_mul_ps(_mm256_loadu_ps(&sinW[b + 8u]), a1_v));
+        _mm256_storeu_ps(&outIm[b + 16u], _mm256_mul_ps(_mm256_loadu_ps(&sinW[b + 16u]), a2_v));
+        _mm256_storeu_ps(&outIm[b + 24u], _mm256_mul_ps(_mm256_loadu_ps(&sinW[b + 24u]), a3_v));
+    }
+    if ((b + 16u) <= bins) {
+        __m256 c0_v = _mm256_loadu_ps(&coeff[b]);
+        __m256 c1_v = _mm256_loadu_ps(&coeff[b + 8u]);
+        __m256 k0_v = _mm256_add_ps(c0_v, c0_v), k1_v = _mm256_add_ps(c1_v, c1_v);
+        __m256 a0_v = _mm256_setzero_ps(), a1_v = a0_v, p0_v = a0_v, p1_v = a0_v;
+        for (uint32_t n = 0; n < length; ++n) {
+            __m256 x_v = _mm256_broadcast_ss(&in[n]);
+            __m256 t0_v = _mm256_fmadd_ps(k0_v, a0_v, _mm256_sub_ps(x_v, p0_v));
+            __m256 t1_v = _mm256_fmadd_ps(k1_v, a1_v, _mm256_sub_ps(x_v, p1_v));
+            p0_v = a0_v, p1_v = a1_v;
+            a0_v = t0_v, a1_v = t1_v;
+        }
+        _mm256_storeu_ps(&outRe[b], _mm256_fmsub_ps(c0_v, a0_v, p0_v));
+        _mm256_storeu_ps(&outRe[b + 8u], _mm256_fmsub_ps(c1_v, a1_v, p1_v));
+        _mm256_storeu_ps(&outIm[b], _mm256_mul_ps(_mm256_loadu_ps(&sinW[b]), a0_v));
+        _mm256_storeu_ps(&outIm[b + 8u], _mm256_mul_ps(_mm256_loadu_ps(&sinW[b + 8u]), a1_v));
+        b += 16u;
+    }
+    for (; b < bins; b += 8u) {
+        __m256 c_v = _mm256_loadu_ps(&coeff[b]);
+        __m256 k_v = _mm256_add_ps(c_v, c_v);
+        __m256 a_v = _mm256_setzero_ps(), p_v = a_v;
+        for (uint32_t n = 0; n < length; ++n) {
+            __m256 t_v = _mm256_fmadd_ps(k_v, a_v, _mm256_sub_ps(_mm256_broadcast_ss(&in[n]), p_v));
+            p_v = a_v;
+            a_v = t_v;
+        }
+        _mm256_storeu_ps(&outRe[b], _mm256_fmsub_ps(c_v, a_v, p_v));
+        _mm256_storeu_ps(&outIm[b], _mm256_mul_ps(_mm256_loadu_ps(&sinW[b]), a_v));
+    }
+}
+
+void mc_shuffle_window_avx(float * restrict out, const float * restrict ring, const float * restrict window, 
+                           const uint16_t * restrict digitRev, uint32_t offset, uint32_t ringMask, uint32_t length) {
+    const __m256i offset_v = _mm256_set1_epi32((int32_t)offset);
+    const __m256i mask_v = _mm256_set1_epi32((int32_t)ringMask);
+    for (uint32_t i = 0; i < length; i += 8u) {
+        __m128i indices_u16 = _mm_loadu_si128((const __m128i *)&digitRev[i]);
+        __m256i indices = _mm256_cvtepu16_epi32(indices_u16);
+        __m256i ring_indices = _mm256_and_si256(_mm256_add_epi32(indices, offset_v), mask_v);
+        __m256 vals = _mm256_i32gather_ps(ring, ring_indices, 4);
+        __m256 win_vals = _mm256_i32gather_ps(window, indices, 4);
+        _mm256_storeu_ps(&out[i], _mm256_mul_ps(vals, win_vals));
+    }
+}
+
 static void st_rad2_mono_depth1_avx(float *re, float *im, uint32_t fftLength) {
     for (uint32_t stepIdx = 0; stepIdx < fftLength; stepIdx += 8u) {
         __m128 re0_v = _mm_loadu_ps(re);
@@ -95,6 +397,31 @@ void mc_fft_dif_mono_core_avx(float * restrict re, float * restrict im, const fl
     }
 }
 
+void mc_fft_dif_mono_range_avx(float * restrict re, float * restrict im, const float * restrict twiddle, uint32_t pow2,
+                                uint32_t firstStep, uint32_t lastStep) {
+    const uint32_t fftLength = 1u<<(pow2);
+    uint32_t step = fftLength;
+    /** Stages with step > firstStep are skipped along with their twiddle factors */
+    while ((step > firstStep) && (step > 16u)) {
+        twiddle += MC_TWIDDLE_STAGE_SIZE(step);
+        step >>= 2u;
+    }
+    while ((step > 16u) && (step > lastStep)) {
+        st_fft_dif_rad4_mono_loop_avx(re, im, twiddle, fftLength, step);
+        twiddle += MC_TWIDDLE_STAGE_SIZE(step);
+        step >>= 2u;
+    }
+    if (0 == lastStep) {
+        if (pow2 % 2u) {
+            st_fft_dif_rad4_mono_depth2_odd_avx(re, im, twiddle, fftLength);
+            st_rad2_mono_depth1_avx(re, im, fftLength);
+        } else {
+            st_fft_dif_rad4_mono_depth2_avx(re, im, twiddle, fftLength);
+            st_fft_rad4_mono_depth1_avx(re, im, fftLength);
+        }
+    }
+}
+
 void mc_ifft_dif_mono_core_avx(float * restrict re, float * restrict im, const float * restrict twiddle, uint32_t pow2) {
     const uint32_t fftLength = 1u<<(pow2);
     uint32_t step = fftLength;
@@ -162,4 +489,116 @@ void mc_ifft_dit_mono_core_avx(float * restrict re, float * restrict im, const f
     } while (step != fftLength);
 }
 
+void mc_fft_dif_multi_core_avx(float **re, float **im, uint32_t channels, const float * restrict twiddle, uint32_t pow2) {
+    const uint32_t fftLength = 1u<<(pow2);
+    uint32_t step = fftLength;
+    do {
+        for (uint32_t ch = 0; ch < channels; ++ch) {
+            st_fft_dif_rad4_mono_loop_avx(re[ch], im[ch], twiddle, fftLength, step);
+        }
+        twiddle += MC_TWIDDLE_STAGE_SIZE(step);
+        step >>= 2u;
+    } while (step > 16u);
+    for (uint32_t ch = 0; ch < channels; ++ch) {
+        if (pow2 % 2u) {
+            st_fft_dif_rad4_mono_depth2_odd_avx(re[ch], im[ch], twiddle, fftLength);
+            st_rad2_mono_depth1_avx(re[ch], im[ch], fftLength);
+        } else {
+            st_fft_dif_rad4_mono_depth2_avx(re[ch], im[ch], twiddle, fftLength);
+            st_fft_rad4_mono_depth1_avx(re[ch], im[ch], fftLength);
+        }
+    }
+}
 
+void mc_ifft_dif_multi_core_avx(float **re, float **im, uint32_t channels, const float * restrict twiddle, uint32_t pow2) {
+    const uint32_t fftLength = 1u<<(pow2);
+    uint32_t step = fftLength;
+    do {
+        for (uint32_t ch = 0; ch < channels; ++ch) {
+            st_ifft_dif_rad4_mono_loop_avx(re[ch], im[ch], twiddle, fftLength, step);
+        }
+        twiddle += MC_TWIDDLE_STAGE_SIZE(step);
+        step >>= 2u;
+    } while (step > 16u);
+    for (uint32_t ch = 0; ch < channels; ++ch) {
+        if (pow2 % 2u) {
+            st_ifft_dif_rad4_mono_depth2_odd_avx(re[ch], im[ch], twiddle, fftLength);
+            st_rad2_mono_depth1_avx(re[ch], im[ch], fftLength);
+        } else {
+            st_ifft_dif_rad4_mono_depth2_avx(re[ch], im[ch], twiddle, fftLength);
+            st_ifft_rad4_mono_depth1_avx(re[ch], im[ch], fftLength);
+        }
+    }
+}
+
+void mc_fft_dit_multi_core_avx(float **re, float **im, uint32_t channels, const float * restrict twiddle, uint32_t pow2) {
+    const uint32_t fftLength = 1u<<(pow2);
+    uint32_t step = (pow2 % 2u) ? 8u : 16u;
+    /* Shift pointer of twiddle factor to the end, more twiddle factors first for better memory alignement */
+    twiddle += MC_TWIDDLE_LENGTH(pow2);
+    twiddle -= MC_TWIDDLE_STAGE_SIZE(step);
+    /** The first stages are short and have a few twiddle factors: channel by channel */
+    for (uint32_t ch = 0; ch < channels; ++ch) {
+        if (pow2 % 2u) {
+            st_rad2_mono_depth1_avx(re[ch], im[ch], fftLength);
+            st_fft_dit_rad4_mono_depth2_odd_avx(re[ch], im[ch], twiddle, fftLength);
+        } else {
+            st_fft_rad4_mono_depth1_avx(re[ch], im[ch], fftLength);
+            st_fft_dit_rad4_mono_depth2_avx(re[ch], im[ch], twiddle, fftLength);
+        }
+    }
+    do {
+        step <<= 2u;
+        twiddle -= MC_TWIDDLE_STAGE_SIZE(step);
+        for (uint32_t ch = 0; ch < channels; ++ch) {
+            st_fft_dit_rad4_mono_loop_avx(re[ch], im[ch], twiddle, fftLength, step);
+        }
+    } while (step != fftLength);
+}
+
+void mc_ifft_dit_multi_core_avx(float **re, float **im, uint32_t channels, const float * restrict twiddle, uint32_t pow2) {
+    const uint32_t fftLength = 1u<<(pow2);
+    uint32_t step = (pow2 % 2u) ? 8u : 16u;
+    /* Shift pointer of twiddle factor to the end, more twiddle factors first for better memory alignement */
+    twiddle += MC_TWIDDLE_LENGTH(pow2);
+    twiddle -= MC_TWIDDLE_STAGE_SIZE(step);
+    /** The first stages are short and have a few twiddle factors: channel by channel */
+    for (uint32_t ch = 0; ch < channels; ++ch) {
+        if (pow2 % 2u) {
+            st_rad2_mono_depth1_avx(re[ch], im[ch], fftLength);
+            st_ifft_dit_rad4_mono_depth2_odd_avx(re[ch], im[ch], twiddle, fftLength);
+        } else {
+            st_ifft_rad4_mono_depth1_avx(re[ch], im[ch], fftLength);
+            st_ifft_dit_rad4_mono_depth2_avx(re[ch], im[ch], twiddle, fftLength);
+        }
+    }
+    do {
+        step <<= 2u;
+        twiddle -= MC_TWIDDLE_STAGE_SIZE(step);
+        for (uint32_t ch = 0; ch < channels; ++ch) {
+            st_ifft_dit_rad4_mono_loop_avx(re[ch], im[ch], twiddle, fftLength, step);
+        }
+    } while (step != fftLength);
+}
+
+void mc_get_cpu_id_avx(char *out, uint32_t length) {
+    /** CPU brand string: 3 x CPUID leafs (0x80000002..0x80000004) x 16 bytes */
+    uint32_t brand[13] = {0};
+    MC_NULLPTR_ASSERT(out);
+#if defined(_MSC_VER)
+    int regs[4];
+    __cpuid(regs, 0x80000000);
+    if ((uint32_t)regs[0] >= 0x80000004u) {
+        for (uint32_t i = 0; i < 3u; ++i) {
+            __cpuid((int*)&brand[4u*i], (int)(0x80000002u+i));
+        }
+    }
+#else
+    if (__get_cpuid_max(0x80000000u, NULL) >= 0x80000004u) {
+        for (uint32_t i = 0; i < 3u; ++i) {
+            __get_cpuid(0x80000002u+i, &brand[4u*i], &brand[4u*i+1u], &brand[4u*i+2u], &brand[4u*i+3u]);
+        }
+    }
+#endif
+    snprintf(out, length, "avx:%s", (const char*)brand);
+}
@@ -34,10 +34,56 @@ extern "C" {
 
 void mc_shuffle_mono_avx(float * restrict re, float * restrict im, float * restrict buffer, 
                          const uint16_t * restrict digitRev,  uint32_t length);
+void mc_transpose_tile_avx(float * restrict out, const float * restrict in, uint32_t inStride, uint32_t outStride, uint32_t rows);
+void mc_fft_columns_avx(float * restrict re, float * restrict im, const float * restrict twiddle, 
+                        const uint16_t * restrict bitRev, uint32_t stride, uint32_t pow2, uint32_t columns);
+void mc_gather_signed_avx(float * restrict out, const float * restrict in, const uint16_t * restrict index, uint32_t length);
+void mc_mdct_fold_avx(float * restrict re, float * restrict im, const float * restrict in, const float * restrict coeff, 
+                      const uint32_t * restrict offset, uint32_t length);
+void mc_mdct_unfold_avx(float * restrict out, const float * restrict re, const float * restrict im, 
+                        const float * restrict rotation, uint32_t length);
+void mc_mdct_overlap_avx(float * restrict out, float * restrict overlap, const float * restrict in, 
+                         const float * restrict window, uint32_t length);
+void mc_polyphase_mac_avx(float * restrict outRe, float * restrict outIm, const float * restrict re, const float * restrict im, 
+                          const float * restrict coeff, uint32_t stride, uint32_t length, uint32_t taps);
+void mc_goertzel_avx(float * restrict outRe, float * restrict outIm, const float * restrict in, 
+                     const float * restrict coeff, uint32_t length, uint32_t bins);
+void mc_shuffle_window_avx(float * restrict out, const float * restrict ring, const float * restrict window, 
+                           const uint16_t * restrict digitRev, uint32_t offset, uint32_t ringMask, uint32_t length);
 void mc_fft_dit_mono_core_avx(float * restrict re, float * restrict im, const float * restrict twiddle, uint32_t pow2);
 void mc_ifft_dit_mono_core_avx(float * restrict re, float * restrict im, const float * restrict twiddle, uint32_t pow2);
 void mc_fft_dif_mono_core_avx(float * restrict re, float * restrict im, const float * restrict twiddle, uint32_t pow2);
+void mc_fft_dif_mono_range_avx(float * restrict re, float * restrict im, const float * restrict twiddle, uint32_t pow2,
+                                uint32_t firstStep, uint32_t lastStep);
 void mc_ifft_dif_mono_core_avx(float * restrict re, float * restrict im, const float * restrict twiddle, uint32_t pow2);
+void mc_fft_dif_multi_core_avx(float **re, float **im, uint32_t channels, const float * restrict twiddle, uint32_t pow2);
+void mc_ifft_dif_multi_core_avx(float **re, float **im, uint32_t channels, const float * restrict twiddle, uint32_t pow2);
+void mc_fft_dit_multi_core_avx(float **re, float **im, uint32_t channels, const float * restrict twiddle, uint32_t pow2);
+void mc_ifft_dit_multi_core_avx(float **re, float **im, uint32_t channels, const float * restrict twiddle, uint32_t pow2);
+void mc_get_cpu_id_avx(char *out, uint32_t length);
+void mc_spectrum_mul_avx(float * restrict re, float * restrict im, 
+                         const float * restrict hRe, const float * restrict hIm, uint32_t length);
+void mc_spectrum_mac_avx(float * restrict accRe, float * restrict accIm, const float * restrict re, const float * restrict im, 
+                         const float * restrict hRe, const float * restrict hIm, uint32_t length);
+void mc_spectrum_xcorr_avx(float * restrict cRe, float * restrict cIm, const float * restrict zRe, const float * restrict zIm,
+                           const uint16_t * restrict mirror, uint32_t length, uint32_t isPhat, float scale);
+uint32_t mc_max_index_avx(const float * restrict values, uint32_t length, float *maxValue);
+void mc_spectrum_power_avx(float * restrict out, const float * restrict re, const float * restrict im, uint32_t length);
+void mc_spectrum_dot_avx(float *outRe, float *outIm, const float * restrict re, const float * restrict im, 
+                        const float * restrict hRe, const float * restrict hIm, uint32_t length);
+void mc_spectrum_power_acc_avx(float * restrict acc, const float * restrict re, const float * restrict im, uint32_t length);
+void mc_spectrum_magnitude_avx(float * restrict out, const float * restrict re, const float * restrict im, uint32_t length);
+void mc_spectrum_log_power_avx(float * restrict out, const float * restrict re, const float * restrict im, uint32_t length);
+void mc_spectrum_phase_avx(float * restrict out, const float * restrict re, const float * restrict im, uint32_t length);
+void mc_shuffle_power_avx(float * restrict out, const float * restrict re, const float * restrict im, 
+                          const uint16_t * restrict digitRev, uint32_t length);
+void mc_spectrum_sdft_rotate_avx(float * restrict re, float * restrict im, const float * restrict wRe, const float * restrict wIm, 
+                                 float delta, uint32_t length);
+void mc_spectrum_sdft_modulate_avx(float * restrict re, float * restrict im, const float * restrict wRe, const float * restrict wIm, 
+                                   float delta, uint32_t first, uint32_t step, uint32_t mask, uint32_t length);
+void mc_spectrum_sdft_demodulate_avx(float * restrict outRe, float * restrict outIm, const float * restrict re, const float * restrict im, 
+                                     const float * restrict wRe, const float * restrict wIm, 
+                                     uint32_t first, uint32_t step, uint32_t mask, uint32_t length);
 
 #ifdef __cplusplus
 }
@@ -276,10 +276,18 @@ static void MC_FUNC_TEMPLATE(MC_FFT_DIRECTION, dit_rad4_mono_loop, avx)(float *r
         for (uint32_t i = 0; i < qStep; i += 8u) {
             __m256 twdB_vRe = _mm256_loadu_ps(twd);
             __m256 twdB_vIm = _mm256_loadu_ps(twd+8u);
+#if MC_COMPACT_TWIDDLE
+            /* 2*angle & 3*angle are derived from angle */
+            __m256 twdC_vRe = _mm256_fmsub_ps(twdB_vRe, twdB_vRe, _mm256_mul_ps(twdB_vIm, twdB_vIm));
+            __m256 twdC_vIm = _mm256_mul_ps(_mm256_add_ps(twdB_vRe, twdB_vRe), twdB_vIm);
+            __m256 twdD_vRe = _mm256_fmsub_ps(twdC_vRe, twdB_vRe, _mm256_mul_ps(twdC_vIm, twdB_vIm));
+            __m256 twdD_vIm = _mm256_fmadd_ps(twdC_vRe, twdB_vIm, _mm256_mul_ps(twdC_vIm, twdB_vRe));
+#else
             __m256 twdC_vRe = _mm256_loadu_ps(twd+16u);
             __m256 twdC_vIm = _mm256_loadu_ps(twd+24u);
             __m256 twdD_vRe = _mm256_loadu_ps(twd+32u);
             __m256 twdD_vIm = _mm256_loadu_ps(twd+40u);
+#endif
 
             __m256 re_v0 = _mm256_loadu_ps(aRe);
             __m256 re_v1 = _mm256_loadu_ps(bRe);
@@ -360,7 +368,7 @@ static void MC_FUNC_TEMPLATE(MC_FFT_DIRECTION, dit_rad4_mono_loop, avx)(float *r
             bIm += 8u;
             cIm += 8u;
             dIm += 8u;
-            twd += 48u;
+            twd += MC_TWIDDLE_BLOCK_SIZE;
         }
         aRe += 3u*qStep;
         aIm += 3u*qStep;
@@ -583,10 +591,18 @@ static void MC_FUNC_TEMPLATE(MC_FFT_DIRECTION, dif_rad4_mono_loop, avx)(float *r
         for (uint32_t i = 0; i < qStep; i += 8u) {
             __m256 twdB_vRe = _mm256_loadu_ps(twd);
             __m256 twdB_vIm = _mm256_loadu_ps(twd+8u);
+#if MC_COMPACT_TWIDDLE
+            /* 2*angle & 3*angle are derived from angle */
+            __m256 twdC_vRe = _mm256_fmsub_ps(twdB_vRe, twdB_vRe, _mm256_mul_ps(twdB_vIm, twdB_vIm));
+            __m256 twdC_vIm = _mm256_mul_ps(_mm256_add_ps(twdB_vRe, twdB_vRe), twdB_vIm);
+            __m256 twdD_vRe = _mm256_fmsub_ps(twdC_vRe, twdB_vRe, _mm256_mul_ps(twdC_vIm, twdB_vIm));
+            __m256 twdD_vIm = _mm256_fmadd_ps(twdC_vRe, twdB_vIm, _mm256_mul_ps(twdC_vIm, twdB_vRe));
+#else
             __m256 twdC_vRe = _mm256_loadu_ps(twd+16u);
             __m256 twdC_vIm = _mm256_loadu_ps(twd+24u);
             __m256 twdD_vRe = _mm256_loadu_ps(twd+32u);
             __m256 twdD_vIm = _mm256_loadu_ps(twd+40u);
+#endif
 
             __m256 re_v0 = _mm256_loadu_ps(aRe);
             __m256 re_v1 = _mm256_loadu_ps(bRe);
@@ -665,7 +681,7 @@ static void MC_FUNC_TEMPLATE(MC_FFT_DIRECTION, dif_rad4_mono_loop, avx)(float *r
             bIm += 8u;
             cIm += 8u;
             dIm += 8u;
-            twd += 48u;
+            twd += MC_TWIDDLE_BLOCK_SIZE;
         }
         aRe += 3u*qStep;
         aIm += 3u*qStep;
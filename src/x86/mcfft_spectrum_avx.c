@@ -0,0 +1,298 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <immintrin.h>
+#include "mcfft_avx.h"
+#include "generic/mcfft_generic.h"
+#include <float.h>
+
+void mc_spectrum_mul_avx(float * restrict re, float * restrict im, 
+                         const float * restrict hRe, const float * restrict hIm, uint32_t length) {
+    for (uint32_t i = 0; i < length; i += 8u) {
+        __m256 re_v = _mm256_loadu_ps(&re[i]);
+        __m256 im_v = _mm256_loadu_ps(&im[i]);
+        __m256 hRe_v = _mm256_loadu_ps(&hRe[i]);
+        __m256 hIm_v = _mm256_loadu_ps(&hIm[i]);
+        __m256 accRe_v = _mm256_fmsub_ps(re_v, hRe_v, _mm256_mul_ps(im_v, hIm_v));
+        __m256 accIm_v = _mm256_fmadd_ps(re_v, hIm_v, _mm256_mul_ps(im_v, hRe_v));
+        _mm256_storeu_ps(&re[i], accRe_v);
+        _mm256_storeu_ps(&im[i], accIm_v);
+    }
+}
+
+void mc_spectrum_mac_avx(float * restrict accRe, float * restrict accIm, const float * restrict re, const float * restrict im, 
+                         const float * restrict hRe, const float * restrict hIm, uint32_t length) {
+    for (uint32_t i = 0; i < length; i += 8u) {
+        __m256 re_v = _mm256_loadu_ps(&re[i]);
+        __m256 im_v = _mm256_loadu_ps(&im[i]);
+        __m256 hRe_v = _mm256_loadu_ps(&hRe[i]);
+        __m256 hIm_v = _mm256_loadu_ps(&hIm[i]);
+        __m256 accRe_v = _mm256_fmadd_ps(re_v, hRe_v, _mm256_loadu_ps(&accRe[i]));
+        __m256 accIm_v = _mm256_fmadd_ps(re_v, hIm_v, _mm256_loadu_ps(&accIm[i]));
+        accRe_v = _mm256_fnmadd_ps(im_v, hIm_v, accRe_v);
+        accIm_v = _mm256_fmadd_ps(im_v, hRe_v, accIm_v);
+        _mm256_storeu_ps(&accRe[i], accRe_v);
+        _mm256_storeu_ps(&accIm[i], accIm_v);
+    }
+}
+
+void mc_spectrum_xcorr_avx(float * restrict cRe, float * restrict cIm, const float * restrict zRe, const float * restrict zIm,
+                           const uint16_t * restrict mirror, uint32_t length, uint32_t isPhat, float scale) {
+    const __m256 half_v = _mm256_set1_ps(0.5f);
+    const __m256 quarter_v = _mm256_set1_ps(0.25f);
+    const __m256 three_v = _mm256_set1_ps(3.f);
+    const __m256 eps_v = _mm256_set1_ps(MC_SPECTRUM_PHAT_EPSILON);
+    const __m256 scale_v = _mm256_set1_ps(scale);
+    for (uint32_t i = 0; i < length; i += 8u) {
+        __m256i indices = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)&mirror[i]));
+        __m256 mRe_v = _mm256_i32gather_ps(zRe, indices, 4);
+        __m256 mIm_v = _mm256_i32gather_ps(zIm, indices, 4);
+        __m256 re_v = _mm256_loadu_ps(&zRe[i]);
+        __m256 im_v = _mm256_loadu_ps(&zIm[i]);
+        __m256 accRe_v = _mm256_mul_ps(half_v, _mm256_fmadd_ps(re_v, mIm_v, _mm256_mul_ps(im_v, mRe_v)));
+        __m256 pow_v = _mm256_fmadd_ps(re_v, re_v, _mm256_mul_ps(im_v, im_v));
+        __m256 mPow_v = _mm256_fmadd_ps(mRe_v, mRe_v, _mm256_mul_ps(mIm_v, mIm_v));
+        __m256 accIm_v = _mm256_mul_ps(quarter_v, _mm256_sub_ps(pow_v, mPow_v));
+        __m256 gain_v = scale_v;
+        if (isPhat) {
+            /** rsqrt (12 bits) + one Newton-Raphson step: y = 0.5*y*(3 - x*y*y) */
+            __m256 mag2_v = _mm256_fmadd_ps(accRe_v, accRe_v, _mm256_fmadd_ps(accIm_v, accIm_v, eps_v));
+            __m256 y_v = _mm256_rsqrt_ps(mag2_v);
+            y_v = _mm256_mul_ps(_mm256_mul_ps(half_v, y_v), _mm256_fnmadd_ps(_mm256_mul_ps(mag2_v, y_v), y_v, three_v));
+            gain_v = _mm256_mul_ps(gain_v, y_v);
+        }
+        _mm256_storeu_ps(&cRe[i], _mm256_mul_ps(accRe_v, gain_v));
+        _mm256_storeu_ps(&cIm[i], _mm256_mul_ps(accIm_v, gain_v));
+    }
+}
+
+uint32_t mc_max_index_avx(const float * restrict values, uint32_t length, float *maxValue) {
+    uint32_t i = 0;
+    float maxScalar = values[0];
+    if (length >= 8u) {
+        __m256 max_v = _mm256_loadu_ps(values);
+        for (i = 8u; (i + 8u) <= length; i += 8u) {
+            max_v = _mm256_max_ps(max_v, _mm256_loadu_ps(&values[i]));
+        }
+        __m128 max4_v = _mm_max_ps(_mm256_castps256_ps128(max_v), _mm256_extractf128_ps(max_v, 1));
+        max4_v = _mm_max_ps(max4_v, _mm_movehl_ps(max4_v, max4_v));
+        max4_v = _mm_max_ss(max4_v, _mm_shuffle_ps(max4_v, max4_v, _MM_SHUFFLE(1, 1, 1, 1)));
+        maxScalar = _mm_cvtss_f32(max4_v);
+    }
+    for (; i < length; ++i) {
+        maxScalar = (values[i] > maxScalar) ? values[i] : maxScalar;
+    }
+    /** The first index of max value (NOTE: NaNs are not supported) */
+    const __m256 target_v = _mm256_set1_ps(maxScalar);
+    for (i = 0; (i + 8u) <= length; i += 8u) {
+        int mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(&values[i]), target_v, _CMP_EQ_OQ));
+        if (0 != mask) {
+            uint32_t lane = 0;
+            while (0 == (mask & (1 << lane))) {
+                ++lane;
+            }
+            *maxValue = maxScalar;
+            return i + lane;
+        }
+    }
+    for (; (i < length) && (values[i] != maxScalar); ++i) {}
+    *maxValue = maxScalar;
+    return i;
+}
+
+static inline __m256 st_spectrum_log_power_avx(__m256 power_v) {
+    /** x = 2^e * m, m in [sqrt(0.5), sqrt(2)): ln(m) = 2*atanh(t), t = (m-1)/(m+1) (see mcfft_spectrum_generic.c) */
+    const __m256 one_v = _mm256_set1_ps(1.f);
+    __m256i bits_v = _mm256_castps_si256(_mm256_max_ps(power_v, _mm256_set1_ps(MC_SPECTRUM_POWER_FLOOR)));
+    __m256i e_v = _mm256_sub_epi32(bits_v, _mm256_set1_epi32((int32_t)MC_SPECTRUM_SQRT_HALF_BITS));
+    __m256 m_v = _mm256_castsi256_ps(_mm256_sub_epi32(bits_v, _mm256_and_si256(e_v, _mm256_set1_epi32((int32_t)0xFF800000u))));
+    __m256 t_v = _mm256_div_ps(_mm256_sub_ps(m_v, one_v), _mm256_add_ps(m_v, one_v));
+    __m256 t2_v = _mm256_mul_ps(t_v, t_v);
+    __m256 poly_v = _mm256_fmadd_ps(t2_v, _mm256_set1_ps(1.f/7.f), _mm256_set1_ps(1.f/5.f));
+    poly_v = _mm256_fmadd_ps(t2_v, poly_v, _mm256_set1_ps(1.f/3.f));
+    poly_v = _mm256_fmadd_ps(t2_v, poly_v, one_v);
+    __m256 lnm_v = _mm256_mul_ps(_mm256_add_ps(t_v, t_v), poly_v);
+    __m256 ln_v = _mm256_fmadd_ps(_mm256_cvtepi32_ps(_mm256_srai_epi32(e_v, 23)), _mm256_set1_ps(MC_SPECTRUM_LN2), lnm_v);
+    return _mm256_mul_ps(ln_v, _mm256_set1_ps(MC_SPECTRUM_DB_PER_LN));
+}
+
+static inline __m256 st_spectrum_phase_avx(__m256 re_v, __m256 im_v) {
+    const __m256 sign_v = _mm256_set1_ps(-0.f);
+    __m256 absRe_v = _mm256_andnot_ps(sign_v, re_v);
+    __m256 absIm_v = _mm256_andnot_ps(sign_v, im_v);
+    __m256 a_v = _mm256_div_ps(_mm256_min_ps(absRe_v, absIm_v), 
+                               _mm256_add_ps(_mm256_max_ps(absRe_v, absIm_v), _mm256_set1_ps(FLT_MIN)));
+    __m256 s_v = _mm256_mul_ps(a_v, a_v);
+    __m256 phase_v = _mm256_fmadd_ps(s_v, _mm256_set1_ps(MC_SPECTRUM_ATAN_C11), _mm256_set1_ps(MC_SPECTRUM_ATAN_C9));
+    phase_v = _mm256_fmadd_ps(s_v, phase_v, _mm256_set1_ps(MC_SPECTRUM_ATAN_C7));
+    phase_v = _mm256_fmadd_ps(s_v, phase_v, _mm256_set1_ps(MC_SPECTRUM_ATAN_C5));
+    phase_v = _mm256_fmadd_ps(s_v, phase_v, _mm256_set1_ps(MC_SPECTRUM_ATAN_C3));
+    phase_v = _mm256_fmadd_ps(s_v, phase_v, _mm256_set1_ps(MC_SPECTRUM_ATAN_C1));
+    phase_v = _mm256_mul_ps(a_v, phase_v);
+    phase_v = _mm256_blendv_ps(phase_v, _mm256_sub_ps(_mm256_set1_ps(MC_SPECTRUM_HALF_PI), phase_v), 
+                               _mm256_cmp_ps(absIm_v, absRe_v, _CMP_GT_OQ));
+    /** Sign bits (including -0) are used as in atan2(): blendv selects by sign bit of Re */
+    phase_v = _mm256_blendv_ps(phase_v, _mm256_sub_ps(_mm256_set1_ps(MC_SPECTRUM_PI), phase_v), re_v);
+    return _mm256_xor_ps(phase_v, _mm256_and_ps(im_v, sign_v));
+}
+
+void mc_spectrum_power_avx(float * restrict out, const float * restrict re, const float * restrict im, uint32_t length) {
+    uint32_t i = 0;
+    for (; (i + 8u) <= length; i += 8u) {
+        __m256 re_v = _mm256_loadu_ps(&re[i]);
+        __m256 im_v = _mm256_loadu_ps(&im[i]);
+        _mm256_storeu_ps(&out[i], _mm256_fmadd_ps(re_v, re_v, _mm256_mul_ps(im_v, im_v)));
+    }
+    mc_spectrum_power_g(&out[i], &re[i], &im[i], length - i);
+}
+
+void mc_spectrum_dot_avx(float *outRe, float *outIm, const float * restrict re, const float * restrict im, 
+                         const float * restrict hRe, const float * restrict hIm, uint32_t length) {
+    __m256 accRe_v = _mm256_setzero_ps();
+    __m256 accIm_v = _mm256_setzero_ps();
+    uint32_t i = 0;
+    for (; (i + 8u) <= length; i += 8u) {
+        __m256 re_v = _mm256_loadu_ps(&re[i]);
+        __m256 im_v = _mm256_loadu_ps(&im[i]);
+        __m256 hRe_v = _mm256_loadu_ps(&hRe[i]);
+        __m256 hIm_v = _mm256_loadu_ps(&hIm[i]);
+        accRe_v = _mm256_fmadd_ps(re_v, hRe_v, accRe_v);
+        accRe_v = _mm256_fnmadd_ps(im_v, hIm_v, accRe_v);
+        accIm_v = _mm256_fmadd_ps(re_v, hIm_v, accIm_v);
+        accIm_v = _mm256_fmadd_ps(im_v, hRe_v, accIm_v);
+    }
+    float tailRe, tailIm;
+    mc_spectrum_dot_g(&tailRe, &tailIm, &re[i], &im[i], &hRe[i], &hIm[i], length - i);
+    /** Horizontal sums */
+    __m128 sumRe_v = _mm_add_ps(_mm256_castps256_ps128(accRe_v), _mm256_extractf128_ps(accRe_v, 1));
+    __m128 sumIm_v = _mm_add_ps(_mm256_castps256_ps128(accIm_v), _mm256_extractf128_ps(accIm_v, 1));
+    sumRe_v = _mm_hadd_ps(sumRe_v, sumIm_v);
+    sumRe_v = _mm_hadd_ps(sumRe_v, sumRe_v);
+    *outRe = _mm_cvtss_f32(sumRe_v) + tailRe;
+    *outIm = _mm_cvtss_f32(_mm_shuffle_ps(sumRe_v, sumRe_v, _MM_SHUFFLE(1, 1, 1, 1))) + tailIm;
+}
+
+void mc_spectrum_power_acc_avx(float * restrict acc, const float * restrict re, const float * restrict im, uint32_t length) {
+    uint32_t i = 0;
+    for (; (i + 8u) <= length; i += 8u) {
+        __m256 re_v = _mm256_loadu_ps(&re[i]);
+        __m256 im_v = _mm256_loadu_ps(&im[i]);
+        __m256 acc_v = _mm256_fmadd_ps(re_v, re_v, _mm256_loadu_ps(&acc[i]));
+        _mm256_storeu_ps(&acc[i], _mm256_fmadd_ps(im_v, im_v, acc_v));
+    }
+    mc_spectrum_power_acc_g(&acc[i], &re[i], &im[i], length - i);
+}
+
+void mc_spectrum_magnitude_avx(float * restrict out, const float * restrict re, const float * restrict im, uint32_t length) {
+    uint32_t i = 0;
+    for (; (i + 8u) <= length; i += 8u) {
+        __m256 re_v = _mm256_loadu_ps(&re[i]);
+        __m256 im_v = _mm256_loadu_ps(&im[i]);
+        _mm256_storeu_ps(&out[i], _mm256_sqrt_ps(_mm256_fmadd_ps(re_v, re_v, _mm256_mul_ps(im_v, im_v))));
+    }
+    mc_spectrum_magnitude_g(&out[i], &re[i], &im[i], length - i);
+}
+
+void mc_spectrum_log_power_avx(float * restrict out, const float * restrict re, const float * restrict im, uint32_t length) {
+    uint32_t i = 0;
+    for (; (i + 8u) <= length; i += 8u) {
+        __m256 re_v = _mm256_loadu_ps(&re[i]);
+        __m256 im_v = _mm256_loadu_ps(&im[i]);
+        _mm256_storeu_ps(&out[i], st_spectrum_log_power_avx(_mm256_fmadd_ps(re_v, re_v, _mm256_mul_ps(im_v, im_v))));
+    }
+    mc_spectrum_log_power_g(&out[i], &re[i], &im[i], length - i);
+}
+
+void mc_spectrum_phase_avx(float * restrict out, const float * restrict re, const float * restrict im, uint32_t length) {
+    uint32_t i = 0;
+    for (; (i + 8u) <= length; i += 8u) {
+        _mm256_storeu_ps(&out[i], st_spectrum_phase_avx(_mm256_loadu_ps(&re[i]), _mm256_loadu_ps(&im[i])));
+    }
+    mc_spectrum_phase_g(&out[i], &re[i], &im[i], length - i);
+}
+
+void mc_shuffle_power_avx(float * restrict out, const float * restrict re, const float * restrict im, 
+                          const uint16_t * restrict digitRev, uint32_t length) {
+    for (uint32_t i = 0; i < length; i += 8u) {
+        __m256i indices = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)&digitRev[i]));
+        __m256 re_v = _mm256_i32gather_ps(re, indices, 4);
+        __m256 im_v = _mm256_i32gather_ps(im, indices, 4);
+        _mm256_storeu_ps(&out[i], _mm256_fmadd_ps(re_v, re_v, _mm256_mul_ps(im_v, im_v)));
+    }
+}
+
+void mc_spectrum_sdft_rotate_avx(float * restrict re, float * restrict im, const float * restrict wRe, const float * restrict wIm, 
+                                 float delta, uint32_t length) {
+    const __m256 delta_v = _mm256_set1_ps(delta);
+    uint32_t i = 0;
+    for (; (i + 8u) <= length; i += 8u) {
+        __m256 re_v = _mm256_add_ps(_mm256_loadu_ps(&re[i]), delta_v);
+        __m256 im_v = _mm256_loadu_ps(&im[i]);
+        __m256 wRe_v = _mm256_loadu_ps(&wRe[i]);
+        __m256 wIm_v = _mm256_loadu_ps(&wIm[i]);
+        _mm256_storeu_ps(&re[i], _mm256_fmadd_ps(re_v, wRe_v, _mm256_mul_ps(im_v, wIm_v)));
+        _mm256_storeu_ps(&im[i], _mm256_fmsub_ps(im_v, wRe_v, _mm256_mul_ps(re_v, wIm_v)));
+    }
+    mc_spectrum_sdft_rotate_g(&re[i], &im[i], &wRe[i], &wIm[i], delta, length - i);
+}
+
+void mc_spectrum_sdft_modulate_avx(float * restrict re, float * restrict im, const float * restrict wRe, const float * restrict wIm, 
+                                   float delta, uint32_t first, uint32_t step, uint32_t mask, uint32_t length) {
+    const __m256 delta_v = _mm256_set1_ps(delta);
+    const __m256i mask_v = _mm256_set1_epi32((int32_t)mask);
+    const __m256i step_v = _mm256_set1_epi32((int32_t)((step<<3u) & mask));
+    __m256i idx_v = _mm256_and_si256(_mm256_add_epi32(_mm256_set1_epi32((int32_t)first), 
+                                     _mm256_mullo_epi32(_mm256_set1_epi32((int32_t)step), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7))), 
+                                     mask_v);
+    uint32_t i = 0;
+    for (; (i + 8u) <= length; i += 8u) {
+        __m256 wRe_v = _mm256_i32gather_ps(wRe, idx_v, 4);
+        __m256 wIm_v = _mm256_i32gather_ps(wIm, idx_v, 4);
+        _mm256_storeu_ps(&re[i], _mm256_fmadd_ps(delta_v, wRe_v, _mm256_loadu_ps(&re[i])));
+        _mm256_storeu_ps(&im[i], _mm256_fmadd_ps(delta_v, wIm_v, _mm256_loadu_ps(&im[i])));
+        idx_v = _mm256_and_si256(_mm256_add_epi32(idx_v, step_v), mask_v);
+    }
+    mc_spectrum_sdft_modulate_g(&re[i], &im[i], wRe, wIm, delta, (first + i*step) & mask, step, mask, length - i);
+}
+
+void mc_spectrum_sdft_demodulate_avx(float * restrict outRe, float * restrict outIm, const float * restrict re, const float * restrict im, 
+                                     const float * restrict wRe, const float * restrict wIm, 
+                                     uint32_t first, uint32_t step, uint32_t mask, uint32_t length) {
+    const __m256i mask_v = _mm256_set1_epi32((int32_t)mask);
+    const __m256i step_v = _mm256_set1_epi32((int32_t)((step<<3u) & mask));
+    __m256i idx_v = _mm256_and_si256(_mm256_add_epi32(_mm256_set1_epi32((int32_t)first), 
+                                     _mm256_mullo_epi32(_mm256_set1_epi32((int32_t)step), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7))), 
+                                     mask_v);
+    uint32_t i = 0;
+    for (; (i + 8u) <= length; i += 8u) {
+        __m256 re_v = _mm256_loadu_ps(&re[i]);
+        __m256 im_v = _mm256_loadu_ps(&im[i]);
+        __m256 wRe_v = _mm256_i32gather_ps(wRe, idx_v, 4);
+        __m256 wIm_v = _mm256_i32gather_ps(wIm, idx_v, 4);
+        _mm256_storeu_ps(&outRe[i], _mm256_fmadd_ps(re_v, wRe_v, _mm256_mul_ps(im_v, wIm_v)));
+        _mm256_storeu_ps(&outIm[i], _mm256_fmsub_ps(im_v, wRe_v, _mm256_mul_ps(re_v, wIm_v)));
+        idx_v = _mm256_and_si256(_mm256_add_epi32(idx_v, step_v), mask_v);
+    }
+    mc_spectrum_sdft_demodulate_g(&outRe[i], &outIm[i], &re[i], &im[i], wRe, wIm, (first + i*step) & mask, step, mask, length - i);
+}
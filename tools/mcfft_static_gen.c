@@ -0,0 +1,95 @@
+/**
+ * MIT License
+ * 
+ * Copyright (c) 2025 Georgii Zagoruiko
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/** Generator of static FFT tables (see src/mcfft_static.h)
+ *
+ * Usage: mcfft_static_gen <output header> <power2> [<power2> ...]
+ *
+ * Tables are calculated by the library itself (mc_fft_get_twiddle()/mc_fft_get_digitRev())
+ * and printed as hex-float initializers, so static tables are bit-exact with runtime ones.
+ * NOTE: generator must be built with the same MC_COMPACT_TWIDDLE as code which uses generated tables
+ */
+
+#include "mcfft.h"
+#include <stdio.h>
+
+#define MC_GEN_VALUES_PER_LINE (8u)
+
+static float st_twiddle[MC_TWIDDLE_LENGTH(14u)];
+static uint32_t st_digitRev[MC_DIGIT_LENGTH(14u)];
+
+MC_STATIC_ASSERT(MC_MAX_FFT_LENGTH == (1u<<14u));
+
+static void st_print_twiddle(FILE *out, uint32_t power2) {
+    uint32_t length = MC_TWIDDLE_LENGTH(power2);
+    mc_fft_get_twiddle(st_twiddle, length, power2);
+    fprintf(out, "#define MC_FFT_STATIC_TWIDDLE_%u { \\\n", (unsigned)power2);
+    for (uint32_t i = 0; i < length; ++i) {
+        fprintf(out, "%s%af%s", ((i % MC_GEN_VALUES_PER_LINE) == 0) ? "    " : " ", (double)st_twiddle[i],
+                (i+1u == length) ? " \\\n" : ((((i+1u) % MC_GEN_VALUES_PER_LINE) == 0) ? ", \\\n" : ","));
+    }
+    fprintf(out, "}\n\n");
+}
+
+static void st_print_digitRev(FILE *out, uint32_t power2) {
+    /** Digit reverse map is stored as uint16_t (DIT map followed by DIF map) */
+    const uint16_t *map = (const uint16_t*)st_digitRev;
+    uint32_t length = 2u*MC_DIGIT_LENGTH(power2);
+    mc_fft_get_digitRev(st_digitRev, MC_DIGIT_LENGTH(power2), power2);
+    fprintf(out, "#define MC_FFT_STATIC_DIGIT_%u { \\\n", (unsigned)power2);
+    for (uint32_t i = 0; i < length; ++i) {
+        fprintf(out, "%s%uu%s", ((i % MC_GEN_VALUES_PER_LINE) == 0) ? "    " : " ", (unsigned)map[i],
+                (i+1u == length) ? " \\\n" : ((((i+1u) % MC_GEN_VALUES_PER_LINE) == 0) ? ", \\\n" : ","));
+    }
+    fprintf(out, "}\n\n");
+}
+
+int main(int argc, char **argv) {
+    FILE *out = NULL;
+    if (argc < 3) {
+        fprintf(stderr, "Usage: %s <output header> <power2> [<power2> ...]\n", argv[0]);
+        return 1;
+    }
+    out = fopen(argv[1], "w");
+    if (NULL == out) {
+        fprintf(stderr, "Can't open %s\n", argv[1]);
+        return 1;
+    }
+    fprintf(out, "/** Generated by mcfft_static_gen: DO NOT EDIT */\n\n");
+    fprintf(out, "#ifndef MC_FFT_STATIC_TABLES_H\n#define MC_FFT_STATIC_TABLES_H\n\n");
+    fprintf(out, "#define MC_FFT_STATIC_COMPACT_TWIDDLE (%u)\n\n", (unsigned)MC_COMPACT_TWIDDLE);
+    for (int i = 2; i < argc; ++i) {
+        uint32_t power2 = (uint32_t)strtoul(argv[i], NULL, 10);
+        if ((power2 > 14u) || ((1u<<power2) < MC_MIN_FFT_LENGTH)) {
+            fprintf(stderr, "Power of 2 is out of range: %s\n", argv[i]);
+            fclose(out);
+            return 1;
+        }
+        st_print_twiddle(out, power2);
+        st_print_digitRev(out, power2);
+    }
+    fprintf(out, "#endif /* MC_FFT_STATIC_TABLES_H */\n");
+    fclose(out);
+    return 0;
+}
@@ -17,6 +17,9 @@
 #include <unistd.h>
 
 #include "pffft.h"
+#include "mcfft_thread.h"
+#include "mcfft_parallel.h"
+#include "mcfft_transpose.h"
 
 #define MC_TEST_ZEROS_CHECK(array, threshold) { \
     float zero_array_tmp123[MC_ARRAY_LENGTH((array))]; \
@@ -29,7 +32,7 @@
 #define MC_TEST_BENCH_CYCLES (500u)
 #define MC_TEST_BATCH_SIZE   (50u)
 /* Max power of 2 to test */
-#define MC_TEST_FFT_POW2 (10u)
+#define MC_TEST_FFT_POW2 (14u)
 #define MC_TEST_FFT_LEN (1u << MC_TEST_FFT_POW2)
 
 static void cmocka_fft_benchmark(uint32_t power2) {
@@ -207,6 +210,108 @@ static void cmocka_fft_benchmark_1024(void **state) {
     cmocka_fft_benchmark(10);
 }
 
+/* Twiddle tables exceed L1 (see FORCE_COMPACT_TWIDDLE option) */
+static void cmocka_fft_benchmark_4096(void **state) {
+    (void)state;
+    cmocka_fft_benchmark(12);
+}
+
+/* Twiddle tables exceed L1/L2 on small cores (see FORCE_COMPACT_TWIDDLE option) */
+static void cmocka_fft_benchmark_16384(void **state) {
+    (void)state;
+    cmocka_fft_benchmark(14);
+}
+
+#define MC_TEST_PARALLEL_POW2    (18u)
+#define MC_TEST_PARALLEL_CYCLES  (20u)
+#define MC_TEST_PARALLEL_THREADS (16u)
+
+/* Scaling of single large FFT over threads (speedup is bounded by physical cores) */
+static void cmocka_fft_parallel_benchmark(void **state) {
+    const uint32_t fftLength = 1u<<MC_TEST_PARALLEL_POW2;
+    float *re = (float*)malloc(2u*sizeof(float)*fftLength);
+    float *im = &re[fftLength];
+    struct timespec tms;
+    uint64_t startNs = 0, endNs = 0, singleNs = 0;
+    (void)state;
+    assert_non_null(re);
+    memset(re, 0, 2u*sizeof(float)*fftLength);
+    mc_test_add_sinwave(re, fftLength, 0.8f, 0.1f, MC_TEST_FS);
+    mc_test_add_sinwave(re, fftLength, 0.5f, 0.45f, MC_TEST_FS);
+
+    for (uint32_t threads = 1u; threads <= MC_TEST_PARALLEL_THREADS; threads <<= 1u) {
+        uint64_t minimalNs = (1ull<<63);
+        mc_thread_pool_t pool;
+        mc_fft_parallel_object_t fftObj;
+        mc_thread_pool_create(&pool, threads);
+        mc_fft_parallel_allocate(&fftObj, MC_TEST_PARALLEL_POW2, threads);
+        for (uint32_t c = 0; c < MC_TEST_PARALLEL_CYCLES; ++c) {
+            timespec_get(&tms, TIME_UTC);
+            startNs = (uint64_t)tms.tv_sec*1000000000ull + (uint64_t)tms.tv_nsec;
+            mc_fft_parallel(&fftObj.context, &pool, re, im, fftLength);
+            mc_ifft_parallel(&fftObj.context, &pool, re, im, fftLength);
+            mc_fft_norm(re, im, fftLength);
+            timespec_get(&tms, TIME_UTC);
+            endNs = (uint64_t)tms.tv_sec*1000000000ull + (uint64_t)tms.tv_nsec - startNs;
+            minimalNs = (endNs<minimalNs) ? endNs : minimalNs;
+        }
+        singleNs = (1u == threads) ? minimalNs : singleNs;
+        printf("Parallel 2^%u, %u threads: %d Nsec (speedup: %.2f)\r\n", (unsigned)MC_TEST_PARALLEL_POW2, (unsigned)threads,
+            (int)minimalNs, (double)singleNs/(double)minimalNs);
+        mc_fft_parallel_free(&fftObj);
+        mc_thread_pool_destroy(&pool);
+    }
+    free(re);
+}
+
+#define MC_TEST_TRANSPOSE_CYCLES (20u)
+
+static uint64_t mc_test_transpose_time(float *outRe, float *outIm, const float *inRe, const float *inIm, 
+                                       uint32_t rows, uint32_t columns, int naive) {
+    struct timespec tms;
+    uint64_t startNs = 0, endNs = 0, minimalNs = (1ull<<63);
+    for (uint32_t c = 0; c < MC_TEST_TRANSPOSE_CYCLES; ++c) {
+        timespec_get(&tms, TIME_UTC);
+        startNs = (uint64_t)tms.tv_sec*1000000000ull + (uint64_t)tms.tv_nsec;
+        if (naive) {
+            for (uint32_t r = 0; r < rows; ++r) {
+                for (uint32_t k = 0; k < columns; ++k) {
+                    outRe[k*rows + r] = inRe[r*columns + k];
+                    outIm[k*rows + r] = inIm[r*columns + k];
+                }
+            }
+        } else {
+            mc_transpose(outRe, outIm, inRe, inIm, rows, columns);
+        }
+        timespec_get(&tms, TIME_UTC);
+        endNs = (uint64_t)tms.tv_sec*1000000000ull + (uint64_t)tms.tv_nsec - startNs;
+        minimalNs = (endNs<minimalNs) ? endNs : minimalNs;
+    }
+    return minimalNs;
+}
+
+/* Tiled SIMD transpose vs naive loop (power of 2 strides hit cache associativity in naive loop) */
+static void cmocka_transpose_benchmark(void **state) {
+    /* rows, columns */
+    const uint32_t sizes[][2] = {{256u, 256u}, {1024u, 1024u}, {2048u, 512u}, {1000u, 1000u}};
+    const uint32_t maxLength = 1024u*1024u;
+    float *in = (float*)malloc(4u*sizeof(float)*maxLength);
+    (void)state;
+    assert_non_null(in);
+    for (uint32_t i = 0; i < 4u*maxLength; ++i) {
+        in[i] = (float)i;
+    }
+    for (uint32_t s = 0; s < MC_ARRAY_LENGTH(sizes); ++s) {
+        const uint64_t naiveNs = mc_test_transpose_time(&in[2u*maxLength], &in[3u*maxLength], in, &in[maxLength], 
+                                                        sizes[s][0], sizes[s][1], 1);
+        const uint64_t tiledNs = mc_test_transpose_time(&in[2u*maxLength], &in[3u*maxLength], in, &in[maxLength], 
+                                                        sizes[s][0], sizes[s][1], 0);
+        printf("Transpose %ux%u: naive %d Nsec, tiled %d Nsec (speedup: %.2f)\r\n", (unsigned)sizes[s][0], (unsigned)sizes[s][1],
+            (int)naiveNs, (int)tiledNs, (double)naiveNs/(double)tiledNs);
+    }
+    free(in);
+}
+
 int main(void)
 {
     const struct CMUnitTest utests[] = {
@@ -215,6 +320,10 @@ int main(void)
         cmocka_unit_test(cmocka_fft_benchmark_256),
         cmocka_unit_test(cmocka_fft_benchmark_512),
         cmocka_unit_test(cmocka_fft_benchmark_1024),
+        cmocka_unit_test(cmocka_fft_benchmark_4096),
+        cmocka_unit_test(cmocka_fft_benchmark_16384),
+        cmocka_unit_test(cmocka_fft_parallel_benchmark),
+        cmocka_unit_test(cmocka_transpose_benchmark),
     };
 
     return cmocka_run_group_tests(utests, NULL, NULL);
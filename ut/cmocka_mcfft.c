@@ -1,8 +1,31 @@
 
 #include "utils.h"
 #include "mcfft.h"
+#include "mcfft_wisdom.h"
+#include "mcfft_image.h"
+#include "mcfft_conv.h"
+#include "mcfft_pconv.h"
+#include "mcfft_corr.h"
+#include "mcfft_stft.h"
+#include "mcfft_welch.h"
+#include "mcfft_prune.h"
+#include "mcfft_sdft.h"
+#include "mcfft_thread.h"
+#include "mcfft_parallel.h"
+#include "mcfft_batch.h"
+#include "mcfft_async.h"
+#include "mcfft_2d.h"
+#include "mcfft_3d.h"
+#include "mcfft_transpose.h"
+#include "mcfft_dct.h"
+#include "mcfft_mdct.h"
+#include "mcfft_channelizer.h"
+#include "mcfft_goertzel.h"
+#include "mcfft_multi.h"
 #include "generic/mcfft_generic.h"
 #include "reference_signals.h"
+#include "mcfft_static.h"
+#include "mcfft_static_tables.h"
 #include <math.h>
 #include <stdint.h>
 #include <stdlib.h>
@@ -28,6 +51,9 @@
         assert_true((threshold) > mc_test_mean_error(zero_array_tmp123, (array), MC_ARRAY_LENGTH((array)))); \
     }
 
+MC_FFT_STATIC_DEFINE(st_static_fft64, 6)
+MC_FFT_STATIC_DEFINE(st_static_fft128, 7)
+
 
 static void cmocka_fft_match_response(void **state) {
     float mono_re0[MC_ARRAY_LENGTH(ref_fft_mono_input0)];
@@ -177,11 +203,1607 @@ static void cmocka_odd_match_response(void **state) {
     MC_TEST_ZEROS_CHECK(mono_im2, 1E-6);
 }
 
+static void cmocka_fft_sizes_match_dft(void **state) {
+    (void)state;
+    for (uint32_t power2 = 5u; (1u<<power2) <= MC_MAX_FFT_LENGTH; ++power2) {
+        const uint32_t length = 1u<<power2;
+        const uint32_t binStep = (length > 256u) ? (length>>8u) : 1u;
+        size_t memSize = MC_FFT_GET_OBJECT_SIZE(power2);
+        void *memory = malloc(memSize);
+        float *ref = malloc(sizeof(float)*length);
+        float *re = malloc(sizeof(float)*length);
+        float *im = malloc(sizeof(float)*length);
+        float errRe = 0.f, errIm = 0.f;
+        mc_fft_object_t fftObj;
+        mc_fft_create_object(&fftObj, power2, memory, memSize);
+
+        memset(ref, 0, sizeof(float)*length);
+        mc_test_add_sinwave(ref, length, 0.8f, 1000.f, MC_TEST_FS);
+        mc_test_add_sinwave(ref, length, 0.5f, 4500.f, MC_TEST_FS);
+        memcpy(re, ref, sizeof(float)*length);
+        memset(im, 0, sizeof(float)*length);
+
+        mc_fft_mono(&fftObj.context, re, im, length);
+        /* Reference DFT is calculated for subset of bins to keep the test fast for large FFTs */
+        for (uint32_t k = 0; k < length; k += binStep) {
+            double accRe = 0.0, accIm = 0.0;
+            for (uint32_t n = 0; n < length; ++n) {
+                double phi = -6.283185307179586*(double)((k*n) & (length-1u))/(double)length;
+                accRe += (double)ref[n]*cos(phi);
+                accIm += (double)ref[n]*sin(phi);
+            }
+            errRe += fabsf((float)accRe - re[k]);
+            errIm += fabsf((float)accIm - im[k]);
+        }
+        assert_true(1E-7 > errRe/(float)(length/binStep)/(float)length);
+        assert_true(1E-7 > errIm/(float)(length/binStep)/(float)length);
+
+        mc_ifft_mono(&fftObj.context, re, im, length);
+        mc_fft_norm(re, im, length);
+        assert_true(1E-6 > mc_test_mean_error(re, ref, length));
+        memset(ref, 0, sizeof(float)*length);
+        assert_true(1E-6 > mc_test_mean_error(im, ref, length));
+
+        free(memory);
+        free(ref);
+        free(re);
+        free(im);
+    }
+}
+
+static void cmocka_static_match_response(void **state) {
+    float mono_re0[MC_ARRAY_LENGTH(ref_fft_mono_input0)];
+    float mono_im0[MC_ARRAY_LENGTH(ref_fft_mono_input0)];
+    float mono_re2[MC_ARRAY_LENGTH(ref_fft_mono_input2)];
+    float mono_im2[MC_ARRAY_LENGTH(ref_fft_mono_input2)];
+    float twiddle[MC_TWIDDLE_LENGTH(MC_REF_FFT_ODD_POW2)];
+    uint32_t digitRev[MC_DIGIT_LENGTH(MC_REF_FFT_ODD_POW2)];
+    (void)state;
+
+    /* Generated tables must be bit-exact with runtime ones */
+    mc_fft_get_twiddle(twiddle, MC_TWIDDLE_LENGTH(MC_REF_FFT_POW2), MC_REF_FFT_POW2);
+    mc_fft_get_digitRev(digitRev, MC_DIGIT_LENGTH(MC_REF_FFT_POW2), MC_REF_FFT_POW2);
+    assert_true(0 == memcmp(twiddle, st_static_fft64.twiddle, sizeof(float)*MC_TWIDDLE_LENGTH(MC_REF_FFT_POW2)));
+    assert_true(0 == memcmp(digitRev, st_static_fft64.digitRev, sizeof(uint32_t)*MC_DIGIT_LENGTH(MC_REF_FFT_POW2)));
+    mc_fft_get_twiddle(twiddle, MC_TWIDDLE_LENGTH(MC_REF_FFT_ODD_POW2), MC_REF_FFT_ODD_POW2);
+    mc_fft_get_digitRev(digitRev, MC_DIGIT_LENGTH(MC_REF_FFT_ODD_POW2), MC_REF_FFT_ODD_POW2);
+    assert_true(0 == memcmp(twiddle, st_static_fft128.twiddle, sizeof(twiddle)));
+    assert_true(0 == memcmp(digitRev, st_static_fft128.digitRev, sizeof(digitRev)));
+
+    memcpy(mono_re0, ref_fft_mono_input0, sizeof(mono_re0));
+    memset(mono_im0, 0, sizeof(mono_im0));
+    st_static_fft64_fft(mono_re0, mono_im0);
+    assert_true(1E-6 > mc_test_mean_error(mono_re0, ref_fft_mono_re0, MC_ARRAY_LENGTH(mono_re0)));
+    assert_true(1E-6 > mc_test_mean_error(mono_im0, ref_fft_mono_im0, MC_ARRAY_LENGTH(mono_im0)));
+    st_static_fft64_ifft(mono_re0, mono_im0);
+    mc_fft_norm(mono_re0, mono_im0, MC_ARRAY_LENGTH(mono_re0));
+    assert_true(1E-6 > mc_test_mean_error(mono_re0, ref_fft_mono_input0, MC_ARRAY_LENGTH(mono_re0)));
+    MC_TEST_ZEROS_CHECK(mono_im0, 1E-6);
+
+    memcpy(mono_re2, ref_fft_mono_input2, sizeof(mono_re2));
+    memset(mono_im2, 0, sizeof(mono_im2));
+    st_static_fft128_fft(mono_re2, mono_im2);
+    assert_true(1E-6 > mc_test_mean_error(mono_re2, ref_fft_mono_re2, MC_ARRAY_LENGTH(mono_re2)));
+    assert_true(1E-6 > mc_test_mean_error(mono_im2, ref_fft_mono_im2, MC_ARRAY_LENGTH(mono_im2)));
+    st_static_fft128_ifft(mono_re2, mono_im2);
+    mc_fft_norm(mono_re2, mono_im2, MC_ARRAY_LENGTH(mono_re2));
+    assert_true(1E-6 > mc_test_mean_error(mono_re2, ref_fft_mono_input2, MC_ARRAY_LENGTH(mono_re2)));
+    MC_TEST_ZEROS_CHECK(mono_im2, 1E-6);
+}
+
+static void cmocka_plan_match_response(void **state) {
+    float mono_re0[MC_ARRAY_LENGTH(ref_fft_mono_input0)];
+    float mono_im0[MC_ARRAY_LENGTH(ref_fft_mono_input0)];
+    float mono_re2[MC_ARRAY_LENGTH(ref_fft_mono_input2)];
+    float mono_im2[MC_ARRAY_LENGTH(ref_fft_mono_input2)];
+    uint8_t fftObjMem0[MC_FFT_GET_OBJECT_SIZE(MC_REF_FFT_POW2)];
+    uint8_t fftObjMem2[MC_FFT_GET_OBJECT_SIZE(MC_REF_FFT_ODD_POW2)];
+    mc_fft_object_t fftObj0;
+    mc_fft_object_t fftObj2;
+    mc_fft_create_object(&fftObj0, MC_REF_FFT_POW2, fftObjMem0, MC_ARRAY_LENGTH(fftObjMem0));
+    mc_fft_create_object(&fftObj2, MC_REF_FFT_ODD_POW2, fftObjMem2, MC_ARRAY_LENGTH(fftObjMem2));
+    (void)state;
+
+    /* Every pipeline (+ the measured one) must give the same response */
+    for (uint32_t pipeline = 0; pipeline <= MC_FFT_PIPELINE_COUNT; ++pipeline) {
+        if (MC_FFT_PIPELINE_COUNT == pipeline) {
+            mc_fft_plan(&fftObj0.context, MC_FFT_PLAN_MEASURE, mono_re0, mono_im0, MC_ARRAY_LENGTH(mono_re0));
+            mc_fft_plan(&fftObj2.context, MC_FFT_PLAN_MEASURE, mono_re2, mono_im2, MC_ARRAY_LENGTH(mono_re2));
+            assert_true(MC_FFT_PIPELINE_COUNT > fftObj0.context.pipeline);
+            assert_true(MC_FFT_PIPELINE_COUNT > fftObj2.context.pipeline);
+        } else {
+            fftObj0.context.pipeline = pipeline;
+            fftObj2.context.pipeline = pipeline;
+        }
+        memcpy(mono_re0, ref_fft_mono_input0, sizeof(mono_re0));
+        memset(mono_im0, 0, sizeof(mono_im0));
+        memcpy(mono_re2, ref_fft_mono_input2, sizeof(mono_re2));
+        memset(mono_im2, 0, sizeof(mono_im2));
+
+        mc_fft_mono(&fftObj0.context, mono_re0, mono_im0, MC_ARRAY_LENGTH(mono_re0));
+        mc_fft_mono(&fftObj2.context, mono_re2, mono_im2, MC_ARRAY_LENGTH(mono_re2));
+        assert_true(1E-6 > mc_test_mean_error(mono_re0, ref_fft_mono_re0, MC_ARRAY_LENGTH(mono_re0)));
+        assert_true(1E-6 > mc_test_mean_error(mono_im0, ref_fft_mono_im0, MC_ARRAY_LENGTH(mono_im0)));
+        assert_true(1E-6 > mc_test_mean_error(mono_re2, ref_fft_mono_re2, MC_ARRAY_LENGTH(mono_re2)));
+        assert_true(1E-6 > mc_test_mean_error(mono_im2, ref_fft_mono_im2, MC_ARRAY_LENGTH(mono_im2)));
+
+        mc_ifft_mono(&fftObj0.context, mono_re0, mono_im0, MC_ARRAY_LENGTH(mono_re0));
+        mc_fft_norm(mono_re0, mono_im0, MC_ARRAY_LENGTH(mono_re0));
+        assert_true(1E-6 > mc_test_mean_error(mono_re0, ref_fft_mono_input0, MC_ARRAY_LENGTH(mono_re0)));
+        MC_TEST_ZEROS_CHECK(mono_im0, 1E-6);
+        mc_ifft_mono(&fftObj2.context, mono_re2, mono_im2, MC_ARRAY_LENGTH(mono_re2));
+        mc_fft_norm(mono_re2, mono_im2, MC_ARRAY_LENGTH(mono_re2));
+        assert_true(1E-6 > mc_test_mean_error(mono_re2, ref_fft_mono_input2, MC_ARRAY_LENGTH(mono_re2)));
+        MC_TEST_ZEROS_CHECK(mono_im2, 1E-6);
+    }
+}
+
+static void cmocka_wisdom_export_import(void **state) {
+    float mono_re0[MC_ARRAY_LENGTH(ref_fft_mono_input0)];
+    float mono_im0[MC_ARRAY_LENGTH(ref_fft_mono_input0)];
+    uint8_t fftObjMem0[MC_FFT_GET_OBJECT_SIZE(MC_REF_FFT_POW2)];
+    uint8_t blob[MC_FFT_WISDOM_MAX_SIZE];
+    mc_fft_wisdom_header_t header;
+    mc_fft_object_t fftObj0;
+    uint32_t pipeline = MC_FFT_PIPELINE_COUNT;
+    uint32_t measured = 0;
+    size_t blobSize = 0;
+    (void)state;
+
+    mc_fft_forget_wisdom();
+    assert_int_equal(0, mc_fft_get_wisdom(MC_REF_FFT_POW2, &pipeline));
+    assert_int_equal(sizeof(mc_fft_wisdom_header_t), mc_fft_export_wisdom(NULL, 0));
+
+    mc_fft_create_object(&fftObj0, MC_REF_FFT_POW2, fftObjMem0, MC_ARRAY_LENGTH(fftObjMem0));
+    mc_fft_plan(&fftObj0.context, MC_FFT_PLAN_MEASURE, mono_re0, mono_im0, MC_ARRAY_LENGTH(mono_re0));
+    measured = fftObj0.context.pipeline;
+    assert_int_equal(1, mc_fft_get_wisdom(MC_REF_FFT_POW2, &pipeline));
+    assert_int_equal(measured, pipeline);
+
+    /* Round trip via memory */
+    blobSize = mc_fft_export_wisdom(blob, sizeof(blob));
+    assert_int_equal(sizeof(mc_fft_wisdom_header_t) + sizeof(mc_fft_wisdom_entry_t), blobSize);
+    mc_fft_forget_wisdom();
+    assert_int_equal(0, mc_fft_get_wisdom(MC_REF_FFT_POW2, &pipeline));
+    assert_int_equal(0, mc_fft_import_wisdom(blob, blobSize-1u));
+    assert_int_equal(1, mc_fft_import_wisdom(blob, blobSize));
+    pipeline = MC_FFT_PIPELINE_COUNT;
+    assert_int_equal(1, mc_fft_get_wisdom(MC_REF_FFT_POW2, &pipeline));
+    assert_int_equal(measured, pipeline);
+
+    /* Estimate must follow wisdom */
+    fftObj0.context.pipeline = MC_FFT_PIPELINE_COUNT;
+    mc_fft_plan(&fftObj0.context, MC_FFT_PLAN_ESTIMATE, NULL, NULL, MC_ARRAY_LENGTH(mono_re0));
+    assert_int_equal(measured, fftObj0.context.pipeline);
+
+    /* Wisdom of another CPU/library must be rejected */
+    memcpy(&header, blob, sizeof(header));
+    header.cpuId[0] ^= 1;
+    memcpy(blob, &header, sizeof(header));
+    assert_int_equal(0, mc_fft_import_wisdom(blob, blobSize));
+    header.cpuId[0] ^= 1;
+    header.libVersion += 1u;
+    memcpy(blob, &header, sizeof(header));
+    assert_int_equal(0, mc_fft_import_wisdom(blob, blobSize));
+
+#ifndef MC_EXCLUDE_FILE_IO
+    /* Round trip via file */
+    assert_int_equal(1, mc_fft_export_wisdom_to_file("cmocka_mcfft_wisdom.bin"));
+    mc_fft_forget_wisdom();
+    assert_int_equal(1, mc_fft_import_wisdom_from_file("cmocka_mcfft_wisdom.bin"));
+    assert_int_equal(1, mc_fft_get_wisdom(MC_REF_FFT_POW2, &pipeline));
+    assert_int_equal(measured, pipeline);
+    assert_int_equal(0, mc_fft_import_wisdom_from_file("cmocka_mcfft_wisdom_absent.bin"));
+    remove("cmocka_mcfft_wisdom.bin");
+#endif
+    mc_fft_forget_wisdom();
+}
+
+static void cmocka_image_match_response(void **state) {
+    float mono_re2[MC_ARRAY_LENGTH(ref_fft_mono_input2)];
+    float mono_im2[MC_ARRAY_LENGTH(ref_fft_mono_input2)];
+    uint8_t fftObjMem2[MC_FFT_GET_OBJECT_SIZE(MC_REF_FFT_ODD_POW2)];
+    uint8_t imageMem[MC_FFT_GET_IMAGE_SIZE(MC_REF_FFT_ODD_POW2) + MC_MEM_ALIGNMENT];
+    float buffer[MC_BUFFER_LENGTH(MC_REF_FFT_ODD_POW2)];
+    uint8_t *image = (uint8_t*)MC_GET_ALIGNED_PTR(imageMem);
+    mc_fft_image_header_t header;
+    mc_fft_object_t fftObj2;
+    mc_fft_t imageContext;
+    size_t imageSize = 0;
+    (void)state;
+
+    mc_fft_create_object(&fftObj2, MC_REF_FFT_ODD_POW2, fftObjMem2, MC_ARRAY_LENGTH(fftObjMem2));
+    fftObj2.context.pipeline = MC_FFT_PIPELINE_DIF;
+    assert_int_equal(MC_FFT_GET_IMAGE_SIZE(MC_REF_FFT_ODD_POW2), mc_fft_export_image(&fftObj2.context, NULL, 0));
+    imageSize = mc_fft_export_image(&fftObj2.context, image, MC_FFT_GET_IMAGE_SIZE(MC_REF_FFT_ODD_POW2));
+    assert_int_equal(MC_FFT_GET_IMAGE_SIZE(MC_REF_FFT_ODD_POW2), imageSize);
+    /* Invalid/truncated images must be rejected */
+    assert_int_equal(0, mc_fft_attach_image(&imageContext, image, imageSize-1u, buffer, MC_ARRAY_LENGTH(buffer)));
+    assert_int_equal(0, mc_fft_attach_image(&imageContext, image, imageSize, buffer, MC_ARRAY_LENGTH(buffer)-1u));
+    memcpy(&header, image, sizeof(header));
+    header.libVersion += 1u;
+    memcpy(image, &header, sizeof(header));
+    assert_int_equal(0, mc_fft_attach_image(&imageContext, image, imageSize, buffer, MC_ARRAY_LENGTH(buffer)));
+    header.libVersion -= 1u;
+    header.digitRevOffset += 4u;
+    memcpy(image, &header, sizeof(header));
+    assert_int_equal(0, mc_fft_attach_image(&imageContext, image, imageSize, buffer, MC_ARRAY_LENGTH(buffer)));
+    header.digitRevOffset -= 4u;
+    memcpy(image, &header, sizeof(header));
+
+    /* Tables are used in-place */
+    assert_int_equal(1, mc_fft_attach_image(&imageContext, image, imageSize, buffer, MC_ARRAY_LENGTH(buffer)));
+    assert_true((uint8_t*)imageContext.twiddle > image);
+    assert_true((uint8_t*)imageContext.digitRev < (image + imageSize));
+    assert_int_equal(MC_FFT_PIPELINE_DIF, imageContext.pipeline);
+    memcpy(mono_re2, ref_fft_mono_input2, sizeof(mono_re2));
+    memset(mono_im2, 0, sizeof(mono_im2));
+    mc_fft_mono(&imageContext, mono_re2, mono_im2, MC_ARRAY_LENGTH(mono_re2));
+    assert_true(1E-6 > mc_test_mean_error(mono_re2, ref_fft_mono_re2, MC_ARRAY_LENGTH(mono_re2)));
+    assert_true(1E-6 > mc_test_mean_error(mono_im2, ref_fft_mono_im2, MC_ARRAY_LENGTH(mono_im2)));
+    mc_ifft_mono(&imageContext, mono_re2, mono_im2, MC_ARRAY_LENGTH(mono_re2));
+    mc_fft_norm(mono_re2, mono_im2, MC_ARRAY_LENGTH(mono_re2));
+    assert_true(1E-6 > mc_test_mean_error(mono_re2, ref_fft_mono_input2, MC_ARRAY_LENGTH(mono_re2)));
+    MC_TEST_ZEROS_CHECK(mono_im2, 1E-6);
+
+#if !defined(MC_EXCLUDE_FILE_IO) && !defined(MC_EXCLUDE_MALLOC)
+    mc_fft_image_object_t imageObj;
+    assert_int_equal(1, mc_fft_export_image_to_file(&fftObj2.context, "cmocka_mcfft_image.bin"));
+    assert_int_equal(1, mc_fft_open_image_file(&imageObj, "cmocka_mcfft_image.bin", buffer, MC_ARRAY_LENGTH(buffer)));
+    memcpy(mono_re2, ref_fft_mono_input2, sizeof(mono_re2));
+    memset(mono_im2, 0, sizeof(mono_im2));
+    mc_fft_mono(&imageObj.context, mono_re2, mono_im2, MC_ARRAY_LENGTH(mono_re2));
+    assert_true(1E-6 > mc_test_mean_error(mono_re2, ref_fft_mono_re2, MC_ARRAY_LENGTH(mono_re2)));
+    assert_true(1E-6 > mc_test_mean_error(mono_im2, ref_fft_mono_im2, MC_ARRAY_LENGTH(mono_im2)));
+    mc_fft_close_image_file(&imageObj);
+    /* Fallback of mc_file_map() without mmap (MSVC): content is aligned for mc_fft_attach_image() */
+    size_t fileSize = 0;
+    const void *fileImage = mc_file_read("cmocka_mcfft_image.bin", &fileSize);
+    assert_non_null(fileImage);
+    assert_true(MC_GET_ALIGNED_PTR(fileImage) == (uintptr_t)fileImage);
+    assert_int_equal(imageSize, fileSize);
+    assert_int_equal(1, mc_fft_attach_image(&imageContext, fileImage, fileSize, buffer, MC_ARRAY_LENGTH(buffer)));
+    memcpy(mono_re2, ref_fft_mono_input2, sizeof(mono_re2));
+    memset(mono_im2, 0, sizeof(mono_im2));
+    mc_fft_mono(&imageContext, mono_re2, mono_im2, MC_ARRAY_LENGTH(mono_re2));
+    assert_true(1E-6 > mc_test_mean_error(mono_re2, ref_fft_mono_re2, MC_ARRAY_LENGTH(mono_re2)));
+    assert_true(1E-6 > mc_test_mean_error(mono_im2, ref_fft_mono_im2, MC_ARRAY_LENGTH(mono_im2)));
+    mc_file_release(fileImage);
+    assert_null(mc_file_read("cmocka_mcfft_image_absent.bin", &fileSize));
+    assert_int_equal(0, mc_fft_open_image_file(&imageObj, "cmocka_mcfft_image_absent.bin", buffer, MC_ARRAY_LENGTH(buffer)));
+    remove("cmocka_mcfft_image.bin");
+#endif
+}
+
+#define MC_TEST_CONV_POW2 (6u)
+#define MC_TEST_CONV_BLOCKS (8u)
+
+static void st_test_direct_conv(float *out, const float *in, uint32_t length, const float *filter, uint32_t filterLength) {
+    for (uint32_t n = 0; n < length; ++n) {
+        double acc = 0.0;
+        for (uint32_t k = 0; (k < filterLength) && (k <= n); ++k) {
+            acc += (double)filter[k]*(double)in[n-k];
+        }
+        out[n] = (float)acc;
+    }
+}
+
+static void cmocka_conv_match_direct(void **state) {
+    const uint32_t blockLength = MC_CONV_BLOCK_LENGTH(MC_TEST_CONV_POW2);
+    /* Number of blocks per call: single, dual, odd, in-place */
+    const uint32_t chunks[] = {1u, 2u, 3u, 2u};
+    float in[MC_CONV_BLOCK_LENGTH(MC_TEST_CONV_POW2)*MC_TEST_CONV_BLOCKS];
+    float out[MC_ARRAY_LENGTH(in)];
+    float ref[MC_ARRAY_LENGTH(in)];
+    float filter[MC_CONV_BLOCK_LENGTH(MC_TEST_CONV_POW2)];
+    uint8_t convObjMem[MC_CONV_GET_OBJECT_SIZE(MC_TEST_CONV_POW2)];
+    mc_conv_object_t convObj;
+    (void)state;
+
+    memset(in, 0, sizeof(in));
+    mc_test_add_sinwave(in, MC_ARRAY_LENGTH(in), 0.8f, 1000.f, MC_TEST_FS);
+    mc_test_add_sinwave(in, MC_ARRAY_LENGTH(in), 0.5f, 4500.f, MC_TEST_FS);
+    for (uint32_t i = 0; i < MC_ARRAY_LENGTH(filter); ++i) {
+        filter[i] = ((i % 3u) ? 0.5f : -0.25f) / (float)(i + 1u);
+    }
+
+    for (uint32_t filterLength = 1u; filterLength <= blockLength; filterLength += (blockLength - 1u)) {
+        uint32_t offset = 0;
+        mc_conv_create_object(&convObj, MC_TEST_CONV_POW2, filter, filterLength, convObjMem, MC_ARRAY_LENGTH(convObjMem));
+        st_test_direct_conv(ref, in, MC_ARRAY_LENGTH(in), filter, filterLength);
+        for (uint32_t i = 0; i < MC_ARRAY_LENGTH(chunks); ++i) {
+            const uint32_t length = chunks[i]*blockLength;
+            if ((MC_ARRAY_LENGTH(chunks) - 1u) == i) {
+                memcpy(&out[offset], &in[offset], sizeof(float)*length);
+                mc_conv_process(&convObj.context, &out[offset], &out[offset], length);
+            } else {
+                mc_conv_process(&convObj.context, &in[offset], &out[offset], length);
+            }
+            offset += length;
+        }
+        assert_int_equal(MC_ARRAY_LENGTH(in), offset);
+        assert_true(1E-6 > mc_test_mean_error(out, ref, MC_ARRAY_LENGTH(out)));
+
+        /* After reset the stream starts again from zero history */
+        mc_conv_reset(&convObj.context);
+        mc_conv_process(&convObj.context, in, out, 2u*blockLength);
+        assert_true(1E-6 > mc_test_mean_error(out, ref, 2u*blockLength));
+    }
+}
+
+#define MC_TEST_PCONV_FILTER (1000u)
+#define MC_TEST_PCONV_SIGNAL (4096u)
+
+static void cmocka_pconv_match_direct(void **state) {
+    const uint32_t blockLength = MC_CONV_BLOCK_LENGTH(MC_TEST_CONV_POW2);
+    /* Number of blocks per call: single, dual, odd */
+    const uint32_t chunks[] = {1u, 2u, 3u};
+    float *in = malloc(sizeof(float)*MC_TEST_PCONV_SIGNAL);
+    float *out = malloc(sizeof(float)*MC_TEST_PCONV_SIGNAL);
+    float *ref = malloc(sizeof(float)*MC_TEST_PCONV_SIGNAL);
+    float *filter = malloc(sizeof(float)*MC_TEST_PCONV_FILTER);
+    mc_pconv_object_t pconvObj;
+    mc_npconv_object_t npconvObj;
+    (void)state;
+
+    memset(in, 0, sizeof(float)*MC_TEST_PCONV_SIGNAL);
+    mc_test_add_sinwave(in, MC_TEST_PCONV_SIGNAL, 0.8f, 1000.f, MC_TEST_FS);
+    mc_test_add_sinwave(in, MC_TEST_PCONV_SIGNAL, 0.5f, 4500.f, MC_TEST_FS);
+    in[100] += 1.f;
+    for (uint32_t i = 0; i < MC_TEST_PCONV_FILTER; ++i) {
+        /* Decaying "room" response */
+        filter[i] = ((i % 3u) ? 0.5f : -0.25f) * expf(-(float)i/300.f);
+    }
+    st_test_direct_conv(ref, in, MC_TEST_PCONV_SIGNAL, filter, MC_TEST_PCONV_FILTER);
+
+    mc_pconv_allocate(&pconvObj, MC_TEST_CONV_POW2, filter, MC_TEST_PCONV_FILTER);
+    assert_int_equal(MC_PCONV_PARTITIONS(MC_TEST_CONV_POW2, MC_TEST_PCONV_FILTER), pconvObj.context.partitions);
+    for (uint32_t offset = 0, i = 0; offset < MC_TEST_PCONV_SIGNAL; ++i) {
+        uint32_t length = chunks[i % MC_ARRAY_LENGTH(chunks)]*blockLength;
+        length = ((offset + length) > MC_TEST_PCONV_SIGNAL) ? (MC_TEST_PCONV_SIGNAL - offset) : length;
+        mc_pconv_process(&pconvObj.context, &in[offset], &out[offset], length);
+        offset += length;
+    }
+    assert_true(1E-5 > mc_test_mean_error(out, ref, MC_TEST_PCONV_SIGNAL));
+    mc_pconv_free(&pconvObj);
+
+    /* Non-uniform: block 32, stages 32/128/512 with in-place processing */
+    mc_npconv_allocate(&npconvObj, MC_TEST_CONV_POW2, filter, MC_TEST_PCONV_FILTER);
+    assert_int_equal(3u, npconvObj.context.stageCount);
+    for (uint32_t rep = 0; rep < 2u; ++rep) {
+        memcpy(out, in, sizeof(float)*MC_TEST_PCONV_SIGNAL);
+        for (uint32_t offset = 0, i = 0; offset < MC_TEST_PCONV_SIGNAL; ++i) {
+            uint32_t length = chunks[i % MC_ARRAY_LENGTH(chunks)]*blockLength;
+            length = ((offset + length) > MC_TEST_PCONV_SIGNAL) ? (MC_TEST_PCONV_SIGNAL - offset) : length;
+            mc_npconv_process(&npconvObj.context, &out[offset], &out[offset], length);
+            offset += length;
+        }
+        assert_true(1E-5 > mc_test_mean_error(out, ref, MC_TEST_PCONV_SIGNAL));
+        mc_npconv_reset(&npconvObj.context);
+    }
+    mc_npconv_free(&npconvObj);
+
+    free(in);
+    free(out);
+    free(ref);
+    free(filter);
+}
+
+static void cmocka_scrambled_match_response(void **state) {
+    float mono_re0[MC_ARRAY_LENGTH(ref_fft_mono_input0)];
+    float mono_im0[MC_ARRAY_LENGTH(ref_fft_mono_input0)];
+    float nat_re0[MC_ARRAY_LENGTH(ref_fft_mono_input0)];
+    float nat_im0[MC_ARRAY_LENGTH(ref_fft_mono_input0)];
+    float mask[MC_ARRAY_LENGTH(ref_fft_mono_input0)];
+    uint8_t fftObjMem[MC_FFT_GET_OBJECT_SIZE(MC_REF_FFT_POW2)];
+    mc_fft_object_t fftObj;
+    mc_fft_create_object(&fftObj, MC_REF_FFT_POW2, fftObjMem, MC_ARRAY_LENGTH(fftObjMem));
+    const uint32_t length = MC_ARRAY_LENGTH(mono_re0);
+    (void)state;
+
+    /* Scrambled spectrum is a permutation of natural one */
+    memcpy(mono_re0, ref_fft_mono_input0, sizeof(mono_re0));
+    memset(mono_im0, 0, sizeof(mono_im0));
+    mc_fft_mono_scrambled(&fftObj.context, mono_re0, mono_im0, length);
+    memcpy(nat_re0, ref_fft_mono_re0, sizeof(nat_re0));
+    memcpy(nat_im0, ref_fft_mono_im0, sizeof(nat_im0));
+    mc_fft_scramble(&fftObj.context, nat_re0, nat_im0, length);
+    assert_true(1E-6 > mc_test_mean_error(mono_re0, nat_re0, length));
+    assert_true(1E-6 > mc_test_mean_error(mono_im0, nat_im0, length));
+    mc_fft_unscramble(&fftObj.context, mono_re0, mono_im0, length);
+    assert_true(1E-6 > mc_test_mean_error(mono_re0, ref_fft_mono_re0, length));
+    assert_true(1E-6 > mc_test_mean_error(mono_im0, ref_fft_mono_im0, length));
+
+    /* Real mask (high-pass) applied in scrambled order == mask applied in natural order */
+    for (uint32_t k = 0; k < length; ++k) {
+        mask[k] = ((k < (length>>3u)) || (k > (length - (length>>3u)))) ? 0.f : 1.f/(float)length;
+    }
+    memcpy(nat_re0, ref_fft_mono_input0, sizeof(nat_re0));
+    memset(nat_im0, 0, sizeof(nat_im0));
+    mc_fft_mono(&fftObj.context, nat_re0, nat_im0, length);
+    for (uint32_t k = 0; k < length; ++k) {
+        nat_re0[k] *= mask[k];
+        nat_im0[k] *= mask[k];
+    }
+    mc_ifft_mono(&fftObj.context, nat_re0, nat_im0, length);
+
+    mc_fft_scramble(&fftObj.context, mask, NULL, length);
+    memcpy(mono_re0, ref_fft_mono_input0, sizeof(mono_re0));
+    memset(mono_im0, 0, sizeof(mono_im0));
+    mc_fft_mono_scrambled(&fftObj.context, mono_re0, mono_im0, length);
+    for (uint32_t k = 0; k < length; ++k) {
+        mono_re0[k] *= mask[k];
+        mono_im0[k] *= mask[k];
+    }
+    mc_ifft_mono_scrambled(&fftObj.context, mono_re0, mono_im0, length);
+    assert_true(1E-6 > mc_test_mean_error(mono_re0, nat_re0, length));
+    assert_true(1E-6 > mc_test_mean_error(mono_im0, nat_im0, length));
+    /* Signal is filtered indeed */
+    assert_true(1E-2 < mc_test_mean_error(mono_re0, ref_fft_mono_input0, length));
+}
+
+#define MC_TEST_CORR_POW2 (10u)
+#define MC_TEST_CORR_SIGNAL (500u)
+#define MC_TEST_CORR_DELAY (37u)
+
+static void cmocka_corr_match_direct(void **state) {
+    const uint32_t fftLength = 1u<<MC_TEST_CORR_POW2;
+    float x[MC_TEST_CORR_SIGNAL];
+    float y[MC_TEST_CORR_SIGNAL];
+    float out[1u<<MC_TEST_CORR_POW2];
+    float ref[1u<<MC_TEST_CORR_POW2];
+    float parabola[1u<<MC_TEST_CORR_POW2];
+    uint8_t corrObjMem[MC_CORR_GET_OBJECT_SIZE(MC_TEST_CORR_POW2)];
+    mc_corr_object_t corrObj;
+    uint32_t seed = 12345u;
+    float value = 0.f, energy = 0.f;
+    (void)state;
+
+    /* White noise y, x is y delayed by MC_TEST_CORR_DELAY samples */
+    for (uint32_t i = 0; i < MC_TEST_CORR_SIGNAL; ++i) {
+        seed = seed*1664525u + 1013904223u;
+        y[i] = (float)(seed >> 8u)/(float)(1u<<24u) - 0.5f;
+        x[i] = (i >= MC_TEST_CORR_DELAY) ? y[i - MC_TEST_CORR_DELAY] : 0.f;
+        energy += y[i]*y[i];
+    }
+    for (uint32_t t = 0; t < fftLength; ++t) {
+        double acc = 0.;
+        for (uint32_t n = 0; n < MC_TEST_CORR_SIGNAL; ++n) {
+            uint32_t m = (n + t) & (fftLength - 1u);
+            acc += (m < MC_TEST_CORR_SIGNAL) ? (double)x[m]*(double)y[n] : 0.;
+        }
+        ref[t] = (float)acc;
+    }
+    mc_corr_create_object(&corrObj, MC_TEST_CORR_POW2, corrObjMem, MC_ARRAY_LENGTH(corrObjMem));
+    mc_corr_cross(&corrObj.context, x, y, MC_TEST_CORR_SIGNAL, out, 0);
+    assert_true(1E-5 > mc_test_mean_error(out, ref, fftLength));
+    assert_float_equal((float)MC_TEST_CORR_DELAY, mc_corr_find_peak(out, fftLength, 100u, NULL), 0.1f);
+    /* Swapped signals give negative lag */
+    mc_corr_cross(&corrObj.context, y, x, MC_TEST_CORR_SIGNAL, out, 0);
+    assert_float_equal(-(float)MC_TEST_CORR_DELAY, mc_corr_find_peak(out, fftLength, 100u, NULL), 0.1f);
+
+    /* GCC-PHAT: whitened spectrum gives (almost) unit peak at delay */
+    mc_corr_cross(&corrObj.context, x, y, MC_TEST_CORR_SIGNAL, out, 1u);
+    assert_float_equal((float)MC_TEST_CORR_DELAY, mc_corr_find_peak(out, fftLength, 100u, &value), 0.1f);
+    assert_true((value > 0.5f) && (value < 1.1f));
+
+    /* Auto-correlation at zero lag is energy */
+    mc_corr_auto(&corrObj.context, y, MC_TEST_CORR_SIGNAL, out);
+    assert_float_equal(energy, out[0], 1E-3f*energy);
+    assert_float_equal(0.f, mc_corr_find_peak(out, fftLength, 100u, NULL), 1E-3f);
+
+    /* Parabolic interpolation of sampled parabola is exact */
+    for (uint32_t t = 0; t < fftLength; ++t) {
+        float d = ((t < (fftLength>>1u)) ? (float)t : (float)t - (float)fftLength) - 10.3f;
+        parabola[t] = 2.f - 0.01f*d*d;
+    }
+    assert_float_equal(10.3f, mc_corr_find_peak(parabola, fftLength, 100u, &value), 1E-3f);
+    assert_float_equal(2.f, value, 1E-3f);
+    for (uint32_t t = 0; t < fftLength; ++t) {
+        float d = ((t < (fftLength>>1u)) ? (float)t : (float)t - (float)fftLength) + 20.6f;
+        parabola[t] = 1.f - 0.01f*d*d;
+    }
+    assert_float_equal(-20.6f, mc_corr_find_peak(parabola, fftLength, 100u, &value), 1E-3f);
+    assert_float_equal(1.f, value, 1E-3f);
+}
+
+#define MC_TEST_SPECTRUM_LENGTH (1027u)
+
+static void cmocka_spectrum_postprocess_match_libm(void **state) {
+    float re[MC_TEST_SPECTRUM_LENGTH];
+    float im[MC_TEST_SPECTRUM_LENGTH];
+    float out[MC_TEST_SPECTRUM_LENGTH];
+    float power[MC_ARRAY_LENGTH(ref_fft_mono_input0)];
+    float mono_re0[MC_ARRAY_LENGTH(ref_fft_mono_input0)];
+    float mono_im0[MC_ARRAY_LENGTH(ref_fft_mono_input0)];
+    uint8_t fftObjMem[MC_FFT_GET_OBJECT_SIZE(MC_REF_FFT_POW2)];
+    mc_fft_object_t fftObj;
+    const uint32_t length = MC_ARRAY_LENGTH(mono_re0);
+    float maxError = 0.f;
+    (void)state;
+
+    /* All quadrants, axes, zero and wide dynamic range; odd length covers scalar tails */
+    for (uint32_t i = 0; i < MC_TEST_SPECTRUM_LENGTH; ++i) {
+        float scale = powf(10.f, (float)(i % 17u) - 8.f);
+        re[i] = scale*cosf(0.37f*(float)i) * ((i % 11u) ? 1.f : 0.f);
+        im[i] = scale*sinf(0.37f*(float)i) * ((i % 13u) ? 1.f : 0.f);
+    }
+    re[0] = 0.f;
+    im[0] = 0.f;
+
+    mc_fft_power(out, re, im, MC_TEST_SPECTRUM_LENGTH);
+    for (uint32_t i = 0; i < MC_TEST_SPECTRUM_LENGTH; ++i) {
+        float ref = re[i]*re[i] + im[i]*im[i];
+        assert_float_equal(ref, out[i], 1E-6f*ref);
+    }
+    mc_fft_magnitude(out, re, im, MC_TEST_SPECTRUM_LENGTH);
+    for (uint32_t i = 0; i < MC_TEST_SPECTRUM_LENGTH; ++i) {
+        float ref = hypotf(re[i], im[i]);
+        assert_float_equal(ref, out[i], 1E-6f*ref);
+    }
+    mc_fft_log_power(out, re, im, MC_TEST_SPECTRUM_LENGTH);
+    for (uint32_t i = 0; i < MC_TEST_SPECTRUM_LENGTH; ++i) {
+        double ref = (double)re[i]*re[i] + (double)im[i]*im[i];
+        ref = 10.*log10((ref > MC_SPECTRUM_POWER_FLOOR) ? ref : MC_SPECTRUM_POWER_FLOOR);
+        maxError = fmaxf(maxError, fabsf((float)ref - out[i]));
+    }
+    assert_true(1E-4f > maxError);
+    maxError = 0.f;
+    mc_fft_phase(out, re, im, MC_TEST_SPECTRUM_LENGTH);
+    for (uint32_t i = 0; i < MC_TEST_SPECTRUM_LENGTH; ++i) {
+        maxError = fmaxf(maxError, fabsf((float)atan2((double)im[i], (double)re[i]) - out[i]));
+    }
+    assert_true(4E-6f > maxError);
+    assert_float_equal(0.f, out[0], 0.f);
+
+    /* Fused power spectrum == FFT followed by power */
+    mc_fft_create_object(&fftObj, MC_REF_FFT_POW2, fftObjMem, MC_ARRAY_LENGTH(fftObjMem));
+    memcpy(mono_re0, ref_fft_mono_input0, sizeof(mono_re0));
+    memset(mono_im0, 0, sizeof(mono_im0));
+    mc_fft_mono_power(&fftObj.context, mono_re0, mono_im0, power, length);
+    mc_fft_power(out, ref_fft_mono_re0, ref_fft_mono_im0, length);
+    assert_true(1E-5 > mc_test_mean_error(power, out, length));
+}
+
+#define MC_TEST_STFT_POW2 (7u)
+#define MC_TEST_STFT_SIGNAL (2000u)
+
+static void cmocka_stft_match_reference(void **state) {
+    const uint32_t fftLength = 1u<<MC_TEST_STFT_POW2;
+    const uint32_t bins = MC_STFT_BINS(MC_TEST_STFT_POW2);
+    /* Window, hop and input chunk: single/dual frames per call, hop = N, odd hop */
+    const uint32_t configs[][3] = {{MC_STFT_WINDOW_HANN, 32u, 100u}, {MC_STFT_WINDOW_RECT, 128u, 300u},
+                                   {MC_STFT_WINDOW_HAMMING, 48u, 7u}, {MC_STFT_WINDOW_BLACKMAN, 43u, 2000u}};
+    float *in = malloc(sizeof(float)*MC_TEST_STFT_SIGNAL);
+    float *out = malloc(sizeof(float)*MC_TEST_STFT_SIGNAL);
+    float *specRe = malloc(sizeof(float)*MC_TEST_STFT_SIGNAL*bins);
+    float *specIm = malloc(sizeof(float)*MC_TEST_STFT_SIGNAL*bins);
+    float refRe[1u<<MC_TEST_STFT_POW2];
+    float refIm[1u<<MC_TEST_STFT_POW2];
+    mc_fft_object_t fftObj;
+    mc_stft_object_t stftObj;
+    (void)state;
+
+    memset(in, 0, sizeof(float)*MC_TEST_STFT_SIGNAL);
+    mc_test_add_sinwave(in, MC_TEST_STFT_SIGNAL, 0.8f, 1000.f, MC_TEST_FS);
+    mc_test_add_sinwave(in, MC_TEST_STFT_SIGNAL, 0.3f, 7000.f, MC_TEST_FS);
+    in[500] += 1.f;
+    mc_fft_allocate(&fftObj, MC_TEST_STFT_POW2);
+    for (uint32_t c = 0; c < MC_ARRAY_LENGTH(configs); ++c) {
+        const uint32_t hop = configs[c][1];
+        uint32_t frames = 0;
+        mc_stft_allocate(&stftObj, MC_TEST_STFT_POW2, hop, configs[c][0]);
+        for (uint32_t offset = 0; offset < MC_TEST_STFT_SIGNAL; offset += configs[c][2]) {
+            uint32_t length = MC_TEST_STFT_SIGNAL - offset;
+            length = (length > configs[c][2]) ? configs[c][2] : length;
+            uint32_t count = mc_stft_get_frame_count(&stftObj.context, length);
+            assert_int_equal(count, mc_stft_process(&stftObj.context, &in[offset], length, 
+                                                    &specRe[frames*bins], &specIm[frames*bins]));
+            frames += count;
+        }
+        assert_int_equal(MC_TEST_STFT_SIGNAL/hop, frames);
+
+        /* Frame f is windowed input ending at (f+1)*hop (zeros before start) */
+        for (uint32_t f = 0; f < frames; f += 5u) {
+            for (uint32_t i = 0; i < fftLength; ++i) {
+                int32_t idx = (int32_t)((f + 1u)*hop) - (int32_t)fftLength + (int32_t)i;
+                refRe[i] = (idx >= 0) ? in[idx]*stftObj.context.window[i] : 0.f;
+            }
+            memset(refIm, 0, sizeof(refIm));
+            mc_fft_mono(&fftObj.context, refRe, refIm, fftLength);
+            assert_true(1E-5 > mc_test_mean_error(&specRe[f*bins], refRe, bins));
+            assert_true(1E-5 > mc_test_mean_error(&specIm[f*bins], refIm, bins));
+        }
+
+        /* Overlap-add synthesis gives input back delayed by N - hop */
+        mc_istft_process(&stftObj.context, specRe, specIm, 1u, out);
+        mc_istft_process(&stftObj.context, &specRe[bins], &specIm[bins], frames - 1u, &out[hop]);
+        assert_true(1E-5 > mc_test_mean_error(&out[fftLength - hop], in, frames*hop - (fftLength - hop)));
+        mc_stft_free(&stftObj);
+    }
+    mc_fft_free(&fftObj);
+    free(in);
+    free(out);
+    free(specRe);
+    free(specIm);
+}
+
+#define MC_TEST_WELCH_POW2 (8u)
+#define MC_TEST_WELCH_SIGNAL (5000u)
+
+static void cmocka_welch_match_direct(void **state) {
+    const uint32_t fftLength = 1u<<MC_TEST_WELCH_POW2;
+    const uint32_t bins = MC_STFT_BINS(MC_TEST_WELCH_POW2);
+    /* Hop and input chunk: odd/even number of segments, chunks shorter than hop */
+    const uint32_t configs[][2] = {{128u, 1000u}, {100u, 37u}, {256u, 5000u}};
+    float *in = malloc(sizeof(float)*MC_TEST_WELCH_SIGNAL);
+    float psd[MC_STFT_BINS(MC_TEST_WELCH_POW2)];
+    float ref[MC_STFT_BINS(MC_TEST_WELCH_POW2)];
+    double refRe[1u<<MC_TEST_WELCH_POW2];
+    mc_welch_object_t welchObj;
+    (void)state;
+
+    memset(in, 0, sizeof(float)*MC_TEST_WELCH_SIGNAL);
+    mc_test_add_sinwave(in, MC_TEST_WELCH_SIGNAL, 0.8f, 1000.f, MC_TEST_FS);
+    mc_test_add_sinwave(in, MC_TEST_WELCH_SIGNAL, 0.1f, 5500.f, MC_TEST_FS);
+    for (uint32_t c = 0; c < MC_ARRAY_LENGTH(configs); ++c) {
+        const uint32_t hop = configs[c][0];
+        const uint32_t segments = (MC_TEST_WELCH_SIGNAL - fftLength)/hop + 1u;
+        double windowPower = 0.;
+        mc_welch_allocate(&welchObj, MC_TEST_WELCH_POW2, hop, MC_STFT_WINDOW_HANN);
+        for (uint32_t offset = 0; offset < MC_TEST_WELCH_SIGNAL; offset += configs[c][1]) {
+            uint32_t length = MC_TEST_WELCH_SIGNAL - offset;
+            length = (length > configs[c][1]) ? configs[c][1] : length;
+            mc_welch_process(&welchObj.context, &in[offset], length);
+        }
+        assert_int_equal(segments, mc_welch_get_segment_count(&welchObj.context));
+        mc_welch_get_psd(&welchObj.context, psd, MC_TEST_FS);
+
+        /* Direct DFT of every windowed segment */
+        for (uint32_t i = 0; i < fftLength; ++i) {
+            windowPower += (double)welchObj.context.window[i]*(double)welchObj.context.window[i];
+        }
+        for (uint32_t k = 0; k < bins; ++k) {
+            double acc = 0.;
+            for (uint32_t s = 0; s < segments; ++s) {
+                double accRe = 0., accIm = 0.;
+                for (uint32_t i = 0; i < fftLength; ++i) {
+                    refRe[i] = (double)in[s*hop + i]*(double)welchObj.context.window[i];
+                    accRe += refRe[i]*cos(2.*(double)MC_PI*(double)((k*i) % fftLength)/(double)fftLength);
+                    accIm -= refRe[i]*sin(2.*(double)MC_PI*(double)((k*i) % fftLength)/(double)fftLength);
+                }
+                acc += accRe*accRe + accIm*accIm;
+            }
+            acc *= (((0 == k) || ((bins - 1u) == k)) ? 1. : 2.) / ((double)MC_TEST_FS*windowPower*(double)segments);
+            ref[k] = (float)acc;
+        }
+        for (uint32_t k = 0; k < bins; ++k) {
+            assert_float_equal(ref[k], psd[k], 1E-4f*ref[k] + 1E-9f);
+        }
+        /* Reset drops everything */
+        mc_welch_reset(&welchObj.context);
+        assert_int_equal(0, mc_welch_get_segment_count(&welchObj.context));
+        mc_welch_free(&welchObj);
+    }
+    free(in);
+}
+
+static void cmocka_prune_match_full(void **state) {
+    /* power2, non-zero input, the first bin, number of bins, expected pruned input and output blocks (power of 2) */
+    const uint32_t configs[][6] = {{12u, 256u, 0, 4096u, 8u, 0}, {11u, 100u, 0, 2048u, 7u, 0},
+                                   {12u, 4096u, 1000u, 64u, 12u, 6u}, {11u, 2048u, 2040u, 8u, 11u, 7u},
+                                   {12u, 200u, 50u, 100u, 8u, 4u}, {10u, 1024u, 0, 1024u, 10u, 0},
+                                   {13u, 300u, 0, 8u, 13u, 13u}};
+    float *re = malloc(sizeof(float)*MC_MAX_FFT_LENGTH);
+    float *im = malloc(sizeof(float)*MC_MAX_FFT_LENGTH);
+    float *in = malloc(sizeof(float)*MC_MAX_FFT_LENGTH);
+    float *outRe = malloc(sizeof(float)*MC_MAX_FFT_LENGTH);
+    float *outIm = malloc(sizeof(float)*MC_MAX_FFT_LENGTH);
+    mc_fft_object_t fftObj;
+    mc_fft_prune_object_t pruneObj;
+    (void)state;
+
+    for (uint32_t c = 0; c < MC_ARRAY_LENGTH(configs); ++c) {
+        const uint32_t fftLength = 1u<<configs[c][0];
+        const uint32_t inLength = configs[c][1];
+        const uint32_t outStart = configs[c][2];
+        const uint32_t outLength = configs[c][3];
+        memset(in, 0, sizeof(float)*fftLength);
+        mc_test_add_sinwave(in, inLength, 0.8f, 1000.f, MC_TEST_FS);
+        mc_test_add_sinwave(in, inLength, 0.5f, 4500.f, MC_TEST_FS);
+        memcpy(re, in, sizeof(float)*fftLength);
+        memset(im, 0, sizeof(float)*fftLength);
+        mc_fft_allocate(&fftObj, configs[c][0]);
+        mc_fft_mono(&fftObj.context, re, im, fftLength);
+        mc_fft_free(&fftObj);
+
+        mc_fft_prune_allocate(&pruneObj, configs[c][0], inLength, outStart, outLength);
+        assert_int_equal(configs[c][4], pruneObj.context.inPow2);
+        assert_int_equal(configs[c][5], pruneObj.context.outPow2);
+        /* Real input */
+        mc_fft_prune(&pruneObj.context, in, NULL, outRe, outIm);
+        assert_true(1E-4 > mc_test_mean_error(outRe, &re[outStart], outLength));
+        assert_true(1E-4 > mc_test_mean_error(outIm, &im[outStart], outLength));
+        /* Complex input: x + jx gives (1+j)X */
+        mc_fft_prune(&pruneObj.context, in, in, outRe, outIm);
+        for (uint32_t k = 0; k < outLength; ++k) {
+            assert_float_equal(re[outStart + k] - im[outStart + k], outRe[k], 1E-2f);
+            assert_float_equal(re[outStart + k] + im[outStart + k], outIm[k], 1E-2f);
+        }
+        mc_fft_prune_free(&pruneObj);
+    }
+    free(re);
+    free(im);
+    free(in);
+    free(outRe);
+    free(outIm);
+}
+
+#define MC_TEST_SDFT_POW2 (8u)
+#define MC_TEST_SDFT_SIGNAL (3000u)
+
+static void cmocka_sdft_match_fft(void **state) {
+    const uint32_t fftLength = 1u<<MC_TEST_SDFT_POW2;
+    /* variant, the first bin, number of bins, resync period, tolerance (1E-4): classic drifts without resync */
+    const uint32_t configs[][5] = {{MC_SDFT_CLASSIC, 0, 256u, 0, 1000u}, {MC_SDFT_MODULATED, 0, 256u, 0, 10u},
+                                   {MC_SDFT_CLASSIC, 13u, 21u, 700u, 100u}, {MC_SDFT_MODULATED, 101u, 3u, 0, 10u},
+                                   {MC_SDFT_MODULATED, 30u, 77u, 1000u, 10u}};
+    float *in = malloc(sizeof(float)*MC_TEST_SDFT_SIGNAL);
+    float re[1u<<MC_TEST_SDFT_POW2];
+    float im[1u<<MC_TEST_SDFT_POW2];
+    float outRe[1u<<MC_TEST_SDFT_POW2];
+    float outIm[1u<<MC_TEST_SDFT_POW2];
+    mc_fft_object_t fftObj;
+    mc_sdft_object_t sdftObj;
+    (void)state;
+
+    memset(in, 0, sizeof(float)*MC_TEST_SDFT_SIGNAL);
+    mc_test_add_sinwave(in, MC_TEST_SDFT_SIGNAL, 0.8f, 1000.f, MC_TEST_FS);
+    mc_test_add_sinwave(in, MC_TEST_SDFT_SIGNAL, 0.3f, 3300.f, MC_TEST_FS);
+    mc_fft_allocate(&fftObj, MC_TEST_SDFT_POW2);
+    for (uint32_t c = 0; c < MC_ARRAY_LENGTH(configs); ++c) {
+        const uint32_t binStart = configs[c][1];
+        const uint32_t binCount = configs[c][2];
+        const float tolerance = 1E-4f*(float)configs[c][4];
+        mc_sdft_allocate(&sdftObj, MC_TEST_SDFT_POW2, configs[c][0], binStart, binCount, configs[c][3]);
+        /* Initialisation by the first frame, then sample by sample and by chunks */
+        mc_sdft_init(&sdftObj.context, in);
+        for (uint32_t n = fftLength; n < MC_TEST_SDFT_SIGNAL;) {
+            uint32_t length = (n < 1000u) ? 1u : 37u;
+            length = ((n + length) > MC_TEST_SDFT_SIGNAL) ? (MC_TEST_SDFT_SIGNAL - n) : length;
+            mc_sdft_process(&sdftObj.context, &in[n], length);
+            n += length;
+            if ((n < 1000u) && (n % 97u)) {
+                continue;
+            }
+            memcpy(re, &in[n - fftLength], sizeof(re));
+            memset(im, 0, sizeof(im));
+            mc_fft_mono(&fftObj.context, re, im, fftLength);
+            mc_sdft_get_spectrum(&sdftObj.context, outRe, outIm);
+            for (uint32_t k = 0; k < binCount; ++k) {
+                assert_float_equal(re[binStart + k], outRe[k], tolerance);
+                assert_float_equal(im[binStart + k], outIm[k], tolerance);
+            }
+        }
+        mc_sdft_free(&sdftObj);
+    }
+    mc_fft_free(&fftObj);
+    free(in);
+}
+
+static void mc_test_pool_task(void *arg, uint32_t index, uint32_t thread) {
+    uint32_t *counters = (uint32_t*)arg;
+    (void)thread;
+    counters[index] += index + 1u;
+}
+
+static void cmocka_thread_pool_run(void **state) {
+    uint32_t counters[100];
+    mc_thread_pool_t pool;
+    (void)state;
+    mc_thread_pool_create(&pool, 4u);
+    memset(counters, 0, sizeof(counters));
+    /* Every task is executed exactly once per job, back-to-back jobs of different size */
+    for (uint32_t run = 0; run < 200u; ++run) {
+        mc_thread_pool_run(&pool, mc_test_pool_task, counters, (run % 2u) ? 100u : 37u);
+    }
+    for (uint32_t i = 0; i < 100u; ++i) {
+        assert_int_equal(((i < 37u) ? 200u : 100u)*(i + 1u), counters[i]);
+    }
+    mc_thread_pool_destroy(&pool);
+}
+
+static void cmocka_parallel_match_mono(void **state) {
+    /* power2, threads: below threshold, single thread, odd split and beyond MC_MAX_FFT_LENGTH */
+    const uint32_t configs[][2] = {{12u, 2u}, {14u, 1u}, {14u, 4u}, {13u, 3u}, {16u, 4u}};
+    float *re = malloc(sizeof(float)*(1u<<16u));
+    float *im = malloc(sizeof(float)*(1u<<16u));
+    float *in = malloc(sizeof(float)*(1u<<16u));
+    float *refRe = malloc(sizeof(float)*MC_MAX_FFT_LENGTH);
+    float *refIm = malloc(sizeof(float)*MC_MAX_FFT_LENGTH);
+    mc_fft_object_t fftObj;
+    mc_fft_parallel_object_t parObj;
+    mc_thread_pool_t pool;
+    (void)state;
+
+    for (uint32_t c = 0; c < MC_ARRAY_LENGTH(configs); ++c) {
+        const uint32_t fftLength = 1u<<configs[c][0];
+        memset(in, 0, sizeof(float)*fftLength);
+        mc_test_add_sinwave(in, fftLength, 0.8f, 1000.f, MC_TEST_FS);
+        mc_test_add_sinwave(in, fftLength, 0.5f, 4500.f, MC_TEST_FS);
+        memcpy(re, in, sizeof(float)*fftLength);
+        for (uint32_t i = 0; i < fftLength; ++i) {
+            im[i] = 0.25f*in[(i*7u) & (fftLength - 1u)];
+        }
+        mc_thread_pool_create(&pool, configs[c][1]);
+        mc_fft_parallel_allocate(&parObj, configs[c][0], configs[c][1]);
+        mc_fft_parallel(&parObj.context, &pool, re, im, fftLength);
+        if (MC_MAX_FFT_LENGTH >= fftLength) {
+            memcpy(refRe, in, sizeof(float)*fftLength);
+            for (uint32_t i = 0; i < fftLength; ++i) {
+                refIm[i] = 0.25f*in[(i*7u) & (fftLength - 1u)];
+            }
+            mc_fft_allocate(&fftObj, configs[c][0]);
+            mc_fft_mono(&fftObj.context, refRe, refIm, fftLength);
+            mc_fft_free(&fftObj);
+            assert_true(1E-3 > mc_test_mean_error(refRe, re, fftLength));
+            assert_true(1E-3 > mc_test_mean_error(refIm, im, fftLength));
+        } else {
+            /* Direct DFT of some bins */
+            const uint32_t bins[] = {0, 1u, 4096u, 28000u, fftLength - 1u};
+            for (uint32_t b = 0; b < MC_ARRAY_LENGTH(bins); ++b) {
+                double accRe = 0., accIm = 0.;
+                for (uint32_t i = 0; i < fftLength; ++i) {
+                    const double angle = 2.*(double)MC_PI*(double)(((uint64_t)bins[b]*i) % fftLength)/(double)fftLength;
+                    const double xRe = (double)in[i];
+                    const double xIm = 0.25*(double)in[(i*7u) & (fftLength - 1u)];
+                    accRe += xRe*cos(angle) + xIm*sin(angle);
+                    accIm += xIm*cos(angle) - xRe*sin(angle);
+                }
+                assert_float_equal(accRe, re[bins[b]], 2E-2);
+                assert_float_equal(accIm, im[bins[b]], 2E-2);
+            }
+        }
+        /* Round trip */
+        mc_ifft_parallel(&parObj.context, &pool, re, im, fftLength);
+        mc_fft_norm(re, im, fftLength);
+        assert_true(1E-5 > mc_test_mean_error(in, re, fftLength));
+        mc_fft_parallel_free(&parObj);
+        mc_thread_pool_destroy(&pool);
+    }
+    free(re);
+    free(im);
+    free(in);
+    free(refRe);
+    free(refIm);
+}
+
+/* Executor of user: tasks in reverse order on caller's thread */
+static void mc_test_batch_executor(void *executor, mc_thread_task_t task, void *arg, uint32_t tasks) {
+    uint32_t *calls = (uint32_t*)executor;
+    for (uint32_t i = tasks; i > 0; --i) {
+        task(arg, i - 1u, (i - 1u) % 2u);
+    }
+    ++(*calls);
+}
+
+#define MC_TEST_BATCH_JOBS (24u)
+#define MC_TEST_BATCH_FILTER (8u)
+
+static void cmocka_batch_match_mono(void **state) {
+    /* Mixed lengths share plans: big jobs first, then many small ones */
+    const uint32_t powers[MC_TEST_BATCH_JOBS] = {12u, 12u, 11u, 5u, 6u, 7u, 8u, 5u, 10u, 9u, 5u, 6u, 
+                                                 7u, 5u, 8u, 6u, 5u, 12u, 7u, 5u, 6u, 9u, 5u, 10u};
+    const float filter[MC_TEST_BATCH_FILTER] = {0.5f, -0.25f, 0.125f, 0.f, 0.3f, 0.f, -0.1f, 0.05f};
+    mc_fft_object_t plans[13];
+    mc_batch_job_t jobs[MC_TEST_BATCH_JOBS];
+    float *in[MC_TEST_BATCH_JOBS];
+    float *filterSpectrum[MC_TEST_BATCH_JOBS];
+    float ref[2u*4096u];
+    mc_batch_object_t batchObj;
+    mc_thread_pool_t pool;
+    uint32_t calls = 0;
+    (void)state;
+    for (uint32_t p = 5u; p <= 12u; ++p) {
+        mc_fft_allocate(&plans[p], p);
+    }
+    for (uint32_t j = 0; j < MC_TEST_BATCH_JOBS; ++j) {
+        const uint32_t fftLength = 1u<<powers[j];
+        in[j] = malloc(2u*sizeof(float)*fftLength);
+        filterSpectrum[j] = malloc(2u*sizeof(float)*fftLength);
+        memset(in[j], 0, 2u*sizeof(float)*fftLength);
+        mc_test_add_sinwave(in[j], fftLength, 0.8f, 500.f + 100.f*j, MC_TEST_FS);
+        mc_test_add_sinwave(&in[j][fftLength], fftLength, 0.3f, 3000.f, MC_TEST_FS);
+        /* Filter spectrum: natural order scaled by 1/N, then scrambled */
+        memset(filterSpectrum[j], 0, 2u*sizeof(float)*fftLength);
+        for (uint32_t i = 0; i < MC_TEST_BATCH_FILTER; ++i) {
+            filterSpectrum[j][i] = filter[i]/(float)fftLength;
+        }
+        mc_fft_mono(&plans[powers[j]].context, filterSpectrum[j], &filterSpectrum[j][fftLength], fftLength);
+        mc_fft_scramble(&plans[powers[j]].context, filterSpectrum[j], &filterSpectrum[j][fftLength], fftLength);
+        jobs[j].fft = &plans[powers[j]].context;
+        jobs[j].filterRe = filterSpectrum[j];
+        jobs[j].filterIm = &filterSpectrum[j][fftLength];
+        jobs[j].length = fftLength;
+        jobs[j].type = j % 3u;
+    }
+    mc_thread_pool_create(&pool, 4u);
+    mc_batch_allocate(&batchObj, 12u, 4u);
+    /* Thread pool, user's executor (2 of 4 threads), caller's thread */
+    for (uint32_t run = 0; run < 3u; ++run) {
+        for (uint32_t j = 0; j < MC_TEST_BATCH_JOBS; ++j) {
+            jobs[j].re = malloc(2u*sizeof(float)<<powers[j]);
+            jobs[j].im = &jobs[j].re[1u<<powers[j]];
+            memcpy(jobs[j].re, in[j], 2u*sizeof(float)<<powers[j]);
+        }
+        mc_batch_set_executor(&batchObj.context, (1u == run) ? mc_test_batch_executor : NULL, &calls);
+        mc_batch_run(&batchObj.context, (0 == run) ? &pool : NULL, jobs, MC_TEST_BATCH_JOBS);
+        for (uint32_t j = 0; j < MC_TEST_BATCH_JOBS; ++j) {
+            const uint32_t fftLength = 1u<<powers[j];
+            memcpy(ref, in[j], 2u*sizeof(float)*fftLength);
+            if (MC_BATCH_FFT == jobs[j].type) {
+                mc_fft_mono(&plans[powers[j]].context, ref, &ref[fftLength], fftLength);
+            } else if (MC_BATCH_IFFT == jobs[j].type) {
+                mc_ifft_mono(&plans[powers[j]].context, ref, &ref[fftLength], fftLength);
+            } else {
+                /* Direct circular convolution */
+                for (uint32_t n = 0; n < fftLength; ++n) {
+                    float accRe = 0.f, accIm = 0.f;
+                    for (uint32_t k = 0; k < MC_TEST_BATCH_FILTER; ++k) {
+                        accRe += filter[k]*in[j][(n - k) & (fftLength - 1u)];
+                        accIm += filter[k]*in[j][fftLength + ((n - k) & (fftLength - 1u))];
+                    }
+                    ref[n] = accRe;
+                    ref[fftLength + n] = accIm;
+                }
+            }
+            assert_true(1E-4 > mc_test_mean_error(ref, jobs[j].re, 2u*fftLength)/((MC_BATCH_CONV == jobs[j].type) ? 1.f : (float)fftLength));
+            free(jobs[j].re);
+        }
+    }
+    assert_int_equal(1u, calls);
+    mc_batch_free(&batchObj);
+    mc_thread_pool_destroy(&pool);
+    for (uint32_t p = 5u; p <= 12u; ++p) {
+        mc_fft_free(&plans[p]);
+    }
+    for (uint32_t j = 0; j < MC_TEST_BATCH_JOBS; ++j) {
+        free(in[j]);
+        free(filterSpectrum[j]);
+    }
+}
+
+static void mc_test_async_callback(void *user, const mc_batch_job_t *job) {
+    (void)job;
+    *(volatile uint32_t*)user = 1u;
+}
+
+#define MC_TEST_ASYNC_JOBS (40u)
+
+static void cmocka_async_match_mono(void **state) {
+    float *in = malloc(2u*sizeof(float)*1024u);
+    float *ref = malloc(2u*sizeof(float)*1024u);
+    float *data[MC_TEST_ASYNC_JOBS];
+    volatile uint32_t done[MC_TEST_ASYNC_JOBS];
+    mc_batch_job_t jobs[MC_TEST_ASYNC_JOBS];
+    mc_fft_object_t plans[11];
+    mc_async_object_t asyncObj;
+    void *user = NULL;
+    (void)state;
+    for (uint32_t p = 6u; p <= 10u; ++p) {
+        mc_fft_allocate(&plans[p], p);
+    }
+    memset(in, 0, 2u*sizeof(float)*1024u);
+    mc_test_add_sinwave(in, 1024u, 0.8f, 1000.f, MC_TEST_FS);
+    mc_test_add_sinwave(&in[1024u], 1024u, 0.3f, 3000.f, MC_TEST_FS);
+    for (uint32_t j = 0; j < MC_TEST_ASYNC_JOBS; ++j) {
+        const uint32_t power2 = 6u + (j % 5u);
+        data[j] = malloc(2u*sizeof(float)<<power2);
+        memcpy(data[j], in, sizeof(float)<<power2);
+        memcpy(&data[j][1u<<power2], &in[1024u], sizeof(float)<<power2);
+        done[j] = 0;
+        memset(&jobs[j], 0, sizeof(jobs[j]));
+        jobs[j].fft = &plans[power2].context;
+        jobs[j].re = data[j];
+        jobs[j].im = &data[j][1u<<power2];
+        jobs[j].length = 1u<<power2;
+        jobs[j].type = (j % 4u) ? MC_BATCH_FFT : MC_BATCH_IFFT;
+    }
+
+    /* Capacity is exhausted without workers, jobs are processed by caller */
+    mc_async_allocate(&asyncObj, 10u, 0, 8u);
+    for (uint32_t j = 0; j < 8u; ++j) {
+        assert_int_equal(1u, mc_async_submit(&asyncObj.context, &jobs[j], NULL, (void*)&done[j]));
+    }
+    assert_int_equal(0, mc_async_submit(&asyncObj.context, &jobs[8u], NULL, (void*)&done[8u]));
+    assert_int_equal(0, mc_async_poll(&asyncObj.context, &user));
+    assert_int_equal(8u, mc_async_process(&asyncObj.context, 100u));
+    for (uint32_t j = 0; j < 8u; ++j) {
+        assert_int_equal(1u, mc_async_poll(&asyncObj.context, &user));
+        assert_ptr_equal((void*)&done[j], user);
+        *(volatile uint32_t*)user = 1u;
+    }
+    assert_int_equal(0, mc_async_pending(&asyncObj.context));
+    mc_async_free(&asyncObj);
+
+    /* Workers: callbacks and polling mixed, submitter retries when capacity is exhausted */
+    mc_async_allocate(&asyncObj, 10u, 2u, 8u);
+    for (uint32_t j = 8u; j < MC_TEST_ASYNC_JOBS; ++j) {
+        mc_async_callback_t callback = (j % 2u) ? mc_test_async_callback : NULL;
+        while (!mc_async_submit(&asyncObj.context, &jobs[j], callback, (void*)&done[j])) {
+            /* Caller helps workers (the only worker if threads are excluded) */
+            mc_async_process(&asyncObj.context, 1u);
+            while (mc_async_poll(&asyncObj.context, &user)) {
+                *(volatile uint32_t*)user = 1u;
+            }
+        }
+    }
+    while (mc_async_pending(&asyncObj.context) > 0) {
+        mc_async_process(&asyncObj.context, 1u);
+        while (mc_async_poll(&asyncObj.context, &user)) {
+            *(volatile uint32_t*)user = 1u;
+        }
+    }
+    mc_async_free(&asyncObj);
+
+    for (uint32_t j = 0; j < MC_TEST_ASYNC_JOBS; ++j) {
+        const uint32_t fftLength = jobs[j].length;
+        assert_int_equal(1u, done[j]);
+        memcpy(ref, in, sizeof(float)*fftLength);
+        memcpy(&ref[fftLength], &in[1024u], sizeof(float)*fftLength);
+        if (MC_BATCH_FFT == jobs[j].type) {
+            mc_fft_mono(jobs[j].fft, ref, &ref[fftLength], fftLength);
+        } else {
+            mc_ifft_mono(jobs[j].fft, ref, &ref[fftLength], fftLength);
+        }
+        assert_true(1E-6 > mc_test_mean_error(ref, data[j], 2u*fftLength)/(float)fftLength);
+        free(data[j]);
+    }
+    for (uint32_t p = 6u; p <= 10u; ++p) {
+        mc_fft_free(&plans[p]);
+    }
+    free(in);
+    free(ref);
+}
+
+static void mc_test_async_count(void *user, const mc_batch_job_t *job) {
+    (void)job;
+    ++*(volatile uint32_t*)user;
+}
+
+#define MC_TEST_ASYNC_STRESS_JOBS (4096u)
+
+static void cmocka_async_stress_capacity(void **state) {
+    /* Capacity 2 and more workers than capacity: cell of submission queue can be held by preempted worker
+     * while other job is already polled, submit must fail without losing capacity */
+    float *data = malloc(2u*sizeof(float)*64u*MC_TEST_ASYNC_STRESS_JOBS);
+    uint32_t *done = calloc(MC_TEST_ASYNC_STRESS_JOBS, sizeof(uint32_t));
+    mc_batch_job_t job;
+    mc_fft_object_t plan;
+    mc_async_object_t asyncObj;
+    void *user = NULL;
+    (void)state;
+    mc_fft_allocate(&plan, 6u);
+    memset(data, 0, 2u*sizeof(float)*64u*MC_TEST_ASYNC_STRESS_JOBS);
+    memset(&job, 0, sizeof(job));
+    job.fft = &plan.context;
+    job.length = 64u;
+    job.type = MC_BATCH_FFT;
+    mc_async_allocate(&asyncObj, 6u, 3u, 2u);
+    for (uint32_t j = 0; j < MC_TEST_ASYNC_STRESS_JOBS; ++j) {
+        mc_async_callback_t callback = (j % 2u) ? mc_test_async_count : NULL;
+        job.re = &data[128u*j];
+        job.im = &data[128u*j + 64u];
+        while (!mc_async_submit(&asyncObj.context, &job, callback, (void*)&done[j])) {
+            /* Caller helps workers (the only worker if threads are excluded) */
+            mc_async_process(&asyncObj.context, 1u);
+            while (mc_async_poll(&asyncObj.context, &user)) {
+                ++*(uint32_t*)user;
+            }
+        }
+    }
+    while (mc_async_pending(&asyncObj.context) > 0) {
+        mc_async_process(&asyncObj.context, 1u);
+        while (mc_async_poll(&asyncObj.context, &user)) {
+            ++*(uint32_t*)user;
+        }
+    }
+    for (uint32_t j = 0; j < MC_TEST_ASYNC_STRESS_JOBS; ++j) {
+        assert_int_equal(1u, done[j]);
+    }
+    /* Whole capacity is available when workers are stopped */
+    mc_async_stop(&asyncObj.context);
+    assert_int_equal(1u, mc_async_submit(&asyncObj.context, &job, NULL, (void*)&done[0]));
+    assert_int_equal(1u, mc_async_submit(&asyncObj.context, &job, NULL, (void*)&done[0]));
+    assert_int_equal(0, mc_async_submit(&asyncObj.context, &job, NULL, (void*)&done[0]));
+    mc_async_free(&asyncObj);
+    mc_fft_free(&plan);
+    free(done);
+    free(data);
+}
+
+/* Reference 2-D FFT: rows, then gathered columns by mc_fft_mono() */
+static void mc_test_fft_2d_ref(float *re, float *im, uint32_t widthPow2, uint32_t heightPow2) {
+    const uint32_t width = 1u<<widthPow2;
+    const uint32_t height = 1u<<heightPow2;
+    float colRe[1024], colIm[1024];
+    mc_fft_object_t rowObj, colObj;
+    mc_fft_allocate(&rowObj, widthPow2);
+    mc_fft_allocate(&colObj, heightPow2);
+    for (uint32_t r = 0; r < height; ++r) {
+        mc_fft_mono(&rowObj.context, &re[r*width], &im[r*width], width);
+    }
+    for (uint32_t c = 0; c < width; ++c) {
+        for (uint32_t r = 0; r < height; ++r) {
+            colRe[r] = re[r*width + c];
+            colIm[r] = im[r*width + c];
+        }
+        mc_fft_mono(&colObj.context, colRe, colIm, height);
+        for (uint32_t r = 0; r < height; ++r) {
+            re[r*width + c] = colRe[r];
+            im[r*width + c] = colIm[r];
+        }
+    }
+    mc_fft_free(&rowObj);
+    mc_fft_free(&colObj);
+}
+
+static void cmocka_fft_2d_match_mono(void **state) {
+    /* widthPow2, heightPow2, mode, threads */
+    const uint32_t configs[][4] = {{6u, 5u, MC_FFT_2D_VERTICAL, 1u}, {5u, 7u, MC_FFT_2D_TRANSPOSE, 3u}, 
+                                   {7u, 6u, MC_FFT_2D_VERTICAL, 2u}, {6u, 10u, MC_FFT_2D_TRANSPOSE, 4u}};
+    const uint32_t maxLength = 1u<<16u;
+    float *in = malloc(2u*sizeof(float)*maxLength);
+    float *re = malloc(sizeof(float)*maxLength);
+    float *im = malloc(sizeof(float)*maxLength);
+    float *refRe = malloc(sizeof(float)*maxLength);
+    float *refIm = malloc(sizeof(float)*maxLength);
+    mc_fft_2d_object_t obj;
+    mc_thread_pool_t pool;
+    (void)state;
+    for (uint32_t i = 0; i < 2u*maxLength; ++i) {
+        in[i] = (float)((i*2654435761u) % 1000u)/500.f - 1.f;
+    }
+    for (uint32_t c = 0; c < MC_ARRAY_LENGTH(configs); ++c) {
+        const uint32_t length = 1u<<(configs[c][0] + configs[c][1]);
+        mc_thread_pool_create(&pool, configs[c][3]);
+        mc_fft_2d_allocate(&obj, configs[c][0], configs[c][1], configs[c][2], configs[c][3]);
+        /* Complex */
+        memcpy(re, in, sizeof(float)*length);
+        memcpy(im, &in[maxLength], sizeof(float)*length);
+        memcpy(refRe, re, sizeof(float)*length);
+        memcpy(refIm, im, sizeof(float)*length);
+        mc_fft_2d(&obj.context, &pool, re, im);
+        mc_test_fft_2d_ref(refRe, refIm, configs[c][0], configs[c][1]);
+        assert_true(1E-3 > mc_test_mean_error(refRe, re, length)/sqrtf((float)length));
+        assert_true(1E-3 > mc_test_mean_error(refIm, im, length)/sqrtf((float)length));
+        mc_ifft_2d(&obj.context, &pool, re, im);
+        mc_fft_norm(re, im, length);
+        assert_true(1E-5 > mc_test_mean_error(in, re, length));
+        assert_true(1E-5 > mc_test_mean_error(&in[maxLength], im, length));
+        /* Real */
+        memcpy(re, in, sizeof(float)*length);
+        memcpy(refRe, re, sizeof(float)*length);
+        memset(refIm, 0, sizeof(float)*length);
+        mc_fft_2d_real(&obj.context, (1u == configs[c][3]) ? NULL : &pool, re, im);
+        mc_test_fft_2d_ref(refRe, refIm, configs[c][0], configs[c][1]);
+        assert_true(1E-3 > mc_test_mean_error(refRe, re, length)/sqrtf((float)length));
+        assert_true(1E-3 > mc_test_mean_error(refIm, im, length)/sqrtf((float)length));
+        mc_fft_2d_free(&obj);
+        mc_thread_pool_destroy(&pool);
+    }
+    free(in);
+    free(re);
+    free(im);
+    free(refRe);
+    free(refIm);
+}
+
+/* Reference 3-D FFT: gathered pencils of every axis by mc_fft_mono() */
+static void mc_test_fft_3d_ref(float *re, float *im, const uint32_t *powers) {
+    const uint32_t strides[3] = {1u, 1u<<powers[0], 1u<<(powers[0] + powers[1])};
+    const uint32_t volume = 1u<<(powers[0] + powers[1] + powers[2]);
+    float pencilRe[128], pencilIm[128];
+    for (uint32_t axis = 0; axis < 3u; ++axis) {
+        const uint32_t length = 1u<<powers[axis];
+        mc_fft_object_t fftObj;
+        mc_fft_allocate(&fftObj, powers[axis]);
+        for (uint32_t start = 0; start < volume; ++start) {
+            /* First point of pencil has zero coordinate along axis */
+            if ((start / strides[axis]) % length) {
+                continue;
+            }
+            for (uint32_t i = 0; i < length; ++i) {
+                pencilRe[i] = re[start + i*strides[axis]];
+                pencilIm[i] = im[start + i*strides[axis]];
+            }
+            mc_fft_mono(&fftObj.context, pencilRe, pencilIm, length);
+            for (uint32_t i = 0; i < length; ++i) {
+                re[start + i*strides[axis]] = pencilRe[i];
+                im[start + i*strides[axis]] = pencilIm[i];
+            }
+        }
+        mc_fft_free(&fftObj);
+    }
+}
+
+static void cmocka_fft_3d_match_mono(void **state) {
+    /* widthPow2, heightPow2, depthPow2, mode, threads */
+    const uint32_t configs[][5] = {{5u, 5u, 5u, MC_FFT_3D_VERTICAL, 2u}, {6u, 5u, 7u, MC_FFT_3D_VERTICAL, 1u},
+                                   {5u, 7u, 6u, MC_FFT_3D_TRANSPOSE, 3u}};
+    const uint32_t maxLength = 1u<<18u;
+    float *in = malloc(2u*sizeof(float)*maxLength);
+    float *re = malloc(sizeof(float)*maxLength);
+    float *im = malloc(sizeof(float)*maxLength);
+    float *refRe = malloc(sizeof(float)*maxLength);
+    float *refIm = malloc(sizeof(float)*maxLength);
+    mc_fft_3d_object_t obj;
+    mc_thread_pool_t pool;
+    (void)state;
+    for (uint32_t i = 0; i < 2u*maxLength; ++i) {
+        in[i] = (float)((i*2654435761u) % 1000u)/500.f - 1.f;
+    }
+    for (uint32_t c = 0; c < MC_ARRAY_LENGTH(configs); ++c) {
+        const uint32_t length = 1u<<(configs[c][0] + configs[c][1] + configs[c][2]);
+        mc_thread_pool_create(&pool, configs[c][4]);
+        mc_fft_3d_allocate(&obj, configs[c][0], configs[c][1], configs[c][2], configs[c][3], configs[c][4]);
+        memcpy(re, in, sizeof(float)*length);
+        memcpy(im, &in[maxLength], sizeof(float)*length);
+        memcpy(refRe, re, sizeof(float)*length);
+        memcpy(refIm, im, sizeof(float)*length);
+        mc_fft_3d(&obj.context, (1u == configs[c][4]) ? NULL : &pool, re, im);
+        mc_test_fft_3d_ref(refRe, refIm, configs[c]);
+        assert_true(1E-3 > mc_test_mean_error(refRe, re, length)/sqrtf((float)length));
+        assert_true(1E-3 > mc_test_mean_error(refIm, im, length)/sqrtf((float)length));
+        mc_ifft_3d(&obj.context, &pool, re, im);
+        mc_fft_norm(re, im, length);
+        assert_true(1E-5 > mc_test_mean_error(in, re, length));
+        assert_true(1E-5 > mc_test_mean_error(&in[maxLength], im, length));
+        mc_fft_3d_free(&obj);
+        mc_thread_pool_destroy(&pool);
+    }
+    free(in);
+    free(re);
+    free(im);
+    free(refRe);
+    free(refIm);
+}
+
+static void cmocka_transpose_match_naive(void **state) {
+    /* rows, columns */
+    const uint32_t sizes[][2] = {{64u, 128u}, {37u, 53u}, {8u, 200u}, {100u, 3u}, {48u, 48u}, {45u, 45u}};
+    const uint32_t maxLength = 200u*200u;
+    float *inRe = malloc(sizeof(float)*maxLength);
+    float *inIm = malloc(sizeof(float)*maxLength);
+    float *re = malloc(sizeof(float)*maxLength);
+    float *im = malloc(sizeof(float)*maxLength);
+    (void)state;
+    for (uint32_t i = 0; i < maxLength; ++i) {
+        inRe[i] = (float)i;
+        inIm[i] = -(float)i;
+    }
+    for (uint32_t s = 0; s < MC_ARRAY_LENGTH(sizes); ++s) {
+        const uint32_t rows = sizes[s][0];
+        const uint32_t columns = sizes[s][1];
+        mc_transpose(re, im, inRe, inIm, rows, columns);
+        for (uint32_t r = 0; r < rows; ++r) {
+            for (uint32_t c = 0; c < columns; ++c) {
+                assert_true(inRe[r*columns + c] == re[c*rows + r]);
+                assert_true(inIm[r*columns + c] == im[c*rows + r]);
+            }
+        }
+        if (rows == columns) {
+            memcpy(re, inRe, sizeof(float)*rows*columns);
+            memcpy(im, inIm, sizeof(float)*rows*columns);
+            mc_transpose_square(re, im, rows);
+            for (uint32_t r = 0; r < rows; ++r) {
+                for (uint32_t c = 0; c < columns; ++c) {
+                    assert_true(inRe[r*columns + c] == re[c*rows + r]);
+                    assert_true(inIm[r*columns + c] == im[c*rows + r]);
+                }
+            }
+        }
+    }
+    free(inRe);
+    free(inIm);
+    free(re);
+    free(im);
+}
+
+static double mc_test_dct_ref(uint32_t type, const float *in, uint32_t k, uint32_t length) {
+    const double phi = 3.14159265358979323846/(double)(2u*length);
+    double acc = 0;
+    for (uint32_t n = 0; n < length; ++n) {
+        double basis;
+        switch (type) {
+        case MC_DCT_II: basis = cos(phi*(double)((2u*n + 1u)*k)); break;
+        case MC_DCT_III: basis = (0 == n) ? 0.5 : cos(phi*(double)(n*(2u*k + 1u))); break;
+        case MC_DCT_IV: basis = cos(0.5*phi*(double)((2u*n + 1u)*(2u*k + 1u))); break;
+        case MC_DST_II: basis = sin(phi*(double)((2u*n + 1u)*(k + 1u))); break;
+        case MC_DST_III: basis = ((length - 1u) == n) ? ((k & 1u) ? -0.5 : 0.5) : sin(phi*(double)((n + 1u)*(2u*k + 1u))); break;
+        default: basis = sin(0.5*phi*(double)((2u*n + 1u)*(2u*k + 1u))); break;
+        }
+        acc += basis*(double)in[n];
+    }
+    return acc;
+}
+
+static void cmocka_dct_match_direct(void **state) {
+    /* forward type, inverse type */
+    const uint32_t pairs[][2] = {{MC_DCT_II, MC_DCT_III}, {MC_DCT_III, MC_DCT_II}, {MC_DCT_IV, MC_DCT_IV},
+                                 {MC_DST_II, MC_DST_III}, {MC_DST_III, MC_DST_II}, {MC_DST_IV, MC_DST_IV}};
+    const uint32_t maxLength = 1024u;
+    float *in = malloc(sizeof(float)*maxLength);
+    float *out = malloc(sizeof(float)*maxLength);
+    float *ref = malloc(sizeof(float)*maxLength);
+    mc_dct_object_t fwd, inv;
+    (void)state;
+    for (uint32_t i = 0; i < maxLength; ++i) {
+        in[i] = (float)((i*2654435761u) % 1000u)/500.f - 1.f;
+    }
+    for (uint32_t power2 = 5u; power2 <= 10u; power2 += 1u) {
+        const uint32_t length = 1u<<power2;
+        for (uint32_t p = 0; p < MC_ARRAY_LENGTH(pairs); ++p) {
+            mc_dct_allocate(&fwd, power2, pairs[p][0]);
+            mc_dct_allocate(&inv, power2, pairs[p][1]);
+            for (uint32_t k = 0; k < length; ++k) {
+                ref[k] = (float)mc_test_dct_ref(pairs[p][0], in, k, length);
+            }
+            mc_dct(&fwd.context, out, in);
+            assert_true(1E-4 > mc_test_mean_error(ref, out, length)/sqrtf((float)length));
+            /** In-place inverse: x*N/2 */
+            mc_dct(&inv.context, out, out);
+            for (uint32_t k = 0; k < length; ++k) {
+                out[k] *= 2.f/(float)length;
+            }
+            assert_true(1E-5 > mc_test_mean_error(in, out, length));
+            mc_dct_free(&fwd);
+            mc_dct_free(&inv);
+        }
+    }
+    free(in);
+    free(out);
+    free(ref);
+}
+
+static void cmocka_mdct_match_direct(void **state) {
+    const uint32_t powers[] = {7u, 8u, 11u};
+    const uint32_t frames = 6u;
+    const uint32_t maxLength = 2048u;
+    float *in = malloc(sizeof(float)*maxLength*frames);
+    float *out = malloc(sizeof(float)*maxLength*frames);
+    float *window = malloc(sizeof(float)*maxLength);
+    float *coeffs = malloc(sizeof(float)*maxLength);
+    float *ref = malloc(sizeof(float)*maxLength);
+    mc_mdct_object_t obj;
+    (void)state;
+    for (uint32_t i = 0; i < maxLength*frames; ++i) {
+        in[i] = (float)((i*2654435761u) % 1000u)/500.f - 1.f;
+    }
+    for (uint32_t p = 0; p < MC_ARRAY_LENGTH(powers); ++p) {
+        const uint32_t length = 1u<<powers[p];
+        const uint32_t half = length>>1u;
+        /** Custom window: sine window is passed explicitly for one size */
+        for (uint32_t n = 0; n < length; ++n) {
+            window[n] = sinf(MC_PI*((float)n + 0.5f)/(float)length);
+        }
+        mc_mdct_allocate(&obj, powers[p], (0 == p) ? window : NULL);
+        for (uint32_t k = 0; k < half; ++k) {
+            double acc = 0;
+            for (uint32_t n = 0; n < length; ++n) {
+                acc += (double)(window[n]*in[n])*cos(3.14159265358979323846/(double)half*((double)n + 0.5 + (double)half/2.)*((double)k + 0.5));
+            }
+            ref[k] = (float)acc;
+        }
+        mc_mdct(&obj.context, coeffs, in);
+        assert_true(1E-4 > mc_test_mean_error(ref, coeffs, half)/sqrtf((float)length));
+        /** TDAC: frames with hop M, output is delayed by M samples */
+        for (uint32_t f = 0; (f + 2u) <= (2u*frames); ++f) {
+            mc_mdct(&obj.context, coeffs, &in[f*half]);
+            mc_imdct(&obj.context, &out[f*half], coeffs);
+        }
+        assert_true(1E-5 > mc_test_mean_error(&in[half], &out[half], (2u*frames - 2u)*half));
+        mc_mdct_reset(&obj.context);
+        mc_mdct_free(&obj);
+    }
+    free(in);
+    free(out);
+    free(window);
+    free(coeffs);
+    free(ref);
+}
+
+static void cmocka_channelizer_match_direct(void **state) {
+    /* power2, taps, mode */
+    const uint32_t configs[][3] = {{6u, 4u, MC_CHANNELIZER_CRITICAL}, {6u, 3u, MC_CHANNELIZER_OVERSAMPLED}, 
+                                   {8u, 2u, MC_CHANNELIZER_OVERSAMPLED}};
+    const uint32_t frames = 12u;
+    const uint32_t maxLength = 256u*frames;
+    float *inRe = malloc(sizeof(float)*maxLength);
+    float *inIm = malloc(sizeof(float)*maxLength);
+    float *outRe = malloc(sizeof(float)*256u*frames);
+    float *outIm = malloc(sizeof(float)*256u*frames);
+    float *refRe = malloc(sizeof(float)*256u*frames);
+    float *refIm = malloc(sizeof(float)*256u*frames);
+    mc_channelizer_object_t obj;
+    (void)state;
+    for (uint32_t i = 0; i < maxLength; ++i) {
+        inRe[i] = (float)((i*2654435761u) % 1000u)/500.f - 1.f;
+        inIm[i] = (float)((i*2246822519u) % 1000u)/500.f - 1.f;
+    }
+    for (uint32_t c = 0; c < MC_ARRAY_LENGTH(configs); ++c) {
+        const uint32_t channels = 1u<<configs[c][0];
+        mc_channelizer_allocate(&obj, configs[c][0], configs[c][1], configs[c][2], NULL);
+        const uint32_t decimation = obj.context.decimation;
+        const uint32_t window = configs[c][1]*channels;
+        for (uint32_t t = 0; t < frames; ++t) {
+            for (uint32_t m = 0; m < channels; ++m) {
+                double accRe = 0, accIm = 0;
+                for (uint32_t n = 0; (n < window) && (n <= (t*decimation + decimation - 1u)); ++n) {
+                    const uint32_t i = t*decimation + decimation - 1u - n;
+                    const double phase = -2.*3.14159265358979323846*(double)((m*(t*decimation + channels - n)) % channels)/(double)channels;
+                    const double h = (double)obj.context.filter[n];
+                    accRe += h*((double)inRe[i]*cos(phase) - (double)inIm[i]*sin(phase));
+                    accIm += h*((double)inRe[i]*sin(phase) + (double)inIm[i]*cos(phase));
+                }
+                refRe[t*channels + m] = (float)accRe;
+                refIm[t*channels + m] = (float)accIm;
+            }
+        }
+        /** Two calls: history is kept between calls */
+        mc_channelizer_process(&obj.context, outRe, outIm, inRe, inIm, 5u*decimation);
+        mc_channelizer_process(&obj.context, &outRe[5u*channels], &outIm[5u*channels], &inRe[5u*decimation], 
+                               &inIm[5u*decimation], (frames - 5u)*decimation);
+        assert_true(1E-5 > mc_test_mean_error(refRe, outRe, frames*channels));
+        assert_true(1E-5 > mc_test_mean_error(refIm, outIm, frames*channels));
+        mc_channelizer_free(&obj);
+    }
+    free(inRe);
+    free(inIm);
+    free(outRe);
+    free(outIm);
+    free(refRe);
+    free(refIm);
+}
+
+static void cmocka_goertzel_match_dft(void **state) {
+    const uint32_t power2 = 10u;
+    const uint32_t length = 1u<<power2;
+    const uint32_t methods[] = {MC_GOERTZEL_DIRECT, MC_GOERTZEL_FFT, MC_GOERTZEL_AUTO};
+    uint32_t bins[37], allBins[1024];
+    float inRe[1024], inIm[1024];
+    float outRe[37], outIm[37];
+    float refRe[2][37], refIm[2][37];
+    mc_goertzel_object_t obj;
+    (void)state;
+    for (uint32_t i = 0; i < MC_ARRAY_LENGTH(bins); ++i) {
+        /** Arbitrary order, both ends of spectrum and Nyquist */
+        bins[i] = (0 == i) ? 0 : ((1u == i) ? (length>>1u) : ((i*2654435761u) % length));
+    }
+    for (uint32_t i = 0; i < length; ++i) {
+        inRe[i] = (float)((i*2654435761u) % 1000u)/500.f - 1.f;
+        inIm[i] = (float)((i*2246822519u) % 1000u)/500.f - 1.f;
+    }
+    for (uint32_t k = 0; k < MC_ARRAY_LENGTH(bins); ++k) {
+        double accRe[2] = {0, 0}, accIm[2] = {0, 0};
+        for (uint32_t n = 0; n < length; ++n) {
+            const double phase = -2.*3.14159265358979323846*(double)((bins[k]*n) % length)/(double)length;
+            accRe[0] += (double)inRe[n]*cos(phase);
+            accIm[0] += (double)inRe[n]*sin(phase);
+            accRe[1] += (double)inRe[n]*cos(phase) - (double)inIm[n]*sin(phase);
+            accIm[1] += (double)inRe[n]*sin(phase) + (double)inIm[n]*cos(phase);
+        }
+        for (uint32_t c = 0; c < 2u; ++c) {
+            refRe[c][k] = (float)accRe[c];
+            refIm[c][k] = (float)accIm[c];
+        }
+    }
+    for (uint32_t m = 0; m < MC_ARRAY_LENGTH(methods); ++m) {
+        for (uint32_t count = 5u; count <= MC_ARRAY_LENGTH(bins); count += 16u) {
+            mc_goertzel_allocate(&obj, power2, bins, count, methods[m]);
+            /** Float recursion accumulates round-off over N samples (mostly near bins 0 and N/2) */
+            const double tolerance = (MC_GOERTZEL_DIRECT == obj.context.method) ? 5E-3 : 1E-3;
+            mc_goertzel(&obj.context, outRe, outIm, inRe, NULL);
+            assert_true(tolerance > mc_test_mean_error(refRe[0], outRe, count));
+            assert_true(tolerance > mc_test_mean_error(refIm[0], outIm, count));
+            mc_goertzel(&obj.context, outRe, outIm, inRe, inIm);
+            assert_true(tolerance > mc_test_mean_error(refRe[1], outRe, count));
+            assert_true(tolerance > mc_test_mean_error(refIm[1], outIm, count));
+            mc_goertzel_free(&obj);
+        }
+    }
+    /** A few bins are cheaper by recursion, all bins by FFT */
+    mc_goertzel_allocate(&obj, power2, bins, 8u, MC_GOERTZEL_AUTO);
+    assert_int_equal(MC_GOERTZEL_DIRECT, obj.context.method);
+    mc_goertzel_free(&obj);
+    for (uint32_t i = 0; i < length; ++i) {
+        allBins[i] = i;
+    }
+    mc_goertzel_allocate(&obj, power2, allBins, length, MC_GOERTZEL_AUTO);
+    assert_int_equal(MC_GOERTZEL_FFT, obj.context.method);
+    mc_goertzel_free(&obj);
+}
+
+static void cmocka_fft_multi_match_mono(void **state) {
+    const uint32_t powers[] = {5u, 8u, 11u};
+    const uint32_t channels = 11u;
+    float *re[11], *im[11], *refRe[11], *refIm[11];
+    mc_fft_multi_object_t obj;
+    mc_fft_object_t mono;
+    (void)state;
+    for (uint32_t p = 0; p < MC_ARRAY_LENGTH(powers); ++p) {
+        const uint32_t length = 1u<<powers[p];
+        mc_fft_multi_allocate(&obj, powers[p]);
+        mc_fft_allocate(&mono, powers[p]);
+        for (uint32_t ch = 0; ch < channels; ++ch) {
+            re[ch] = (float*)malloc(sizeof(float)*length);
+            im[ch] = (float*)malloc(sizeof(float)*length);
+            refRe[ch] = (float*)malloc(sizeof(float)*length);
+            refIm[ch] = (float*)malloc(sizeof(float)*length);
+            for (uint32_t i = 0; i < length; ++i) {
+                re[ch][i] = refRe[ch][i] = (float)(((i + 31u*ch)*2654435761u) % 1000u)/500.f - 1.f;
+                im[ch][i] = refIm[ch][i] = (float)(((i + 17u*ch)*2246822519u) % 1000u)/500.f - 1.f;
+            }
+        }
+        /** Same stage kernels in the same order: bit-identical to mono. Default group and group with partial tail */
+        for (uint32_t g = 0; g < 2u; ++g) {
+            obj.context.group = (0 == g) ? MC_FFT_MULTI_GROUP(powers[p]) : 3u;
+            mc_fft_multi(&obj.context, re, im, channels, length);
+            for (uint32_t ch = 0; ch < channels; ++ch) {
+                mc_fft_mono(&mono.context, refRe[ch], refIm[ch], length);
+                assert_memory_equal(refRe[ch], re[ch], sizeof(float)*length);
+                assert_memory_equal(refIm[ch], im[ch], sizeof(float)*length);
+            }
+            mc_ifft_multi(&obj.context, re, im, channels, length);
+            for (uint32_t ch = 0; ch < channels; ++ch) {
+                mc_ifft_mono(&mono.context, refRe[ch], refIm[ch], length);
+                assert_memory_equal(refRe[ch], re[ch], sizeof(float)*length);
+                assert_memory_equal(refIm[ch], im[ch], sizeof(float)*length);
+            }
+        }
+        for (uint32_t ch = 0; ch < channels; ++ch) {
+            free(re[ch]);
+            free(im[ch]);
+            free(refRe[ch]);
+            free(refIm[ch]);
+        }
+        mc_fft_free(&mono);
+        mc_fft_multi_free(&obj);
+    }
+}
+
 int main(void)
 {
     const struct CMUnitTest utests[] = {
         cmocka_unit_test(cmocka_fft_match_response),
-        cmocka_unit_test(cmocka_odd_match_response)
+        cmocka_unit_test(cmocka_odd_match_response),
+        cmocka_unit_test(cmocka_fft_sizes_match_dft),
+        cmocka_unit_test(cmocka_static_match_response),
+        cmocka_unit_test(cmocka_plan_match_response),
+        cmocka_unit_test(cmocka_wisdom_export_import),
+        cmocka_unit_test(cmocka_image_match_response),
+        cmocka_unit_test(cmocka_conv_match_direct),
+        cmocka_unit_test(cmocka_pconv_match_direct),
+        cmocka_unit_test(cmocka_scrambled_match_response),
+        cmocka_unit_test(cmocka_corr_match_direct),
+        cmocka_unit_test(cmocka_spectrum_postprocess_match_libm),
+        cmocka_unit_test(cmocka_stft_match_reference),
+        cmocka_unit_test(cmocka_welch_match_direct),
+        cmocka_unit_test(cmocka_prune_match_full),
+        cmocka_unit_test(cmocka_sdft_match_fft),
+        cmocka_unit_test(cmocka_thread_pool_run),
+        cmocka_unit_test(cmocka_parallel_match_mono),
+        cmocka_unit_test(cmocka_batch_match_mono),
+        cmocka_unit_test(cmocka_async_match_mono),
+        cmocka_unit_test(cmocka_async_stress_capacity),
+        cmocka_unit_test(cmocka_fft_2d_match_mono),
+        cmocka_unit_test(cmocka_fft_3d_match_mono),
+        cmocka_unit_test(cmocka_transpose_match_naive),
+        cmocka_unit_test(cmocka_dct_match_direct),
+        cmocka_unit_test(cmocka_mdct_match_direct),
+        cmocka_unit_test(cmocka_channelizer_match_direct),
+        cmocka_unit_test(cmocka_goertzel_match_dft),
+        cmocka_unit_test(cmocka_fft_multi_match_mono)
     };
 
     return cmocka_run_group_tests(utests, NULL, NULL);
@@ -0,0 +1,83 @@
+#include "mcfft.h"
+#include "mcfft_static.hpp"
+#include "reference_signals.h"
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
+#include <cstdarg>
+#include <cstddef>
+#include <csetjmp>
+#include <cmocka.h>
+
+#define MC_TEST_ZEROS_CHECK(array, threshold) { \
+        float zero_array_tmp123[MC_ARRAY_LENGTH((array))]; \
+        memset(zero_array_tmp123, 0, sizeof(zero_array_tmp123)); \
+        assert_true((threshold) > mc_test_mean_error(zero_array_tmp123, (array), MC_ARRAY_LENGTH((array)))); \
+    }
+
+/* Tables are calculated at compile time */
+static_assert(mc::static_tables<MC_REF_FFT_POW2>::digitRev[1] == 16u, "Unexpected digit reverse");
+static_assert(mc::static_tables<MC_REF_FFT_POW2>::twiddle[0] == 1.f, "Unexpected twiddle");
+
+template <uint32_t power2>
+static void st_check_tables() {
+    float twiddle[MC_TWIDDLE_LENGTH(power2)];
+    uint32_t digitRev[MC_DIGIT_LENGTH(power2)];
+    mc_fft_get_twiddle(twiddle, MC_TWIDDLE_LENGTH(power2), power2);
+    mc_fft_get_digitRev(digitRev, MC_DIGIT_LENGTH(power2), power2);
+    assert_true(0 == memcmp(digitRev, mc::static_tables<power2>::digitRev.data(), sizeof(digitRev)));
+    /* Constexpr cos/sin may differ from libm by 1 ULP */
+    assert_true(1E-7 > mc_test_mean_error(twiddle, mc::static_tables<power2>::twiddle.data(), MC_TWIDDLE_LENGTH(power2)));
+}
+
+static void cmocka_static_tables(void **state) {
+    (void)state;
+    st_check_tables<5u>();
+    st_check_tables<6u>();
+    st_check_tables<7u>();
+    st_check_tables<8u>();
+    st_check_tables<11u>();
+    st_check_tables<14u>();
+}
+
+static void cmocka_static_match_response(void **state) {
+    float mono_re0[MC_ARRAY_LENGTH(ref_fft_mono_input0)];
+    float mono_im0[MC_ARRAY_LENGTH(ref_fft_mono_input0)];
+    float mono_re2[MC_ARRAY_LENGTH(ref_fft_mono_input2)];
+    float mono_im2[MC_ARRAY_LENGTH(ref_fft_mono_input2)];
+    mc::static_fft<MC_REF_FFT_POW2> fft64;
+    mc::static_fft<MC_REF_FFT_ODD_POW2> fft128;
+    (void)state;
+
+    memcpy(mono_re0, ref_fft_mono_input0, sizeof(mono_re0));
+    memset(mono_im0, 0, sizeof(mono_im0));
+    fft64.forward(mono_re0, mono_im0);
+    assert_true(1E-6 > mc_test_mean_error(mono_re0, ref_fft_mono_re0, MC_ARRAY_LENGTH(mono_re0)));
+    assert_true(1E-6 > mc_test_mean_error(mono_im0, ref_fft_mono_im0, MC_ARRAY_LENGTH(mono_im0)));
+    fft64.inverse(mono_re0, mono_im0);
+    mc_fft_norm(mono_re0, mono_im0, MC_ARRAY_LENGTH(mono_re0));
+    assert_true(1E-6 > mc_test_mean_error(mono_re0, ref_fft_mono_input0, MC_ARRAY_LENGTH(mono_re0)));
+    MC_TEST_ZEROS_CHECK(mono_im0, 1E-6);
+
+    memcpy(mono_re2, ref_fft_mono_input2, sizeof(mono_re2));
+    memset(mono_im2, 0, sizeof(mono_im2));
+    fft128.forward(mono_re2, mono_im2);
+    assert_true(1E-6 > mc_test_mean_error(mono_re2, ref_fft_mono_re2, MC_ARRAY_LENGTH(mono_re2)));
+    assert_true(1E-6 > mc_test_mean_error(mono_im2, ref_fft_mono_im2, MC_ARRAY_LENGTH(mono_im2)));
+    fft128.inverse(mono_re2, mono_im2);
+    mc_fft_norm(mono_re2, mono_im2, MC_ARRAY_LENGTH(mono_re2));
+    assert_true(1E-6 > mc_test_mean_error(mono_re2, ref_fft_mono_input2, MC_ARRAY_LENGTH(mono_re2)));
+    MC_TEST_ZEROS_CHECK(mono_im2, 1E-6);
+}
+
+int main(void)
+{
+    const struct CMUnitTest utests[] = {
+        cmocka_unit_test(cmocka_static_tables),
+        cmocka_unit_test(cmocka_static_match_response)
+    };
+
+    return cmocka_run_group_tests(utests, NULL, NULL);
+}